@@ -44,6 +44,15 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
 
     InitTexToShaderMap();
 
+    // 헤드리스(Null 디바이스) 모드: 빌보드 메시/텍스처처럼 GPU 전용인 기본 리소스는 만들지 않는다
+    // (기본 머티리얼은 컴포넌트들이 CPU 경로에서도 참조하므로 셰이더 경로만 가진 채로 생성)
+    if (!Device)
+    {
+        CreateDefaultMaterial();
+        PreLoadAnimStateMachines();
+        return;
+    }
+
     CreateTextBillboardMesh();//"TextBillboard"
     CreateBillboardMesh(); // Billboard
     CreateTextBillboardTexture();
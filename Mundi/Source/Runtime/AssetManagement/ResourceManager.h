@@ -218,6 +218,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
+		FScopedMemoryTag MemoryTag(EMemoryTag::Assets);
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
@@ -35,9 +35,12 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
         return;
     }
 
-    // GPU 버퍼 생성
-    CreateVertexBuffer(Data, InDevice);
-    CreateIndexBuffer(Data, InDevice);
+    // GPU 버퍼 생성 (헤드리스 모드에서는 CPU 데이터만 유지)
+    if (InDevice)
+    {
+        CreateVertexBuffer(Data, InDevice);
+        CreateIndexBuffer(Data, InDevice);
+    }
     VertexCount = static_cast<uint32>(Data->Vertices.size());
     IndexCount = static_cast<uint32>(Data->Indices.size());
     VertexStride = sizeof(FSkinnedVertexDynamic);
@@ -68,6 +71,7 @@ void USkeletalMesh::CreateVertexBufferForComp(ID3D11Buffer** InVertexBuffer)
 {
     if (!Data) { return; }
     ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
+    if (!Device) { return; } // 헤드리스 모드
     HRESULT hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, Data->Vertices, InVertexBuffer, false);
     assert(SUCCEEDED(hr));
 }
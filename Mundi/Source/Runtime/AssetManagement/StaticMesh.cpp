@@ -49,8 +49,7 @@ UStaticMesh::~UStaticMesh()
 
 void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
 {
-    assert(InDevice);
-
+    // InDevice가 nullptr이면 헤드리스 모드: CPU 메시 데이터와 바운드만 로드한다
     SetVertexType(InVertexType);
 
     // 파일 확장자 확인
@@ -89,8 +88,11 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
     if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
     {
         CacheFilePath = StaticMeshAsset->CacheFilePath;
-        CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
-        CreateIndexBuffer(StaticMeshAsset, InDevice);
+        if (InDevice)
+        {
+            CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
+            CreateIndexBuffer(StaticMeshAsset, InDevice);
+        }
         CreateLocalBound(StaticMeshAsset);
         VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
         IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
@@ -112,8 +114,11 @@ void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutT
         IndexBuffer = nullptr;
     }
 
-    CreateVertexBuffer(InData, InDevice, InVertexType);
-    CreateIndexBuffer(InData, InDevice);
+    if (InDevice)
+    {
+        CreateVertexBuffer(InData, InDevice, InVertexType);
+        CreateIndexBuffer(InData, InDevice);
+    }
     CreateLocalBound(InData);
 
     VertexCount = static_cast<uint32>(InData->Vertices.size());
@@ -21,7 +21,11 @@ UTexture::~UTexture()
 
 void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
 {
-	assert(InDevice);
+	// 헤드리스 모드: 텍스처는 GPU 전용 데이터이므로 로드하지 않는다
+	if (!InDevice)
+	{
+		return;
+	}
 
 	// 실제로 로드할 파일 경로 결정
 	FString ActualLoadPath = InFilePath;
@@ -0,0 +1,433 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief Robin Hood 선형 탐사 기반 open addressing 해시 테이블 (TFlatMap/TFlatSet 공용 구현)
+ * - 원소를 하나의 연속 배열에 직접 저장하므로 노드 할당이 없고, 조회는 캐시 라인 몇 개 안에서 끝난다
+ * - 슬롯마다 "원래 자리로부터의 거리 + 1"을 1바이트로 기록 (0 = 빈 슬롯)
+ * - 삽입 시 자기보다 가까운 원소를 밀어내고(Robin Hood), 삭제는 뒤 원소를 한 칸씩 당겨 묘비를 남기지 않는다
+ * - 부하율 80%를 넘으면 두 배로 키운다
+ *
+ * 주의: 삽입/삭제/재해시 때 원소가 이동하므로 Find가 돌려준 포인터와 반복자는 다음 수정 전까지만 유효하다.
+ *       순회 중 삽입/삭제는 지원하지 않는다.
+ */
+namespace FlatHash
+{
+    // std::hash는 포인터/정수에 대해 항등 함수인 경우가 많아 하위 비트가 치우치므로 섞어서 쓴다
+    inline uint64 MixHash(size_t InHash)
+    {
+        uint64 Hash = static_cast<uint64>(InHash);
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdULL;
+        Hash ^= Hash >> 33;
+        return Hash;
+    }
+
+    template<typename KeyType>
+    struct TSetKeyFuncs
+    {
+        static const KeyType& GetKey(const KeyType& Element) { return Element; }
+    };
+
+    template<typename KeyType, typename ValueType>
+    struct TMapKeyFuncs
+    {
+        static const KeyType& GetKey(const std::pair<KeyType, ValueType>& Element) { return Element.first; }
+    };
+
+    template<typename ElementType, typename KeyType, typename KeyFuncs, typename Hasher>
+    class TRobinHoodTable
+    {
+    public:
+        template<bool bConst>
+        class TIteratorBase
+        {
+            using TableType = std::conditional_t<bConst, const TRobinHoodTable, TRobinHoodTable>;
+            using RefType = std::conditional_t<bConst, const ElementType&, ElementType&>;
+            using PtrType = std::conditional_t<bConst, const ElementType*, ElementType*>;
+
+        public:
+            TIteratorBase(TableType* InTable, uint32 InIndex) : Table(InTable), Index(InIndex) { SkipEmpty(); }
+
+            RefType operator*() const { return Table->Elements[Index]; }
+            PtrType operator->() const { return &Table->Elements[Index]; }
+
+            TIteratorBase& operator++()
+            {
+                ++Index;
+                SkipEmpty();
+                return *this;
+            }
+
+            bool operator==(const TIteratorBase& Other) const { return Index == Other.Index; }
+            bool operator!=(const TIteratorBase& Other) const { return Index != Other.Index; }
+
+        private:
+            void SkipEmpty()
+            {
+                const uint32 Capacity = static_cast<uint32>(Table->Distances.size());
+                while (Index < Capacity && Table->Distances[Index] == 0)
+                {
+                    ++Index;
+                }
+            }
+
+            TableType* Table;
+            uint32 Index;
+
+            friend class TRobinHoodTable;
+        };
+
+        using iterator = TIteratorBase<false>;
+        using const_iterator = TIteratorBase<true>;
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, GetCapacity()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, GetCapacity()); }
+
+        int32 Num() const { return NumElements; }
+        bool IsEmpty() const { return NumElements == 0; }
+        uint32 GetCapacity() const { return static_cast<uint32>(Distances.size()); }
+
+        /** 메모리까지 해제 */
+        void Empty()
+        {
+            Elements.Empty();
+            Distances.Empty();
+            NumElements = 0;
+            Mask = 0;
+        }
+
+        /** 원소만 비우고 버킷 배열은 유지 (매 프레임 다시 채우는 용도) */
+        void Reset()
+        {
+            if (NumElements == 0)
+            {
+                return;
+            }
+            for (uint32 i = 0; i < GetCapacity(); ++i)
+            {
+                if (Distances[i] != 0)
+                {
+                    Elements[i] = ElementType();
+                    Distances[i] = 0;
+                }
+            }
+            NumElements = 0;
+        }
+
+        void Reserve(int32 Count)
+        {
+            uint32 Required = MinCapacity;
+            while (Required * MaxLoadNum < static_cast<uint32>(Count) * MaxLoadDen)
+            {
+                Required <<= 1;
+            }
+            if (Required > GetCapacity())
+            {
+                Rehash(Required);
+            }
+        }
+
+        bool Contains(const KeyType& Key) const { return FindIndex(Key) != InvalidIndex; }
+
+        // STL 호환
+        int32 size() const { return NumElements; }
+        bool empty() const { return NumElements == 0; }
+        void clear() { Reset(); }
+        size_t count(const KeyType& Key) const { return Contains(Key) ? 1 : 0; }
+
+        iterator find(const KeyType& Key)
+        {
+            const uint32 Index = FindIndex(Key);
+            return iterator(this, Index == InvalidIndex ? GetCapacity() : Index);
+        }
+
+        const_iterator find(const KeyType& Key) const
+        {
+            const uint32 Index = FindIndex(Key);
+            return const_iterator(this, Index == InvalidIndex ? GetCapacity() : Index);
+        }
+
+        size_t erase(const KeyType& Key)
+        {
+            const uint32 Index = FindIndex(Key);
+            if (Index == InvalidIndex)
+            {
+                return 0;
+            }
+            RemoveAt(Index);
+            return 1;
+        }
+
+    protected:
+        static constexpr uint32 InvalidIndex = (std::numeric_limits<uint32>::max)();
+        static constexpr uint32 MinCapacity = 16;
+        static constexpr uint32 MaxLoadNum = 4;    // 부하율 상한 4/5
+        static constexpr uint32 MaxLoadDen = 5;
+        static constexpr uint8 MaxDistance = 255;
+
+        uint32 HomeIndex(const KeyType& Key) const
+        {
+            return static_cast<uint32>(MixHash(Hasher{}(Key))) & Mask;
+        }
+
+        uint32 FindIndex(const KeyType& Key) const
+        {
+            if (NumElements == 0)
+            {
+                return InvalidIndex;
+            }
+
+            uint32 Index = HomeIndex(Key);
+            for (uint32 Distance = 1; ; ++Distance)
+            {
+                const uint8 SlotDistance = Distances[Index];
+                // 빈 슬롯이거나 더 가까운 원소를 만나면 뒤에도 없다 (Robin Hood 불변식)
+                if (SlotDistance < Distance)
+                {
+                    return InvalidIndex;
+                }
+                if (SlotDistance == Distance && KeyFuncs::GetKey(Elements[Index]) == Key)
+                {
+                    return Index;
+                }
+                Index = (Index + 1) & Mask;
+            }
+        }
+
+        /** 키가 없다고 확인된 원소를 삽입 (자리가 정해진 인덱스는 재해시로 바뀔 수 있으므로 돌려주지 않는다) */
+        void InsertNew(ElementType&& InElement)
+        {
+            if (GetCapacity() == 0 || (static_cast<uint32>(NumElements) + 1) * MaxLoadDen > GetCapacity() * MaxLoadNum)
+            {
+                Rehash(GetCapacity() == 0 ? MinCapacity : GetCapacity() * 2);
+            }
+
+            ElementType Element = std::move(InElement);
+            uint32 Index = HomeIndex(KeyFuncs::GetKey(Element));
+            uint8 Distance = 1;
+            while (true)
+            {
+                if (Distances[Index] == 0)
+                {
+                    Elements[Index] = std::move(Element);
+                    Distances[Index] = Distance;
+                    ++NumElements;
+                    return;
+                }
+
+                if (Distances[Index] < Distance)
+                {
+                    std::swap(Element, Elements[Index]);
+                    std::swap(Distance, Distances[Index]);
+                }
+
+                Index = (Index + 1) & Mask;
+                if (++Distance == MaxDistance)
+                {
+                    // 탐사 거리가 1바이트를 넘기 직전: 키우고 들고 있던 원소부터 다시 넣는다
+                    Rehash(GetCapacity() * 2);
+                    InsertNew(std::move(Element));
+                    return;
+                }
+            }
+        }
+
+        void RemoveAt(uint32 Index)
+        {
+            // 뒤 원소 중 제자리가 아닌 것들을 한 칸씩 당긴다 (backward shift)
+            uint32 Next = (Index + 1) & Mask;
+            while (Distances[Next] > 1)
+            {
+                Elements[Index] = std::move(Elements[Next]);
+                Distances[Index] = static_cast<uint8>(Distances[Next] - 1);
+                Index = Next;
+                Next = (Next + 1) & Mask;
+            }
+            Elements[Index] = ElementType();
+            Distances[Index] = 0;
+            --NumElements;
+        }
+
+        void Rehash(uint32 NewCapacity)
+        {
+            TArray<ElementType> OldElements;
+            TArray<uint8> OldDistances;
+            OldElements.swap(Elements);
+            OldDistances.swap(Distances);
+
+            Elements.resize(NewCapacity);
+            Distances.assign(NewCapacity, 0);
+            Mask = NewCapacity - 1;
+            NumElements = 0;
+
+            for (uint32 i = 0; i < static_cast<uint32>(OldDistances.size()); ++i)
+            {
+                if (OldDistances[i] != 0)
+                {
+                    InsertNew(std::move(OldElements[i]));
+                }
+            }
+        }
+
+        TArray<ElementType> Elements;
+        TArray<uint8> Distances;
+        int32 NumElements = 0;
+        uint32 Mask = 0;
+    };
+}
+
+/**
+ * @brief TSet과 같은 API의 open addressing 해시 집합
+ * 원소를 자주 넣고 빼는 핫 경로용. 원소 타입은 기본 생성 가능해야 한다.
+ */
+template<typename T, typename Hasher = std::hash<T>>
+class TFlatSet : public FlatHash::TRobinHoodTable<T, T, FlatHash::TSetKeyFuncs<T>, Hasher>
+{
+    using Super = FlatHash::TRobinHoodTable<T, T, FlatHash::TSetKeyFuncs<T>, Hasher>;
+
+public:
+    TFlatSet() = default;
+    TFlatSet(std::initializer_list<T> InitList)
+    {
+        for (const T& Item : InitList)
+        {
+            Add(Item);
+        }
+    }
+
+    /** 요소 추가 (새로 추가됐으면 true) */
+    bool Add(const T& Item)
+    {
+        if (this->FindIndex(Item) != Super::InvalidIndex)
+        {
+            return false;
+        }
+        this->InsertNew(T(Item));
+        return true;
+    }
+
+    /** 제거 */
+    bool Remove(const T& Item)
+    {
+        return this->erase(Item) > 0;
+    }
+
+    /** 배열로 변환 */
+    TArray<T> Array() const
+    {
+        TArray<T> Result;
+        Result.Reserve(this->Num());
+        for (const T& Item : *this)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+
+    // STL 호환
+    std::pair<typename Super::iterator, bool> insert(const T& Item)
+    {
+        const bool bAdded = Add(Item);
+        return { this->find(Item), bAdded };
+    }
+};
+
+/**
+ * @brief TMap과 같은 API의 open addressing 해시 맵
+ * 순회 시 원소는 std::pair<Key, Value>라서 기존 TMap 루프(Pair.first/Pair.second)를 그대로 쓸 수 있다.
+ * 키/값 타입은 기본 생성 가능해야 하며, 키는 순회 중에 바꾸지 말 것.
+ */
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>>
+class TFlatMap : public FlatHash::TRobinHoodTable<std::pair<KeyType, ValueType>, KeyType, FlatHash::TMapKeyFuncs<KeyType, ValueType>, Hasher>
+{
+    using Super = FlatHash::TRobinHoodTable<std::pair<KeyType, ValueType>, KeyType, FlatHash::TMapKeyFuncs<KeyType, ValueType>, Hasher>;
+
+public:
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        const uint32 Index = this->FindIndex(Key);
+        if (Index != Super::InvalidIndex)
+        {
+            this->Elements[Index].second = Value;
+            return;
+        }
+        this->InsertNew(std::pair<KeyType, ValueType>(Key, Value));
+    }
+
+    /** 키가 없을 때만 추가 (TMap::Emplace와 같은 의미) */
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        if (this->FindIndex(Key) == Super::InvalidIndex)
+        {
+            this->InsertNew(std::pair<KeyType, ValueType>(Key, ValueType(std::forward<Args>(args)...)));
+        }
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->erase(Key) > 0;
+    }
+
+    /** 검색 */
+    ValueType* Find(const KeyType& Key)
+    {
+        const uint32 Index = this->FindIndex(Key);
+        return (Index != Super::InvalidIndex) ? &this->Elements[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const uint32 Index = this->FindIndex(Key);
+        return (Index != Super::InvalidIndex) ? &this->Elements[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        uint32 Index = this->FindIndex(Key);
+        if (Index == Super::InvalidIndex)
+        {
+            this->InsertNew(std::pair<KeyType, ValueType>(Key, ValueType{}));
+            Index = this->FindIndex(Key);
+        }
+        return this->Elements[Index].second;
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->Num());
+        for (const auto& Pair : *this)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->Num());
+        for (const auto& Pair : *this)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+
+    // STL 호환
+    ValueType& operator[](const KeyType& Key) { return FindOrAdd(Key); }
+};
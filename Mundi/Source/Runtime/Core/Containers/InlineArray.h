@@ -0,0 +1,332 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 처음 N개 원소를 객체 내부 버퍼에 저장하는 TArray 변형 (small buffer optimization)
+ * 프레임마다 만들고 버리는 작은 임시 배열용. N개 이하이면 힙 할당이 전혀 없고,
+ * 넘치면 AllocatorType(기본은 일반 힙)으로 옮겨 계속 동작한다.
+ * API는 TArray와 같고, 기존 루프를 그대로 쓸 수 있도록 std 스타일 함수도 제공한다.
+ * TArray&를 받는 함수에는 넘길 수 없으므로 GetData()/Num()을 받는 오버로드를 사용할 것.
+ */
+template<typename T, int32 N, typename AllocatorType = std::allocator<T>>
+class TInlineArray
+{
+    static_assert(N > 0, "TInlineArray requires at least one inline element");
+
+public:
+    TInlineArray() = default;
+
+    TInlineArray(std::initializer_list<T> InitList)
+    {
+        Reserve(static_cast<int32>(InitList.size()));
+        for (const T& Item : InitList)
+        {
+            Add(Item);
+        }
+    }
+
+    TInlineArray(const TInlineArray& Other)
+    {
+        CopyFrom(Other.GetData(), Other.Num());
+    }
+
+    TInlineArray(TInlineArray&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    TInlineArray& operator=(const TInlineArray& Other)
+    {
+        if (this != &Other)
+        {
+            Empty();
+            CopyFrom(Other.GetData(), Other.Num());
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Empty();
+            ReleaseHeap();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    ~TInlineArray()
+    {
+        Empty();
+        ReleaseHeap();
+    }
+
+    /** 요소 추가 */
+    int32 Add(const T& Item)
+    {
+        return Emplace(Item);
+    }
+
+    int32 Add(T&& Item)
+    {
+        return Emplace(std::move(Item));
+    }
+
+    template<typename... Args>
+    int32 Emplace(Args&&... args)
+    {
+        if (Count == Capacity)
+        {
+            // 인자가 자기 원소를 가리킬 수 있으므로 먼저 만들어 두고 키운다
+            T Temp(std::forward<Args>(args)...);
+            Grow(Capacity * 2);
+            new (Data + Count) T(std::move(Temp));
+        }
+        else
+        {
+            new (Data + Count) T(std::forward<Args>(args)...);
+        }
+        return Count++;
+    }
+
+    /** 고유 요소만 추가 */
+    int32 AddUnique(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        return (Index != -1) ? Index : Add(Item);
+    }
+
+    /** 배열 병합 */
+    void Append(const T* Items, int32 NumItems)
+    {
+        Reserve(Count + NumItems);
+        for (int32 i = 0; i < NumItems; ++i)
+        {
+            new (Data + Count) T(Items[i]);
+            ++Count;
+        }
+    }
+
+    template<typename OtherAllocatorType>
+    void Append(const TArray<T, OtherAllocatorType>& Other)
+    {
+        Append(Other.GetData(), Other.Num());
+    }
+
+    /** 삽입 */
+    void Insert(const T& Item, int32 Index)
+    {
+        Add(Item);
+        std::rotate(Data + Index, Data + Count - 1, Data + Count);
+    }
+
+    /** 제거 */
+    void RemoveAt(int32 Index)
+    {
+        std::move(Data + Index + 1, Data + Count, Data + Index);
+        Data[--Count].~T();
+    }
+
+    /** 빠르게 제거 (순서 보존 X) */
+    void RemoveAtSwap(int32 Index)
+    {
+        if (Index != Count - 1)
+        {
+            Data[Index] = std::move(Data[Count - 1]);
+        }
+        Data[--Count].~T();
+    }
+
+    bool Remove(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        if (Index == -1)
+        {
+            return false;
+        }
+        RemoveAt(Index);
+        return true;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return Count; }
+    bool IsEmpty() const { return Count == 0; }
+    int32 Max() const { return Capacity; }
+
+    // 내부 버퍼를 쓰고 있는지 (넘쳐서 힙으로 옮겨졌으면 false)
+    bool IsInline() const { return Data == GetInlineData(); }
+
+    /** 원소만 비우고 용량은 유지 (TArray::Empty와 같은 의미) */
+    void Empty()
+    {
+        std::destroy(Data, Data + Count);
+        Count = 0;
+    }
+
+    void Reserve(int32 NewCapacity)
+    {
+        if (NewCapacity > Capacity)
+        {
+            Grow(NewCapacity);
+        }
+    }
+
+    void SetNum(int32 NewSize)
+    {
+        Resize(NewSize, [](T* Ptr) { new (Ptr) T(); });
+    }
+
+    void SetNum(int32 NewSize, const T& DefaultValue)
+    {
+        Resize(NewSize, [&DefaultValue](T* Ptr) { new (Ptr) T(DefaultValue); });
+    }
+
+    /** 접근 */
+    T& operator[](int32 Index) { return Data[Index]; }
+    const T& operator[](int32 Index) const { return Data[Index]; }
+
+    T& Last() { return Data[Count - 1]; }
+    const T& Last() const { return Data[Count - 1]; }
+
+    /** 내부 데이터 포인터 반환 */
+    T* GetData() { return Data; }
+    const T* GetData() const { return Data; }
+
+    /** Stack 기능 */
+    void Push(const T& Item)
+    {
+        Add(Item);
+    }
+
+    T Pop()
+    {
+        T Item = std::move(Data[Count - 1]);
+        Data[--Count].~T();
+        return Item;
+    }
+
+    /** 검색 */
+    int32 Find(const T& Item) const
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            if (Data[i] == Item)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    bool Contains(const T& Item) const
+    {
+        return Find(Item) != -1;
+    }
+
+    /** 정렬 */
+    void Sort()
+    {
+        std::sort(begin(), end());
+    }
+
+    template<typename Predicate>
+    void Sort(Predicate Pred)
+    {
+        std::sort(begin(), end(), Pred);
+    }
+
+    /** 범위 기반 for 지원 */
+    T* begin() { return Data; }
+    T* end() { return Data + Count; }
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + Count; }
+
+    // STL 호환
+    void push_back(const T& Item) { Add(Item); }
+    void pop_back() { Data[--Count].~T(); }
+    T& back() { return Last(); }
+    const T& back() const { return Last(); }
+    bool empty() const { return Count == 0; }
+    SIZE_T size() const { return static_cast<SIZE_T>(Count); }
+    void clear() { Empty(); }
+    T* data() { return Data; }
+    const T* data() const { return Data; }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineStorage); }
+    const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineStorage); }
+
+    void Grow(int32 NewCapacity)
+    {
+        AllocatorType Allocator;
+        T* NewData = Allocator.allocate(static_cast<SIZE_T>(NewCapacity));
+        std::uninitialized_move(Data, Data + Count, NewData);
+        std::destroy(Data, Data + Count);
+        ReleaseHeap();
+        Data = NewData;
+        Capacity = NewCapacity;
+    }
+
+    void ReleaseHeap()
+    {
+        if (!IsInline())
+        {
+            AllocatorType Allocator;
+            Allocator.deallocate(Data, static_cast<SIZE_T>(Capacity));
+            Data = GetInlineData();
+            Capacity = N;
+        }
+    }
+
+    template<typename ConstructFunc>
+    void Resize(int32 NewSize, ConstructFunc Construct)
+    {
+        if (NewSize < Count)
+        {
+            std::destroy(Data + NewSize, Data + Count);
+        }
+        else
+        {
+            Reserve(NewSize);
+            for (int32 i = Count; i < NewSize; ++i)
+            {
+                Construct(Data + i);
+            }
+        }
+        Count = NewSize;
+    }
+
+    void CopyFrom(const T* Items, int32 NumItems)
+    {
+        Reserve(NumItems);
+        std::uninitialized_copy(Items, Items + NumItems, Data);
+        Count = NumItems;
+    }
+
+    void MoveFrom(TInlineArray& Other)
+    {
+        if (Other.IsInline())
+        {
+            std::uninitialized_move(Other.Data, Other.Data + Other.Count, Data);
+            Count = Other.Count;
+            Other.Empty();
+        }
+        else
+        {
+            // 힙 버퍼는 포인터만 가져온다
+            Data = Other.Data;
+            Count = Other.Count;
+            Capacity = Other.Capacity;
+            Other.Data = Other.GetInlineData();
+            Other.Count = 0;
+            Other.Capacity = N;
+        }
+    }
+
+private:
+    alignas(T) unsigned char InlineStorage[sizeof(T) * N];
+    T* Data = GetInlineData();
+    int32 Count = 0;
+    int32 Capacity = N;
+};
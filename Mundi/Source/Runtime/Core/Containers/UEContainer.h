@@ -19,31 +19,65 @@ typedef wchar_t WIDECHAR;
 typedef std::string FString;
 typedef std::wstring FWideString;
 
+namespace ObjectFactory
+{
+    // GUObjectArray 슬롯의 현재 시리얼 번호 (범위 밖이면 0). 슬롯 객체가 삭제될 때마다 증가한다
+    uint32 GetObjectSerialNumber(uint32 Index);
+}
+
 // Lightweight weak object pointer compatible with engine UObject lifetime
-// - Stores a raw pointer (non-owning)
-// - Provides IsValid(), Get(), operators for containers
-// - Hash specialization provided below for unordered_map/set
+// - Stores a GUObjectArray handle (slot index + serial number) and the raw pointer
+// - IsValid()/Get() compare the slot's serial in O(1), so destroyed (or slot-reused) objects resolve to nullptr
+// - Objects not registered in GUObjectArray fall back to the raw pointer (cannot be validated)
+// - Equality/hash use the stored handle, so map keys stay stable after the object dies
 template<typename T>
 class TWeakObjectPtr
 {
 public:
     using ElementType = T;
 
-    TWeakObjectPtr() : Ptr(nullptr) {}
-    TWeakObjectPtr(std::nullptr_t) : Ptr(nullptr) {}
-    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr) {}
+    TWeakObjectPtr() : Ptr(nullptr), ObjectIndex(UINT32_MAX), SerialNumber(0) {}
+    TWeakObjectPtr(std::nullptr_t) : TWeakObjectPtr() {}
+    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr), ObjectIndex(UINT32_MAX), SerialNumber(0)
+    {
+        if (InPtr && InPtr->InternalIndex != UINT32_MAX)
+        {
+            ObjectIndex = InPtr->InternalIndex;
+            SerialNumber = ObjectFactory::GetObjectSerialNumber(ObjectIndex);
+        }
+    }
 
-    bool IsValid() const { return Ptr != nullptr; }
-    T* Get() const { return Ptr; }
+    bool IsValid() const { return Get() != nullptr; }
+    T* Get() const
+    {
+        if (ObjectIndex == UINT32_MAX)
+        {
+            return Ptr;
+        }
+        if (ObjectFactory::GetObjectSerialNumber(ObjectIndex) != SerialNumber)
+        {
+            return nullptr;
+        }
+        return Ptr;
+    }
 
-    T& operator*() const { return *Ptr; }
-    T* operator->() const { return Ptr; }
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
 
-    bool operator==(const TWeakObjectPtr& Other) const { return Ptr == Other.Ptr; }
-    bool operator!=(const TWeakObjectPtr& Other) const { return Ptr != Other.Ptr; }
+    bool operator==(const TWeakObjectPtr& Other) const
+    {
+        return Ptr == Other.Ptr && ObjectIndex == Other.ObjectIndex && SerialNumber == Other.SerialNumber;
+    }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    // 해시용 (객체가 파괴된 뒤에도 변하지 않는 값)
+    const void* GetRawPointer() const { return Ptr; }
+    uint32 GetSerialNumber() const { return SerialNumber; }
 
 private:
     T* Ptr;
+    uint32 ObjectIndex;
+    uint32 SerialNumber;
 };
 
 namespace std {
@@ -52,7 +86,7 @@ namespace std {
     {
         size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
         {
-            return hash<const void*>()(static_cast<const void*>(Key.Get()));
+            return hash<const void*>()(Key.GetRawPointer()) ^ (static_cast<size_t>(Key.GetSerialNumber()) << 1);
         }
     };
 }
@@ -68,12 +102,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (AllocatorType: 프레임 아레나 등 STL 할당자 교체용, 기본은 일반 힙) */
+template<typename T, typename AllocatorType = std::allocator<T>>
+class TArray : public std::vector<T, AllocatorType>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, AllocatorType>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -101,7 +135,8 @@ public:
     }
 
     /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    template<typename OtherAllocatorType>
+    void Append(const TArray<T, OtherAllocatorType>& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -0,0 +1,617 @@
+#include "pch.h"
+#include "TransformBatch.h"
+#include <cstddef>
+
+// FTransform을 float 10개(T3, R4, S3)로 보고 4 + 4 + 2개 묶음으로 읽고 쓴다
+static_assert(sizeof(FQuat) == sizeof(float) * 4, "FQuat must be 4 packed floats");
+static_assert(sizeof(FTransform) == sizeof(float) * 10, "FTransform must be 10 packed floats");
+static_assert(offsetof(FTransform, Rotation) == sizeof(float) * 3, "Unexpected FTransform layout");
+static_assert(offsetof(FTransform, Scale3D) == sizeof(float) * 7, "Unexpected FTransform layout");
+
+// 레인 묶음(최대 10개 레지스터)을 값으로 주고받으므로, 인라인되지 않으면 매번 스택을 거친다
+#if defined(_MSC_VER)
+#define LANE_INLINE __forceinline
+#else
+#define LANE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace
+{
+	// ─────────────────────────────
+	// 레인 연산 (AVX2: 8레인, SSE/Scalar: 4레인)
+	// LoadTransposed/StoreTransposed: 원소마다 float 4개를 읽어 성분별 레인 4개로 전치 (AoS ↔ SoA)
+	// LoadPairs/StorePairs: 원소마다 float 2개
+	// ─────────────────────────────
+#if defined(MUNDI_SIMD_AVX2)
+	typedef __m256 FLane;
+	constexpr int32 LaneWidth = 8;
+
+	LANE_INLINE FLane LaneSet1(float F) { return _mm256_set1_ps(F); }
+	LANE_INLINE FLane LaneAdd(FLane A, FLane B) { return _mm256_add_ps(A, B); }
+	LANE_INLINE FLane LaneSub(FLane A, FLane B) { return _mm256_sub_ps(A, B); }
+	LANE_INLINE FLane LaneMul(FLane A, FLane B) { return _mm256_mul_ps(A, B); }
+	LANE_INLINE FLane LaneDiv(FLane A, FLane B) { return _mm256_div_ps(A, B); }
+	LANE_INLINE FLane LaneMulAdd(FLane A, FLane B, FLane C) { return _mm256_fmadd_ps(A, B, C); }
+	LANE_INLINE FLane LaneNegMulAdd(FLane A, FLane B, FLane C) { return _mm256_fnmadd_ps(A, B, C); }
+	LANE_INLINE FLane LaneSqrt(FLane V) { return _mm256_sqrt_ps(V); }
+	// A < B ? -V : V
+	LANE_INLINE FLane LaneNegateIfLess(FLane V, FLane A, FLane B)
+	{
+		return _mm256_xor_ps(V, _mm256_and_ps(_mm256_cmp_ps(A, B, _CMP_LT_OQ), _mm256_set1_ps(-0.0f)));
+	}
+	// A > B ? X : Y
+	LANE_INLINE FLane LaneSelectGreater(FLane A, FLane B, FLane X, FLane Y)
+	{
+		return _mm256_blendv_ps(Y, X, _mm256_cmp_ps(A, B, _CMP_GT_OQ));
+	}
+
+	// 128비트 절반마다 4x4 전치 (원소 i와 i + 4가 같은 행)
+	LANE_INLINE void LaneTranspose(FLane& R0, FLane& R1, FLane& R2, FLane& R3)
+	{
+		const __m256 T0 = _mm256_unpacklo_ps(R0, R1);
+		const __m256 T1 = _mm256_unpackhi_ps(R0, R1);
+		const __m256 T2 = _mm256_unpacklo_ps(R2, R3);
+		const __m256 T3 = _mm256_unpackhi_ps(R2, R3);
+		R0 = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+		R1 = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+		R2 = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+		R3 = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	LANE_INLINE FLane LoadRowPair(const float* Low, const float* High)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Low)), _mm_loadu_ps(High), 1);
+	}
+
+	LANE_INLINE void StoreRowPair(float* Low, float* High, FLane V)
+	{
+		_mm_storeu_ps(Low, _mm256_castps256_ps128(V));
+		_mm_storeu_ps(High, _mm256_extractf128_ps(V, 1));
+	}
+
+	LANE_INLINE void LoadTransposed(const float* const* Src, FLane& X, FLane& Y, FLane& Z, FLane& W)
+	{
+		X = LoadRowPair(Src[0], Src[4]);
+		Y = LoadRowPair(Src[1], Src[5]);
+		Z = LoadRowPair(Src[2], Src[6]);
+		W = LoadRowPair(Src[3], Src[7]);
+		LaneTranspose(X, Y, Z, W);
+	}
+
+	LANE_INLINE void StoreTransposed(float* const* Dst, FLane X, FLane Y, FLane Z, FLane W)
+	{
+		LaneTranspose(X, Y, Z, W);
+		StoreRowPair(Dst[0], Dst[4], X);
+		StoreRowPair(Dst[1], Dst[5], Y);
+		StoreRowPair(Dst[2], Dst[6], Z);
+		StoreRowPair(Dst[3], Dst[7], W);
+	}
+
+	// (P0.xy, P1.xy)
+	LANE_INLINE __m128 LoadTwoPairs(const float* P0, const float* P1)
+	{
+		return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(P0)), reinterpret_cast<const __m64*>(P1));
+	}
+
+	LANE_INLINE void LoadPairs(const float* const* Src, FLane& X, FLane& Y)
+	{
+		const __m256 P01 = _mm256_insertf128_ps(_mm256_castps128_ps256(LoadTwoPairs(Src[0], Src[1])), LoadTwoPairs(Src[4], Src[5]), 1);
+		const __m256 P23 = _mm256_insertf128_ps(_mm256_castps128_ps256(LoadTwoPairs(Src[2], Src[3])), LoadTwoPairs(Src[6], Src[7]), 1);
+		X = _mm256_shuffle_ps(P01, P23, _MM_SHUFFLE(2, 0, 2, 0));
+		Y = _mm256_shuffle_ps(P01, P23, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+
+	LANE_INLINE void StorePairs(float* const* Dst, FLane X, FLane Y)
+	{
+		const __m256 Low = _mm256_unpacklo_ps(X, Y);
+		const __m256 High = _mm256_unpackhi_ps(X, Y);
+		const __m128 P01 = _mm256_castps256_ps128(Low);
+		const __m128 P23 = _mm256_castps256_ps128(High);
+		const __m128 P45 = _mm256_extractf128_ps(Low, 1);
+		const __m128 P67 = _mm256_extractf128_ps(High, 1);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[0]), P01);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[1]), P01);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[2]), P23);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[3]), P23);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[4]), P45);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[5]), P45);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[6]), P67);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[7]), P67);
+	}
+#elif defined(MUNDI_SIMD_SSE)
+	typedef __m128 FLane;
+	constexpr int32 LaneWidth = 4;
+
+	LANE_INLINE FLane LaneSet1(float F) { return _mm_set1_ps(F); }
+	LANE_INLINE FLane LaneAdd(FLane A, FLane B) { return _mm_add_ps(A, B); }
+	LANE_INLINE FLane LaneSub(FLane A, FLane B) { return _mm_sub_ps(A, B); }
+	LANE_INLINE FLane LaneMul(FLane A, FLane B) { return _mm_mul_ps(A, B); }
+	LANE_INLINE FLane LaneDiv(FLane A, FLane B) { return _mm_div_ps(A, B); }
+	LANE_INLINE FLane LaneMulAdd(FLane A, FLane B, FLane C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+	LANE_INLINE FLane LaneNegMulAdd(FLane A, FLane B, FLane C) { return _mm_sub_ps(C, _mm_mul_ps(A, B)); }
+	LANE_INLINE FLane LaneSqrt(FLane V) { return _mm_sqrt_ps(V); }
+	LANE_INLINE FLane LaneNegateIfLess(FLane V, FLane A, FLane B)
+	{
+		return _mm_xor_ps(V, _mm_and_ps(_mm_cmplt_ps(A, B), _mm_set1_ps(-0.0f)));
+	}
+	LANE_INLINE FLane LaneSelectGreater(FLane A, FLane B, FLane X, FLane Y)
+	{
+		const __m128 Mask = _mm_cmpgt_ps(A, B);
+		return _mm_or_ps(_mm_and_ps(Mask, X), _mm_andnot_ps(Mask, Y));
+	}
+
+	LANE_INLINE void LoadTransposed(const float* const* Src, FLane& X, FLane& Y, FLane& Z, FLane& W)
+	{
+		X = _mm_loadu_ps(Src[0]);
+		Y = _mm_loadu_ps(Src[1]);
+		Z = _mm_loadu_ps(Src[2]);
+		W = _mm_loadu_ps(Src[3]);
+		_MM_TRANSPOSE4_PS(X, Y, Z, W);
+	}
+
+	LANE_INLINE void StoreTransposed(float* const* Dst, FLane X, FLane Y, FLane Z, FLane W)
+	{
+		_MM_TRANSPOSE4_PS(X, Y, Z, W);
+		_mm_storeu_ps(Dst[0], X);
+		_mm_storeu_ps(Dst[1], Y);
+		_mm_storeu_ps(Dst[2], Z);
+		_mm_storeu_ps(Dst[3], W);
+	}
+
+	LANE_INLINE __m128 LoadTwoPairs(const float* P0, const float* P1)
+	{
+		return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(P0)), reinterpret_cast<const __m64*>(P1));
+	}
+
+	LANE_INLINE void LoadPairs(const float* const* Src, FLane& X, FLane& Y)
+	{
+		const __m128 P01 = LoadTwoPairs(Src[0], Src[1]);
+		const __m128 P23 = LoadTwoPairs(Src[2], Src[3]);
+		X = _mm_shuffle_ps(P01, P23, _MM_SHUFFLE(2, 0, 2, 0));
+		Y = _mm_shuffle_ps(P01, P23, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+
+	LANE_INLINE void StorePairs(float* const* Dst, FLane X, FLane Y)
+	{
+		const __m128 P01 = _mm_unpacklo_ps(X, Y);
+		const __m128 P23 = _mm_unpackhi_ps(X, Y);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[0]), P01);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[1]), P01);
+		_mm_storel_pi(reinterpret_cast<__m64*>(Dst[2]), P23);
+		_mm_storeh_pi(reinterpret_cast<__m64*>(Dst[3]), P23);
+	}
+#else
+	struct FLane
+	{
+		float V[4];
+	};
+	constexpr int32 LaneWidth = 4;
+
+	template<typename FuncType>
+	LANE_INLINE FLane LaneMap(FuncType&& Func)
+	{
+		FLane R;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			R.V[i] = Func(i);
+		}
+		return R;
+	}
+
+	LANE_INLINE FLane LaneSet1(float F) { return LaneMap([&](int32) { return F; }); }
+	LANE_INLINE FLane LaneAdd(FLane A, FLane B) { return LaneMap([&](int32 i) { return A.V[i] + B.V[i]; }); }
+	LANE_INLINE FLane LaneSub(FLane A, FLane B) { return LaneMap([&](int32 i) { return A.V[i] - B.V[i]; }); }
+	LANE_INLINE FLane LaneMul(FLane A, FLane B) { return LaneMap([&](int32 i) { return A.V[i] * B.V[i]; }); }
+	LANE_INLINE FLane LaneDiv(FLane A, FLane B) { return LaneMap([&](int32 i) { return A.V[i] / B.V[i]; }); }
+	LANE_INLINE FLane LaneMulAdd(FLane A, FLane B, FLane C) { return LaneMap([&](int32 i) { return A.V[i] * B.V[i] + C.V[i]; }); }
+	LANE_INLINE FLane LaneNegMulAdd(FLane A, FLane B, FLane C) { return LaneMap([&](int32 i) { return C.V[i] - A.V[i] * B.V[i]; }); }
+	LANE_INLINE FLane LaneSqrt(FLane V) { return LaneMap([&](int32 i) { return std::sqrt(V.V[i]); }); }
+	LANE_INLINE FLane LaneNegateIfLess(FLane V, FLane A, FLane B) { return LaneMap([&](int32 i) { return A.V[i] < B.V[i] ? -V.V[i] : V.V[i]; }); }
+	LANE_INLINE FLane LaneSelectGreater(FLane A, FLane B, FLane X, FLane Y) { return LaneMap([&](int32 i) { return A.V[i] > B.V[i] ? X.V[i] : Y.V[i]; }); }
+
+	LANE_INLINE void LoadTransposed(const float* const* Src, FLane& X, FLane& Y, FLane& Z, FLane& W)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			X.V[i] = Src[i][0];
+			Y.V[i] = Src[i][1];
+			Z.V[i] = Src[i][2];
+			W.V[i] = Src[i][3];
+		}
+	}
+
+	LANE_INLINE void StoreTransposed(float* const* Dst, FLane X, FLane Y, FLane Z, FLane W)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Dst[i][0] = X.V[i];
+			Dst[i][1] = Y.V[i];
+			Dst[i][2] = Z.V[i];
+			Dst[i][3] = W.V[i];
+		}
+	}
+
+	LANE_INLINE void LoadPairs(const float* const* Src, FLane& X, FLane& Y)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			X.V[i] = Src[i][0];
+			Y.V[i] = Src[i][1];
+		}
+	}
+
+	LANE_INLINE void StorePairs(float* const* Dst, FLane X, FLane Y)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Dst[i][0] = X.V[i];
+			Dst[i][1] = Y.V[i];
+		}
+	}
+#endif
+
+	// ─────────────────────────────
+	// 레인 묶음 (한 레인 = 한 원소)
+	// ─────────────────────────────
+	struct FQuatLanes
+	{
+		FLane X, Y, Z, W;
+	};
+
+	struct FVectorLanes
+	{
+		FLane X, Y, Z;
+	};
+
+	struct FTransformLanes
+	{
+		FVectorLanes Translation;
+		FQuatLanes Rotation;
+		FVectorLanes Scale;
+	};
+
+	/**
+	 * 한 묶음(LaneWidth개)의 원소 포인터.
+	 * 배열 끝에서 남는 레인은 읽기용 패딩/쓰기용 버림 슬롯을 가리키게 해서 커널은 항상 꽉 찬 묶음만 다룬다.
+	 */
+	template<typename ElementType>
+	struct TLanePointers
+	{
+		ElementType* Items[LaneWidth];
+
+		template<typename ElementFuncType>
+		LANE_INLINE TLanePointers(int32 Num, ElementType* Fallback, ElementFuncType&& ElementAt)
+		{
+			for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+			{
+				Items[Lane] = Lane < Num ? ElementAt(Lane) : Fallback;
+			}
+		}
+	};
+
+	template<typename BlockFuncType>
+	LANE_INLINE void ForEachLaneBlock(int32 Count, BlockFuncType&& BlockFunc)
+	{
+		for (int32 Base = 0; Base < Count; Base += LaneWidth)
+		{
+			BlockFunc(Base, std::min(LaneWidth, Count - Base));
+		}
+	}
+
+	LANE_INLINE FQuatLanes LoadQuats(const TLanePointers<const FQuat>& Src)
+	{
+		const float* Rows[LaneWidth];
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Src.Items[Lane]->X;
+		}
+		FQuatLanes Q;
+		LoadTransposed(Rows, Q.X, Q.Y, Q.Z, Q.W);
+		return Q;
+	}
+
+	LANE_INLINE void StoreQuats(const TLanePointers<FQuat>& Dst, const FQuatLanes& Q)
+	{
+		float* Rows[LaneWidth];
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Dst.Items[Lane]->X;
+		}
+		StoreTransposed(Rows, Q.X, Q.Y, Q.Z, Q.W);
+	}
+
+	// float [0, 4) = (T, R.X), [4, 8) = (R.YZW, S.X), [8, 10) = S.YZ
+	LANE_INLINE FTransformLanes LoadTransforms(const TLanePointers<const FTransform>& Src)
+	{
+		const float* Rows[LaneWidth];
+		FTransformLanes T;
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Src.Items[Lane]->Translation.X;
+		}
+		LoadTransposed(Rows, T.Translation.X, T.Translation.Y, T.Translation.Z, T.Rotation.X);
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Src.Items[Lane]->Rotation.Y;
+		}
+		LoadTransposed(Rows, T.Rotation.Y, T.Rotation.Z, T.Rotation.W, T.Scale.X);
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Src.Items[Lane]->Scale3D.Y;
+		}
+		LoadPairs(Rows, T.Scale.Y, T.Scale.Z);
+		return T;
+	}
+
+	LANE_INLINE void StoreTransforms(const TLanePointers<FTransform>& Dst, const FTransformLanes& T)
+	{
+		float* Rows[LaneWidth];
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Dst.Items[Lane]->Translation.X;
+		}
+		StoreTransposed(Rows, T.Translation.X, T.Translation.Y, T.Translation.Z, T.Rotation.X);
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Dst.Items[Lane]->Rotation.Y;
+		}
+		StoreTransposed(Rows, T.Rotation.Y, T.Rotation.Z, T.Rotation.W, T.Scale.X);
+
+		for (int32 Lane = 0; Lane < LaneWidth; ++Lane)
+		{
+			Rows[Lane] = &Dst.Items[Lane]->Scale3D.Y;
+		}
+		StorePairs(Rows, T.Scale.Y, T.Scale.Z);
+	}
+
+	// ─────────────────────────────
+	// 레인 단위 수식 (FQuat/FTransform의 원소별 구현과 같은 식)
+	// ─────────────────────────────
+	LANE_INLINE FQuatLanes QuatMultiply(const FQuatLanes& A, const FQuatLanes& B)
+	{
+		FQuatLanes R;
+		R.X = LaneNegMulAdd(A.Z, B.Y, LaneMulAdd(A.Y, B.Z, LaneMulAdd(A.X, B.W, LaneMul(A.W, B.X))));
+		R.Y = LaneMulAdd(A.Z, B.X, LaneMulAdd(A.Y, B.W, LaneNegMulAdd(A.X, B.Z, LaneMul(A.W, B.Y))));
+		R.Z = LaneMulAdd(A.Z, B.W, LaneNegMulAdd(A.Y, B.X, LaneMulAdd(A.X, B.Y, LaneMul(A.W, B.Z))));
+		R.W = LaneNegMulAdd(A.Z, B.Z, LaneNegMulAdd(A.Y, B.Y, LaneNegMulAdd(A.X, B.X, LaneMul(A.W, B.W))));
+		return R;
+	}
+
+	LANE_INLINE FLane QuatDot(const FQuatLanes& A, const FQuatLanes& B)
+	{
+		return LaneMulAdd(A.W, B.W, LaneMulAdd(A.Z, B.Z, LaneMulAdd(A.Y, B.Y, LaneMul(A.X, B.X))));
+	}
+
+	// FQuat::Normalize와 같은 규칙: 길이가 KINDA_SMALL_NUMBER 이하이면 단위 쿼터니언
+	LANE_INLINE FQuatLanes QuatNormalize(const FQuatLanes& Q)
+	{
+		const FLane Size = LaneSqrt(QuatDot(Q, Q));
+		const FLane Threshold = LaneSet1(KINDA_SMALL_NUMBER);
+		const FLane Zero = LaneSet1(0.0f);
+		const FLane One = LaneSet1(1.0f);
+		const FLane InvSize = LaneDiv(One, Size);
+
+		FQuatLanes R;
+		R.X = LaneSelectGreater(Size, Threshold, LaneMul(Q.X, InvSize), Zero);
+		R.Y = LaneSelectGreater(Size, Threshold, LaneMul(Q.Y, InvSize), Zero);
+		R.Z = LaneSelectGreater(Size, Threshold, LaneMul(Q.Z, InvSize), Zero);
+		R.W = LaneSelectGreater(Size, Threshold, LaneMul(Q.W, InvSize), One);
+		return R;
+	}
+
+	// A + (B - A) * Alpha
+	LANE_INLINE FLane LaneLerp(FLane A, FLane B, FLane Alpha)
+	{
+		return LaneMulAdd(LaneSub(B, A), Alpha, A);
+	}
+
+	// FQuat::Nlerp: 반대 반구면 B를 뒤집고 선형 보간 후 정규화
+	LANE_INLINE FQuatLanes QuatNlerp(const FQuatLanes& A, const FQuatLanes& B, FLane Alpha)
+	{
+		const FLane Dot = QuatDot(A, B);
+		const FLane Zero = LaneSet1(0.0f);
+		FQuatLanes R;
+		R.X = LaneLerp(A.X, LaneNegateIfLess(B.X, Dot, Zero), Alpha);
+		R.Y = LaneLerp(A.Y, LaneNegateIfLess(B.Y, Dot, Zero), Alpha);
+		R.Z = LaneLerp(A.Z, LaneNegateIfLess(B.Z, Dot, Zero), Alpha);
+		R.W = LaneLerp(A.W, LaneNegateIfLess(B.W, Dot, Zero), Alpha);
+		return QuatNormalize(R);
+	}
+
+	LANE_INLINE FVectorLanes VectorLerp(const FVectorLanes& A, const FVectorLanes& B, FLane Alpha)
+	{
+		return { LaneLerp(A.X, B.X, Alpha), LaneLerp(A.Y, B.Y, Alpha), LaneLerp(A.Z, B.Z, Alpha) };
+	}
+
+	LANE_INLINE FVectorLanes Cross(const FQuatLanes& A, const FVectorLanes& B)
+	{
+		return {
+			LaneNegMulAdd(A.Z, B.Y, LaneMul(A.Y, B.Z)),
+			LaneNegMulAdd(A.X, B.Z, LaneMul(A.Z, B.X)),
+			LaneNegMulAdd(A.Y, B.X, LaneMul(A.X, B.Y)) };
+	}
+
+	// FQuat::RotateVector: v + w * t + cross(q.xyz, t),  t = 2 * cross(q.xyz, v)
+	LANE_INLINE FVectorLanes QuatRotate(const FQuatLanes& Q, const FVectorLanes& V)
+	{
+		const FLane Two = LaneSet1(2.0f);
+		FVectorLanes T = Cross(Q, V);
+		T = { LaneMul(T.X, Two), LaneMul(T.Y, Two), LaneMul(T.Z, Two) };
+		const FVectorLanes C = Cross(Q, T);
+		return {
+			LaneAdd(LaneMulAdd(Q.W, T.X, V.X), C.X),
+			LaneAdd(LaneMulAdd(Q.W, T.Y, V.Y), C.Y),
+			LaneAdd(LaneMulAdd(Q.W, T.Z, V.Z), C.Z) };
+	}
+
+	// FTransform::GetWorldTransform
+	LANE_INLINE FTransformLanes ComposeLanes(const FTransformLanes& Parent, const FTransformLanes& Child)
+	{
+		FTransformLanes Result;
+		Result.Rotation = QuatNormalize(QuatMultiply(Parent.Rotation, Child.Rotation));
+		Result.Scale = { LaneMul(Parent.Scale.X, Child.Scale.X), LaneMul(Parent.Scale.Y, Child.Scale.Y), LaneMul(Parent.Scale.Z, Child.Scale.Z) };
+
+		const FVectorLanes Scaled = { LaneMul(Child.Translation.X, Parent.Scale.X), LaneMul(Child.Translation.Y, Parent.Scale.Y), LaneMul(Child.Translation.Z, Parent.Scale.Z) };
+		const FVectorLanes Rotated = QuatRotate(Parent.Rotation, Scaled);
+		Result.Translation = { LaneAdd(Parent.Translation.X, Rotated.X), LaneAdd(Parent.Translation.Y, Rotated.Y), LaneAdd(Parent.Translation.Z, Rotated.Z) };
+		return Result;
+	}
+
+	// 남는 레인이 읽는 값 (0 나눗셈이 생기지 않도록 단위 값)
+	const FQuat PaddingQuat = FQuat::Identity();
+	const FTransform PaddingTransform;
+}
+
+int32 FTransformBatch::GetLaneWidth()
+{
+	return LaneWidth;
+}
+
+void FTransformBatch::MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count)
+{
+	// 곱 하나가 셔플 몇 번과 FMA 4번이라 SoA로 전치하는 비용이 더 크다 → 원소마다 레지스터 하나로 곱한다
+	for (int32 i = 0; i < Count; ++i)
+	{
+		VectorStore(VectorQuaternionMultiply(VectorLoad(&A[i].X), VectorLoad(&B[i].X)), &Out[i].X);
+	}
+}
+
+void FTransformBatch::NlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count)
+{
+	const FLane AlphaLane = LaneSet1(Alpha);
+	FQuat Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FQuat> PtrA(Num, &PaddingQuat, [&](int32 Lane) { return A + Base + Lane; });
+		const TLanePointers<const FQuat> PtrB(Num, &PaddingQuat, [&](int32 Lane) { return B + Base + Lane; });
+		const TLanePointers<FQuat> PtrOut(Num, &Discard, [&](int32 Lane) { return Out + Base + Lane; });
+
+		StoreQuats(PtrOut, QuatNlerp(LoadQuats(PtrA), LoadQuats(PtrB), AlphaLane));
+	});
+}
+
+void FTransformBatch::MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count)
+{
+	// 행렬은 이미 행 단위 레지스터라 전치하지 않고 원소별로 곱한다 (AVX2에서는 두 행씩)
+	for (int32 i = 0; i < Count; ++i)
+	{
+		VectorMatrixMultiply(Out[i].Rows, A[i].Rows, B[i].Rows);
+	}
+}
+
+void FTransformBatch::ToMatrices(const FTransform* Transforms, FMatrix* Out, int32 Count)
+{
+	// 출력이 원소당 16개라 SoA로 계산하면 되돌리는 전치가 계산보다 비싸다.
+	// FQuat::ToMatrix (전치 포함) 결과의 행을 바로 만들고 스케일만 곱한다.
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FQuat& Q = Transforms[i].Rotation;
+		const FVector& S = Transforms[i].Scale3D;
+		const FVector& T = Transforms[i].Translation;
+
+		const float XX = Q.X * Q.X, YY = Q.Y * Q.Y, ZZ = Q.Z * Q.Z;
+		const float XY = Q.X * Q.Y, XZ = Q.X * Q.Z, YZ = Q.Y * Q.Z;
+		const float WX = Q.W * Q.X, WY = Q.W * Q.Y, WZ = Q.W * Q.Z;
+
+		Out[i].Rows[0] = VectorMultiply(VectorSet(1.0f - 2.0f * (YY + ZZ), 2.0f * (XY + WZ), 2.0f * (XZ - WY), 0.0f), VectorSetFloat1(S.X));
+		Out[i].Rows[1] = VectorMultiply(VectorSet(2.0f * (XY - WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ + WX), 0.0f), VectorSetFloat1(S.Y));
+		Out[i].Rows[2] = VectorMultiply(VectorSet(2.0f * (XZ + WY), 2.0f * (YZ - WX), 1.0f - 2.0f * (XX + YY), 0.0f), VectorSetFloat1(S.Z));
+		Out[i].Rows[3] = VectorSet(T.X, T.Y, T.Z, 1.0f);
+	}
+}
+
+void FTransformBatch::Compose(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count)
+{
+	FTransform Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FTransform> PtrParent(Num, &PaddingTransform, [&](int32 Lane) { return Parents + Base + Lane; });
+		const TLanePointers<const FTransform> PtrChild(Num, &PaddingTransform, [&](int32 Lane) { return Children + Base + Lane; });
+		const TLanePointers<FTransform> PtrOut(Num, &Discard, [&](int32 Lane) { return Out + Base + Lane; });
+
+		StoreTransforms(PtrOut, ComposeLanes(LoadTransforms(PtrParent), LoadTransforms(PtrChild)));
+	});
+}
+
+void FTransformBatch::ComposeIndexed(const FTransform* Local, const int32* BoneIndices, const int32* ParentIndices,
+	FTransform* InOutComponent, int32 Count)
+{
+	FTransform Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FTransform> PtrParent(Num, &PaddingTransform, [&](int32 Lane) { return InOutComponent + ParentIndices[BoneIndices[Base + Lane]]; });
+		const TLanePointers<const FTransform> PtrChild(Num, &PaddingTransform, [&](int32 Lane) { return Local + BoneIndices[Base + Lane]; });
+		const TLanePointers<FTransform> PtrOut(Num, &Discard, [&](int32 Lane) { return InOutComponent + BoneIndices[Base + Lane]; });
+
+		StoreTransforms(PtrOut, ComposeLanes(LoadTransforms(PtrParent), LoadTransforms(PtrChild)));
+	});
+}
+
+void FTransformBatch::Blend(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count)
+{
+	const FLane AlphaLane = LaneSet1(Alpha);
+	FTransform Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FTransform> PtrA(Num, &PaddingTransform, [&](int32 Lane) { return A + Base + Lane; });
+		const TLanePointers<const FTransform> PtrB(Num, &PaddingTransform, [&](int32 Lane) { return B + Base + Lane; });
+		const TLanePointers<FTransform> PtrOut(Num, &Discard, [&](int32 Lane) { return Out + Base + Lane; });
+
+		const FTransformLanes TA = LoadTransforms(PtrA);
+		const FTransformLanes TB = LoadTransforms(PtrB);
+		FTransformLanes Result;
+		Result.Translation = VectorLerp(TA.Translation, TB.Translation, AlphaLane);
+		Result.Rotation = QuatNlerp(TA.Rotation, TB.Rotation, AlphaLane);
+		Result.Scale = VectorLerp(TA.Scale, TB.Scale, AlphaLane);
+		StoreTransforms(PtrOut, Result);
+	});
+}
+
+void FTransformBatch::AccumulateWeighted(const FTransform* Source, float Weight, FTransform* InOutAccum, int32 Count)
+{
+	const FLane WeightLane = LaneSet1(Weight);
+	const FLane Zero = LaneSet1(0.0f);
+	FTransform Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FTransform> PtrSource(Num, &PaddingTransform, [&](int32 Lane) { return Source + Base + Lane; });
+		const TLanePointers<const FTransform> PtrAccum(Num, &PaddingTransform, [&](int32 Lane) { return InOutAccum + Base + Lane; });
+		const TLanePointers<FTransform> PtrOut(Num, &Discard, [&](int32 Lane) { return InOutAccum + Base + Lane; });
+
+		const FTransformLanes Src = LoadTransforms(PtrSource);
+		FTransformLanes Accum = LoadTransforms(PtrAccum);
+
+		Accum.Translation.X = LaneMulAdd(Src.Translation.X, WeightLane, Accum.Translation.X);
+		Accum.Translation.Y = LaneMulAdd(Src.Translation.Y, WeightLane, Accum.Translation.Y);
+		Accum.Translation.Z = LaneMulAdd(Src.Translation.Z, WeightLane, Accum.Translation.Z);
+		Accum.Scale.X = LaneMulAdd(Src.Scale.X, WeightLane, Accum.Scale.X);
+		Accum.Scale.Y = LaneMulAdd(Src.Scale.Y, WeightLane, Accum.Scale.Y);
+		Accum.Scale.Z = LaneMulAdd(Src.Scale.Z, WeightLane, Accum.Scale.Z);
+
+		// 누적값과 반대 반구인 쿼터니언은 부호를 뒤집어 더한다 (q와 -q는 같은 회전)
+		const FLane SignedWeight = LaneNegateIfLess(WeightLane, QuatDot(Accum.Rotation, Src.Rotation), Zero);
+		Accum.Rotation.X = LaneMulAdd(Src.Rotation.X, SignedWeight, Accum.Rotation.X);
+		Accum.Rotation.Y = LaneMulAdd(Src.Rotation.Y, SignedWeight, Accum.Rotation.Y);
+		Accum.Rotation.Z = LaneMulAdd(Src.Rotation.Z, SignedWeight, Accum.Rotation.Z);
+		Accum.Rotation.W = LaneMulAdd(Src.Rotation.W, SignedWeight, Accum.Rotation.W);
+
+		StoreTransforms(PtrOut, Accum);
+	});
+}
+
+void FTransformBatch::NormalizeRotations(FTransform* InOutTransforms, int32 Count)
+{
+	FQuat Discard;
+	ForEachLaneBlock(Count, [&](int32 Base, int32 Num)
+	{
+		const TLanePointers<const FQuat> PtrIn(Num, &PaddingQuat, [&](int32 Lane) { return &InOutTransforms[Base + Lane].Rotation; });
+		const TLanePointers<FQuat> PtrOut(Num, &Discard, [&](int32 Lane) { return &InOutTransforms[Base + Lane].Rotation; });
+
+		StoreQuats(PtrOut, QuatNormalize(LoadQuats(PtrIn)));
+	});
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Vector.h"
+
+/**
+ * @brief 트랜스폼/쿼터니언/행렬 배열을 한 번에 처리하는 배치 커널 (포즈 블렌딩, 본 계층 합성, 스키닝 행렬용)
+ * 입력은 기존과 같은 AoS 배열(FTransform/FQuat/FMatrix)이고, 내부에서 레인 폭(AVX2 8개, SSE/Scalar 4개)만큼씩
+ * 성분별 SoA 블록으로 모아 레인마다 한 본을 계산한 뒤 다시 흩어 쓴다.
+ * 계산이 가벼워 전치 비용이 더 큰 함수(MultiplyQuats/MultiplyMatrices/ToMatrices)는 원소마다 레지스터 경로로 처리한다.
+ * 결과는 같은 이름의 FTransform/FQuat 메서드와 같은 식이다 (FMA 등으로 마지막 비트 정도만 다를 수 있음).
+ *
+ * 출력 배열은 입력과 겹치지 않아야 한다 (In/Out 접두사가 붙은 인자는 예외).
+ */
+class FTransformBatch
+{
+public:
+	static int32 GetLaneWidth();
+
+	// Out[i] = A[i] * B[i]
+	static void MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count);
+
+	// Out[i] = FQuat::Nlerp(A[i], B[i], Alpha)
+	static void NlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count);
+
+	// Out[i] = A[i] * B[i] (행렬 배열 × 행렬 배열)
+	static void MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count);
+
+	// Out[i] = Transforms[i].ToMatrix()
+	static void ToMatrices(const FTransform* Transforms, FMatrix* Out, int32 Count);
+
+	// Out[i] = Parents[i].GetWorldTransform(Children[i])
+	static void Compose(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count);
+
+	/**
+	 * 본 계층의 한 깊이 단계를 합성: InOutComponent[B] = InOutComponent[ParentIndices[B]].GetWorldTransform(Local[B])
+	 * (B = BoneIndices[0..Count)). 같은 단계의 본끼리는 서로 부모가 아니어야 한다 (FSkeleton::BonesByDepth 참고).
+	 */
+	static void ComposeIndexed(const FTransform* Local, const int32* BoneIndices, const int32* ParentIndices,
+		FTransform* InOutComponent, int32 Count);
+
+	// 위치/스케일은 Lerp, 회전은 Nlerp (FAnimationRuntime::BlendTwoPosesTogether)
+	static void Blend(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count);
+
+	/**
+	 * 가중 누적: InOutAccum[i] += Source[i] * Weight (회전은 누적값과 같은 반구로 맞춰서 더함)
+	 * 누적을 0으로 시작해 포즈마다 호출한 뒤 NormalizeRotations로 마무리한다.
+	 */
+	static void AccumulateWeighted(const FTransform* Source, float Weight, FTransform* InOutAccum, int32 Count);
+	// 회전만 정규화 (길이가 0에 가까우면 단위 쿼터니언)
+	static void NormalizeRotations(FTransform* InOutTransforms, int32 Count);
+};
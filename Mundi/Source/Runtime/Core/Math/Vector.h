@@ -4,6 +4,8 @@
 #include <string>
 #include <limits>
 
+#include "VectorRegister.h"
+
 #include "UEContainer.h"
 #include "Archive.h"
 
@@ -388,26 +390,26 @@ struct alignas(16) FVector4
 {
 	union
 	{
-		__m128 SimdData;
+		VectorRegister4f SimdData;
 		struct { float X, Y, Z, W; };
 	};
 
 	FVector4(float InX = 0.0f, float InY = 0.0f, float InZ = 0.0f, float InW = 0.0f)
 	{
-		SimdData = _mm_set_ps(InW, InZ, InY, InX);
+		SimdData = VectorSet(InX, InY, InZ, InW);
 	}
 
-	FVector4(const __m128& InSimd) : SimdData(InSimd) {}
+	FVector4(const VectorRegister4f& InSimd) : SimdData(InSimd) {}
 
-	FVector4 operator+(const FVector4& V) const { return FVector4(_mm_add_ps(SimdData, V.SimdData)); }
-	FVector4 operator-(const FVector4& V) const { return FVector4(_mm_sub_ps(SimdData, V.SimdData)); }
-	FVector4 operator*(float S) const { return FVector4(_mm_mul_ps(SimdData, _mm_set1_ps(S))); }
-	FVector4 operator/(float S) const { return FVector4(_mm_div_ps(SimdData, _mm_set1_ps(S))); }
+	FVector4 operator+(const FVector4& V) const { return FVector4(VectorAdd(SimdData, V.SimdData)); }
+	FVector4 operator-(const FVector4& V) const { return FVector4(VectorSubtract(SimdData, V.SimdData)); }
+	FVector4 operator*(float S) const { return FVector4(VectorMultiply(SimdData, VectorSetFloat1(S))); }
+	FVector4 operator/(float S) const { return FVector4(VectorDivide(SimdData, VectorSetFloat1(S))); }
 
-	FVector4& operator+=(const FVector4& V) { SimdData = _mm_add_ps(SimdData, V.SimdData); return *this; }
-	FVector4& operator-=(const FVector4& V) { SimdData = _mm_sub_ps(SimdData, V.SimdData); return *this; }
-	FVector4& operator*=(float S) { SimdData = _mm_mul_ps(SimdData, _mm_set1_ps(S)); return *this; }
-	FVector4& operator/=(float S) { SimdData = _mm_div_ps(SimdData, _mm_set1_ps(S)); return *this; }
+	FVector4& operator+=(const FVector4& V) { SimdData = VectorAdd(SimdData, V.SimdData); return *this; }
+	FVector4& operator-=(const FVector4& V) { SimdData = VectorSubtract(SimdData, V.SimdData); return *this; }
+	FVector4& operator*=(float S) { SimdData = VectorMultiply(SimdData, VectorSetFloat1(S)); return *this; }
+	FVector4& operator/=(float S) { SimdData = VectorDivide(SimdData, VectorSetFloat1(S)); return *this; }
 
 	bool operator==(const FVector4& V) const
 	{
@@ -422,11 +424,11 @@ struct alignas(16) FVector4
 
 	FVector4 ComponentMin(const FVector4& B) const
 	{
-		return FVector4(_mm_min_ps(this->SimdData, B.SimdData));
+		return FVector4(VectorMin(this->SimdData, B.SimdData));
 	}
 	FVector4 ComponentMax(const FVector4& B) const
 	{
-		return FVector4(_mm_max_ps(this->SimdData, B.SimdData));
+		return FVector4(VectorMax(this->SimdData, B.SimdData));
 	}
 
 	/** FVector(Point)를 FVector4(Point, W=1)로 변환합니다. */
@@ -479,12 +481,9 @@ struct FQuat
 	// 곱 (회전 누적)
 	FQuat operator*(const FQuat& Q) const
 	{
-		return FQuat(
-			W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y,
-			W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X,
-			W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W,
-			W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z
-		);
+		FQuat Result;
+		VectorStore(VectorQuaternionMultiply(VectorLoad(&X), VectorLoad(&Q.X)), &Result.X);
+		return Result;
 	}
 
 	static float Dot(const FQuat& A, const FQuat& B)
@@ -731,20 +730,20 @@ struct alignas(16) FMatrix
 {
 	union
 	{
-		__m128 Rows[4];
+		VectorRegister4f Rows[4];
 		float M[4][4];
 		FVector4 VRows[4];
 	};
 
 	FMatrix()
 	{
-		Rows[0] = _mm_setzero_ps();
-		Rows[1] = _mm_setzero_ps();
-		Rows[2] = _mm_setzero_ps();
-		Rows[3] = _mm_setzero_ps();
+		Rows[0] = VectorZero();
+		Rows[1] = VectorZero();
+		Rows[2] = VectorZero();
+		Rows[3] = VectorZero();
 	}
 
-	FMatrix(const __m128& R0, const __m128& R1, const __m128& R2, const __m128& R3)
+	FMatrix(const VectorRegister4f& R0, const VectorRegister4f& R1, const VectorRegister4f& R2, const VectorRegister4f& R3)
 	{
 		Rows[0] = R0;
 		Rows[1] = R1;
@@ -757,10 +756,10 @@ struct alignas(16) FMatrix
 		float M20, float M21, float M22, float M23,
 		float M30, float M31, float M32, float M33)
 	{
-		Rows[0] = _mm_set_ps(M03, M02, M01, M00);
-		Rows[1] = _mm_set_ps(M13, M12, M11, M10);
-		Rows[2] = _mm_set_ps(M23, M22, M21, M20);
-		Rows[3] = _mm_set_ps(M33, M32, M31, M30);
+		Rows[0] = VectorSet(M00, M01, M02, M03);
+		Rows[1] = VectorSet(M10, M11, M12, M13);
+		Rows[2] = VectorSet(M20, M21, M22, M23);
+		Rows[3] = VectorSet(M30, M31, M32, M33);
 	}
 
 	static FMatrix Identity()
@@ -803,108 +802,44 @@ struct alignas(16) FMatrix
 	// SIMD-accelerated transpose
 	FMatrix Transpose() const
 	{
-		__m128 temp0 = _mm_shuffle_ps(Rows[0], Rows[1], _MM_SHUFFLE(1, 0, 1, 0));
-		__m128 temp1 = _mm_shuffle_ps(Rows[0], Rows[1], _MM_SHUFFLE(3, 2, 3, 2));
-		__m128 temp2 = _mm_shuffle_ps(Rows[2], Rows[3], _MM_SHUFFLE(1, 0, 1, 0));
-		__m128 temp3 = _mm_shuffle_ps(Rows[2], Rows[3], _MM_SHUFFLE(3, 2, 3, 2));
-
-		FMatrix Result;
-		Result.Rows[0] = _mm_shuffle_ps(temp0, temp2, _MM_SHUFFLE(2, 0, 2, 0));
-		Result.Rows[1] = _mm_shuffle_ps(temp0, temp2, _MM_SHUFFLE(3, 1, 3, 1));
-		Result.Rows[2] = _mm_shuffle_ps(temp1, temp3, _MM_SHUFFLE(2, 0, 2, 0));
-		Result.Rows[3] = _mm_shuffle_ps(temp1, temp3, _MM_SHUFFLE(3, 1, 3, 1));
+		FMatrix Result(Rows[0], Rows[1], Rows[2], Rows[3]);
+		VectorTranspose4x4(Result.Rows[0], Result.Rows[1], Result.Rows[2], Result.Rows[3]);
 		return Result;
 	}
 
-	// Affine 역행렬 (마지막 행 = [0,0,0,1] 가정)
+	// Affine 역행렬 (마지막 열 = [0,0,0,1] 가정). 3x3이 특이하면 단위 행렬
 	FMatrix InverseAffine() const
 	{
-		// 상단 3x3 역행렬
-		float A00 = M[0][0], A01 = M[0][1], A02 = M[0][2];
-		float A10 = M[1][0], A11 = M[1][1], A12 = M[1][2];
-		float A20 = M[2][0], A21 = M[2][1], A22 = M[2][2];
-
-		float Det = A00 * (A11 * A22 - A12 * A21) - A01 * (A10 * A22 - A12 * A20) + A02 * (A10 * A21 - A11 * A20);
-		if (std::fabs(Det) < KINDA_SMALL_NUMBER) return Identity();
-		float InvDet = 1.0f / Det;
-
-		// Rinv = R^{-1}
-		FMatrix InvMat = Identity();
-		InvMat.M[0][0] = (A11 * A22 - A12 * A21) * InvDet;
-		InvMat.M[0][1] = -(A01 * A22 - A02 * A21) * InvDet;
-		InvMat.M[0][2] = (A01 * A12 - A02 * A11) * InvDet;
-
-		InvMat.M[1][0] = -(A10 * A22 - A12 * A20) * InvDet;
-		InvMat.M[1][1] = (A00 * A22 - A02 * A20) * InvDet;
-		InvMat.M[1][2] = -(A00 * A12 - A02 * A10) * InvDet;
-
-		InvMat.M[2][0] = (A10 * A21 - A11 * A20) * InvDet;
-		InvMat.M[2][1] = -(A00 * A21 - A01 * A20) * InvDet;
-		InvMat.M[2][2] = (A00 * A11 - A01 * A10) * InvDet;
-
-		// t: last row
-		const FVector T(M[3][0], M[3][1], M[3][2]);
-
-		// invT = -t * Rinv  (t treated as row-vector)
-		FVector invT(
-			-(T.X * InvMat.M[0][0] + T.Y * InvMat.M[1][0] + T.Z * InvMat.M[2][0]),
-			-(T.X * InvMat.M[0][1] + T.Y * InvMat.M[1][1] + T.Z * InvMat.M[2][1]),
-			-(T.X * InvMat.M[0][2] + T.Y * InvMat.M[1][2] + T.Z * InvMat.M[2][2])
-		);
-
-		FMatrix Out = Identity();
-		// place Rinv in upper-left
-		Out.M[0][0] = InvMat.M[0][0]; Out.M[0][1] = InvMat.M[0][1]; Out.M[0][2] = InvMat.M[0][2];
-		Out.M[1][0] = InvMat.M[1][0]; Out.M[1][1] = InvMat.M[1][1]; Out.M[1][2] = InvMat.M[1][2];
-		Out.M[2][0] = InvMat.M[2][0]; Out.M[2][1] = InvMat.M[2][1]; Out.M[2][2] = InvMat.M[2][2];
-		// translation in last row
-		Out.M[3][0] = invT.X; Out.M[3][1] = invT.Y; Out.M[3][2] = invT.Z; Out.M[3][3] = 1.0f;
+		FMatrix Out;
+		if (!VectorMatrixInverseAffine(Out.Rows, Rows, KINDA_SMALL_NUMBER))
+		{
+			return Identity();
+		}
 		return Out;
 	}
 	// 회전행렬
 	FMatrix InverseAffineFast() const
 	{
-		// 상단 3x3
-		const float A00 = M[0][0], A01 = M[0][1], A02 = M[0][2];
-		const float A10 = M[1][0], A11 = M[1][1], A12 = M[1][2];
-		const float A20 = M[2][0], A21 = M[2][1], A22 = M[2][2];
-
-		// 오르소노멀(순수 회전) 빠른 체크: 행(또는 열) 직교 & 단위길이
-		auto dot = [](float x0, float y0, float z0, float x1, float y1, float z1)
-			{
-				return x0 * x1 + y0 * y1 + z0 * z1;
-			};
-		auto len2 = [&](float x, float y, float z) { return dot(x, y, z, x, y, z); };
-
+		// 오르소노멀(순수 회전) 빠른 체크: 행 직교 & 단위길이
 		const float e = 1e-4f; // 허용 오차
+		auto Dot3 = [](const VectorRegister4f& A, const VectorRegister4f& B) { return VectorGetComponent<0>(VectorDot3(A, B)); };
 		const bool ortho =
-			std::fabs(len2(A00, A01, A02) - 1.f) < e &&
-			std::fabs(len2(A10, A11, A12) - 1.f) < e &&
-			std::fabs(len2(A20, A21, A22) - 1.f) < e &&
-			std::fabs(dot(A00, A01, A02, A10, A11, A12)) < e &&
-			std::fabs(dot(A00, A01, A02, A20, A21, A22)) < e &&
-			std::fabs(dot(A10, A11, A12, A20, A21, A22)) < e;
-
-		FMatrix Out = Identity();
-		const FVector t(M[3][0], M[3][1], M[3][2]);
+			std::fabs(Dot3(Rows[0], Rows[0]) - 1.f) < e &&
+			std::fabs(Dot3(Rows[1], Rows[1]) - 1.f) < e &&
+			std::fabs(Dot3(Rows[2], Rows[2]) - 1.f) < e &&
+			std::fabs(Dot3(Rows[0], Rows[1])) < e &&
+			std::fabs(Dot3(Rows[0], Rows[2])) < e &&
+			std::fabs(Dot3(Rows[1], Rows[2])) < e;
 
 		if (ortho)
 		{
-			// R^T
-			Out.M[0][0] = A00; Out.M[0][1] = A10; Out.M[0][2] = A20;
-			Out.M[1][0] = A01; Out.M[1][1] = A11; Out.M[1][2] = A21;
-			Out.M[2][0] = A02; Out.M[2][1] = A12; Out.M[2][2] = A22;
-
-			// invT = -t * R^T  (행벡터 기준)
-			Out.M[3][0] = -(t.X * Out.M[0][0] + t.Y * Out.M[1][0] + t.Z * Out.M[2][0]);
-			Out.M[3][1] = -(t.X * Out.M[0][1] + t.Y * Out.M[1][1] + t.Z * Out.M[2][1]);
-			Out.M[3][2] = -(t.X * Out.M[0][2] + t.Y * Out.M[1][2] + t.Z * Out.M[2][2]);
-			Out.M[3][3] = 1.f;
+			FMatrix Out;
+			VectorMatrixInverseOrthonormal(Out.Rows, Rows);
 			return Out;
 		}
 
-		// 폴백: 일반 3x3 역행렬 (네가 올린 기존 코드와 동일 로직)
-		return InverseAffine(); // = 너의 일반식 구현 호출
+		// 폴백: 일반 3x3 역행렬
+		return InverseAffine();
 	}
 
 	static FMatrix FromTRS(const FVector& T, const FQuat& R, const FVector& S)
@@ -922,107 +857,14 @@ struct alignas(16) FMatrix
 		return rot;
 	}
 
+	// 일반 4x4 역행렬 (2x2 블록 분할). 특이 행렬이면 단위 행렬
 	FMatrix Inverse() const
 	{
 		FMatrix InverseMatrix;
-		// 원본 행렬(VP_Matrix)의 요소를 로컬 변수로 복사
-		float m00 = this->M[0][0], m01 = this->M[0][1], m02 = this->M[0][2], m03 = this->M[0][3];
-		float m10 = this->M[1][0], m11 = this->M[1][1], m12 = this->M[1][2], m13 = this->M[1][3];
-		float m20 = this->M[2][0], m21 = this->M[2][1], m22 = this->M[2][2], m23 = this->M[2][3];
-		float m30 = this->M[3][0], m31 = this->M[3][1], m32 = this->M[3][2], m33 = this->M[3][3];
-
-		// --- 수반 행렬(Adjugate Matrix)의 첫 번째 행 계산 ---
-		FMatrix Adj;
-
-		// 2x2 부분 행렬식(sub-determinant) 계산
-		float t0 = m22 * m33 - m23 * m32;
-		float t1 = m21 * m33 - m23 * m31;
-		float t2 = m21 * m32 - m22 * m31;
-		float t3 = m20 * m33 - m23 * m30;
-		float t4 = m20 * m32 - m22 * m30;
-		float t5 = m20 * m31 - m21 * m30;
-
-		Adj.M[0][0] = (m11 * t0 - m12 * t1 + m13 * t2);
-		Adj.M[0][1] = -(m10 * t0 - m12 * t3 + m13 * t4);
-		Adj.M[0][2] = (m10 * t1 - m11 * t3 + m13 * t5);
-		Adj.M[0][3] = -(m10 * t2 - m11 * t4 + m12 * t5);
-
-		// --- 행렬식(Determinant) 계산 ---
-		float Det = m00 * Adj.M[0][0] + m01 * Adj.M[0][1] + m02 * Adj.M[0][2] + m03 * Adj.M[0][3];
-
-		// 행렬식이 0에 가까우면 (특이 행렬), 역행렬이 존재하지 않음
-		if (std::fabs(Det) < KINDA_SMALL_NUMBER)
+		if (!VectorMatrixInverse(InverseMatrix.Rows, Rows, KINDA_SMALL_NUMBER))
 		{
-			return Identity(); // 단위 행렬 할당
+			return Identity();
 		}
-		else
-		{
-			// 행렬식의 역수 (1.0f / Det)
-			float InvDet = 1.0f / Det;
-
-			// --- 수반 행렬의 나머지 3개 행 계산 ---
-
-			// 2x2 부분 행렬식 (Row 1)
-			float t6 = m02 * m33 - m03 * m32;
-			float t7 = m01 * m33 - m03 * m31;
-			float t8 = m01 * m32 - m02 * m31;
-			float t9 = m00 * m33 - m03 * m30;
-			float t10 = m00 * m32 - m02 * m30;
-			float t11 = m00 * m31 - m01 * m30;
-
-			Adj.M[1][0] = -(m01 * t0 - m02 * t1 + m03 * t2); // C[0][1]
-			Adj.M[1][1] = (m00 * t0 - m02 * t3 + m03 * t4); // C[1][1]
-			Adj.M[1][2] = -(m00 * t1 - m01 * t3 + m03 * t5); // C[2][1]
-			Adj.M[1][3] = (m00 * t2 - m01 * t4 + m02 * t5); // C[3][1]
-
-			// 2x2 부분 행렬식 (Row 2)
-			float t12 = m02 * m13 - m03 * m12;
-			float t13 = m01 * m13 - m03 * m11;
-			float t14 = m01 * m12 - m02 * m11;
-			float t15 = m00 * m13 - m03 * m10;
-			float t16 = m00 * m12 - m02 * m10;
-			float t17 = m00 * m11 - m01 * m10;
-
-			Adj.M[2][0] = (m31 * t12 - m32 * t13 + m33 * t14); // C[0][2]
-			Adj.M[2][1] = -(m30 * t12 - m32 * t15 + m33 * t16); // C[1][2]
-			Adj.M[2][2] = (m30 * t13 - m31 * t15 + m33 * t17); // C[2][2]
-			Adj.M[2][3] = -(m30 * t14 - m31 * t16 + m32 * t17); // C[3][2]
-
-			// 2x2 부분 행렬식 (Row 3)
-			float t18 = m02 * m23 - m03 * m22;
-			float t19 = m01 * m23 - m03 * m21;
-			float t20 = m01 * m22 - m02 * m21;
-			float t21 = m00 * m23 - m03 * m20;
-			float t22 = m00 * m22 - m02 * m20;
-			float t23 = m00 * m21 - m01 * m20;
-
-			Adj.M[3][0] = -(m21 * t12 - m22 * t13 + m23 * t14); // C[0][3]
-			Adj.M[3][1] = (m20 * t12 - m22 * t15 + m23 * t16); // C[1][3]
-			Adj.M[3][2] = -(m20 * t13 - m21 * t15 + m23 * t17); // C[2][3]
-			Adj.M[3][3] = (m20 * t14 - m21 * t16 + m22 * t17); // C[3][3]
-
-			// --- 최종 역행렬 계산 ---
-			InverseMatrix.M[0][0] = Adj.M[0][0] * InvDet;
-			InverseMatrix.M[0][1] = Adj.M[1][0] * InvDet; // [0][1] <- [1][0]
-			InverseMatrix.M[0][2] = Adj.M[2][0] * InvDet; // [0][2] <- [2][0]
-			InverseMatrix.M[0][3] = Adj.M[3][0] * InvDet; // [0][3] <- [3][0]
-
-			InverseMatrix.M[1][0] = Adj.M[0][1] * InvDet; // [1][0] <- [0][1]
-			InverseMatrix.M[1][1] = Adj.M[1][1] * InvDet;
-			InverseMatrix.M[1][2] = Adj.M[2][1] * InvDet; // [1][2] <- [2][1]
-			InverseMatrix.M[1][3] = Adj.M[3][1] * InvDet; // [1][3] <- [3][1]
-
-			InverseMatrix.M[2][0] = Adj.M[0][2] * InvDet; // [2][0] <- [0][2]
-			InverseMatrix.M[2][1] = Adj.M[1][2] * InvDet; // [2][1] <- [1][2]
-			InverseMatrix.M[2][2] = Adj.M[2][2] * InvDet;
-			InverseMatrix.M[2][3] = Adj.M[3][2] * InvDet; // [2][3] <- [3][2]
-
-			InverseMatrix.M[3][0] = Adj.M[0][3] * InvDet; // [3][0] <- [0][3]
-			InverseMatrix.M[3][1] = Adj.M[1][3] * InvDet; // [3][1] <- [1][3]
-			InverseMatrix.M[3][2] = Adj.M[2][3] * InvDet; // [3][2] <- [2][3]
-			InverseMatrix.M[3][3] = Adj.M[3][3] * InvDet;
-		}
-
 		return InverseMatrix;
 	}
 
@@ -1067,15 +909,15 @@ struct alignas(16) FMatrix
 		float B = (-Zn * Zf) / (Zf - Zn);
 
 		FMatrix invProj{};
-		/*invProj.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f / XScale);
-		invProj.Rows[1] = _mm_set_ps(0.0f, 0.0f, 1.0f / YScale, 0.0f);
-		invProj.Rows[2] = _mm_set_ps(0.0f, 0.0f, 0.0f, 0.0f);
-		invProj.Rows[3] = _mm_set_ps(1.0f / B, 1.0f, 0.0f, -A / B);*/
+		/*invProj.Rows[0] = VectorSet(1.0f / XScale, 0.0f, 0.0f, 0.0f);
+		invProj.Rows[1] = VectorSet(0.0f, 1.0f / YScale, 0.0f, 0.0f);
+		invProj.Rows[2] = VectorSet(0.0f, 0.0f, 0.0f, 0.0f);
+		invProj.Rows[3] = VectorSet(-A / B, 0.0f, 1.0f, 1.0f / B);*/
 
-		invProj.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f / XScale);
-		invProj.Rows[1] = _mm_set_ps(0.0f, 0.0f, 1.0f / YScale, 0.0f);
-		invProj.Rows[2] = _mm_set_ps(1.0f / B, 0.0f, 0.0f, 0.0f);
-		invProj.Rows[3] = _mm_set_ps(-A / B, 1.0f, 0.0f, 0.0f);
+		invProj.Rows[0] = VectorSet(1.0f / XScale, 0.0f, 0.0f, 0.0f);
+		invProj.Rows[1] = VectorSet(0.0f, 1.0f / YScale, 0.0f, 0.0f);
+		invProj.Rows[2] = VectorSet(0.0f, 0.0f, 0.0f, 1.0f / B);
+		invProj.Rows[3] = VectorSet(0.0f, 0.0f, 1.0f, -A / B);
 
 		return invProj;
 	}
@@ -1103,10 +945,10 @@ struct alignas(16) FMatrix
 		}
 
 		FMatrix invProj{};
-		invProj.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f / XScale);
-		invProj.Rows[1] = _mm_set_ps(0.0f, 0.0f, 1.0f / YScale, 0.0f);
-		invProj.Rows[2] = _mm_set_ps(1.0f/B, 0.0f, 0.0f, 0.0f);
-		invProj.Rows[3] = _mm_set_ps(-A / B, 1.0f, 0.0f, 0.0f);
+		invProj.Rows[0] = VectorSet(1.0f / XScale, 0.0f, 0.0f, 0.0f);
+		invProj.Rows[1] = VectorSet(0.0f, 1.0f / YScale, 0.0f, 0.0f);
+		invProj.Rows[2] = VectorSet(0.0f, 0.0f, 0.0f, 1.0f/B);
+		invProj.Rows[3] = VectorSet(0.0f, 0.0f, 1.0f, -A / B);
 
 		return invProj;
 	}
@@ -1129,10 +971,10 @@ struct alignas(16) FMatrix
 		float Zn = -M[3][2] * DZ;
 
 		FMatrix inv{};
-		inv.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, W * 0.5f);
-		inv.Rows[1] = _mm_set_ps(0.0f, 0.0f, H * 0.5f, 0.0f);
-		inv.Rows[2] = _mm_set_ps(0.0f, DZ, 0.0f, 0.0f);
-		inv.Rows[3] = _mm_set_ps(1.0f, Zn, 0.0f, 0.0f);
+		inv.Rows[0] = VectorSet(W * 0.5f, 0.0f, 0.0f, 0.0f);
+		inv.Rows[1] = VectorSet(0.0f, H * 0.5f, 0.0f, 0.0f);
+		inv.Rows[2] = VectorSet(0.0f, 0.0f, DZ, 0.0f);
+		inv.Rows[3] = VectorSet(0.0f, 0.0f, Zn, 1.0f);
 		return inv;
 	}
 
@@ -1168,19 +1010,8 @@ struct alignas(16) FMatrix
 // FVector4 * FMatrix (row-vector: v' = v * M)
 inline FVector4 operator*(const FVector4& V, const FMatrix& M)
 {
-	// Splat V components into separate registers
-	__m128 vX = _mm_shuffle_ps(V.SimdData, V.SimdData, _MM_SHUFFLE(0, 0, 0, 0));
-	__m128 vY = _mm_shuffle_ps(V.SimdData, V.SimdData, _MM_SHUFFLE(1, 1, 1, 1));
-	__m128 vZ = _mm_shuffle_ps(V.SimdData, V.SimdData, _MM_SHUFFLE(2, 2, 2, 2));
-	__m128 vW = _mm_shuffle_ps(V.SimdData, V.SimdData, _MM_SHUFFLE(3, 3, 3, 3));
-
-	// Multiply each component with the corresponding matrix row
-	__m128 result = _mm_mul_ps(vX, M.Rows[0]);
-	result = _mm_add_ps(result, _mm_mul_ps(vY, M.Rows[1]));
-	result = _mm_add_ps(result, _mm_mul_ps(vZ, M.Rows[2]));
-	result = _mm_add_ps(result, _mm_mul_ps(vW, M.Rows[3]));
-
-	return FVector4(result);
+	// V의 각 성분을 복제해 대응하는 행에 곱하고 누적
+	return FVector4(VectorTransformVector(V.SimdData, M.Rows));
 }
 
 // P를 점으로 계산
@@ -1212,35 +1043,11 @@ inline FVector operator*(const FVector& P, const FMatrix& M)
 	return FVector(Result4D.X, Result4D.Y, Result4D.Z);
 }
 
-// SIMD-accelerated matrix multiplication
+// SIMD-accelerated matrix multiplication (AVX2 빌드에서는 두 행씩)
 inline FMatrix operator*(const FMatrix& A, const FMatrix& B)
 {
 	FMatrix Result;
-	//const FMatrix& A = *this;
-
-	// Transpose B to make columns into rows for easier processing
-	//FMatrix B_T = B.Transpose();
-
-	//for (int i = 0; i < 4; ++i)
-	//{
-	//    __m128 row = A.Rows[i];
-	//    __m128 r0 = _mm_mul_ps(row, B_T.Rows[0]);
-	//    __m128 r1 = _mm_mul_ps(row, B_T.Rows[1]);
-	//    __m128 r2 = _mm_mul_ps(row, B_T.Rows[2]);
-	//    __m128 r3 = _mm_mul_ps(row, B_T.Rows[3]);
-
-	//    // Sum horizontally
-	//    // r0 = (r0.x + r0.y + r0.z + r0.w, ...)
-	//    __m128 sum_01 = _mm_hadd_ps(r0, r1);
-	//    __m128 sum_23 = _mm_hadd_ps(r2, r3);
-	//    Result.Rows[i] = _mm_hadd_ps(sum_01, sum_23);
-	//}
-
-	Result.VRows[0] = A.VRows[0] * B;
-	Result.VRows[1] = A.VRows[1] * B;
-	Result.VRows[2] = A.VRows[2] * B;
-	Result.VRows[3] = A.VRows[3] * B;
-
+	VectorMatrixMultiply(Result.Rows, A.Rows, B.Rows);
 	return Result;
 }
 
@@ -1264,27 +1071,24 @@ struct FTransform
 	{
 		FTransform Result;
 
+		const VectorRegister4f ParentRotation = VectorLoad(&Rotation.X);
+		const VectorRegister4f ParentScale = VectorLoadFloat3(&Scale3D.X);
+
 		// 회전 결합
 		// Child 회전 후 부모 회전해야 로컬회전하므로 자식 먼저 곱해져야함
-		Result.Rotation = Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
+		const VectorRegister4f Rotated = VectorQuaternionMultiply(ParentRotation, VectorLoad(&ChildTransform.Rotation.X));
+		VectorStore(VectorNormalizeSafe4(Rotated, VectorSet(0.0f, 0.0f, 0.0f, 1.0f), KINDA_SMALL_NUMBER), &Result.Rotation.X);
 
 		// 스케일 결합 (component-wise)
-		Result.Scale3D = FVector(
-			Scale3D.X * ChildTransform.Scale3D.X,
-			Scale3D.Y * ChildTransform.Scale3D.Y,
-			Scale3D.Z * ChildTransform.Scale3D.Z
-		);
+		VectorStoreFloat3(VectorMultiply(ParentScale, VectorLoadFloat3(&ChildTransform.Scale3D.X)), &Result.Scale3D.X);
 
 		//
 		// 부모 로컬 To World -> SRT, 자식 로컬 To 부모 -> Other.SRT
 		// 자식 로컬 To World -> Other.SRT * SRT
 		// 자식 로컬 To World Translation -> Other.T * SRT = Translation(Rotation(Scale(Other.T)))
-		FVector Scaled(ChildTransform.Translation.X * Scale3D.X,
-			ChildTransform.Translation.Y * Scale3D.Y,
-			ChildTransform.Translation.Z * Scale3D.Z);
-		FVector Rotated = Rotation.RotateVector(Scaled);
-		Result.Translation = Translation + Rotated;
+		const VectorRegister4f Scaled = VectorMultiply(VectorLoadFloat3(&ChildTransform.Translation.X), ParentScale);
+		const VectorRegister4f Translated = VectorAdd(VectorLoadFloat3(&Translation.X), VectorQuaternionRotateVector(ParentRotation, Scaled));
+		VectorStoreFloat3(Translated, &Result.Translation.X);
 
 		return Result;
 	}
@@ -1365,17 +1169,9 @@ inline FVector FQuat::RotateVector(const FVector& V) const
 	float n = X * X + Y * Y + Z * Z + W * W;
 	if (n <= KINDA_SMALL_NUMBER) return V;
 
-	const FVector U(X, Y, Z);
-	const FVector T(
-		2.0f * (U.Y * V.Z - U.Z * V.Y),
-		2.0f * (U.Z * V.X - U.X * V.Z),
-		2.0f * (U.X * V.Y - U.Y * V.X)
-	);
-	return FVector(
-		V.X + W * T.X + (U.Y * T.Z - U.Z * T.Y),
-		V.Y + W * T.Y + (U.Z * T.X - U.X * T.Z),
-		V.Z + W * T.Z + (U.X * T.Y - U.Y * T.X)
-	);
+	FVector Result;
+	VectorStoreFloat3(VectorQuaternionRotateVector(VectorLoad(&X), VectorLoadFloat3(&V.X)), &Result.X);
+	return Result;
 }
 
 // FQuat → Matrix
@@ -1403,10 +1199,10 @@ inline FMatrix FMatrix::LookAtLH(const FVector& Eye, const FVector& At, const FV
 
 	// Row-major + 행벡터: 뷰 행렬의 회전 부분은 카메라 기저의 전치
 	FMatrix View;
-	View.Rows[0] = _mm_set_ps(0.0f, UpV.X, RightV.X, ForwardV.X);
-	View.Rows[1] = _mm_set_ps(0.0f, UpV.Y, RightV.Y, ForwardV.Y);
-	View.Rows[2] = _mm_set_ps(0.0f, UpV.Z, RightV.Z, ForwardV.Z);
-	View.Rows[3] = _mm_set_ps(1.0f, -FVector::Dot(Eye, UpV), -FVector::Dot(Eye, RightV), -FVector::Dot(Eye, ForwardV));
+	View.Rows[0] = VectorSet(ForwardV.X, RightV.X, UpV.X, 0.0f);
+	View.Rows[1] = VectorSet(ForwardV.Y, RightV.Y, UpV.Y, 0.0f);
+	View.Rows[2] = VectorSet(ForwardV.Z, RightV.Z, UpV.Z, 0.0f);
+	View.Rows[3] = VectorSet(-FVector::Dot(Eye, ForwardV), -FVector::Dot(Eye, RightV), -FVector::Dot(Eye, UpV), 1.0f);
 
 	// 엔진(X=forward, Y=right, Z=up) → 쉐이더(X=right, Y=up, Z=forward)
 	static const FMatrix ToShaderCoords(
@@ -1425,10 +1221,10 @@ inline FMatrix FMatrix::PerspectiveFovLH(float FovY, float Aspect, float Zn, flo
 	float XScale = YScale / Aspect;
 
 	FMatrix proj{};
-	proj.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, XScale);
-	proj.Rows[1] = _mm_set_ps(0.0f, 0.0f, YScale, 0.0f);
-	proj.Rows[2] = _mm_set_ps(1.0f, Zf / (Zf - Zn), 0.0f, 0.0f); // ?? 왜 마지막에 1.0f ??
-	proj.Rows[3] = _mm_set_ps(0.0f, (-Zn * Zf) / (Zf - Zn), 0.0f, 0.0f);
+	proj.Rows[0] = VectorSet(XScale, 0.0f, 0.0f, 0.0f);
+	proj.Rows[1] = VectorSet(0.0f, YScale, 0.0f, 0.0f);
+	proj.Rows[2] = VectorSet(0.0f, 0.0f, Zf / (Zf - Zn), 1.0f); // ?? 왜 마지막에 1.0f ??
+	proj.Rows[3] = VectorSet(0.0f, 0.0f, (-Zn * Zf) / (Zf - Zn), 0.0f);
 	return proj;
 }
 
@@ -1439,10 +1235,10 @@ inline FMatrix FMatrix::OrthoLH(float Width, float Height, float Zn, float Zf)
 	const float DZ = (Zf - Zn != 0.0f) ? (Zf - Zn) : 1e-6f;
 
 	FMatrix m = FMatrix::Identity();
-	m.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, 2.0f / W);
-	m.Rows[1] = _mm_set_ps(0.0f, 0.0f, 2.0f / H, 0.0f);
-	m.Rows[2] = _mm_set_ps(0.0f, 1.0f / DZ, 0.0f, 0.0f);
-	m.Rows[3] = _mm_set_ps(1.0f, -Zn / DZ, 0.0f, 0.0f);
+	m.Rows[0] = VectorSet(2.0f / W, 0.0f, 0.0f, 0.0f);
+	m.Rows[1] = VectorSet(0.0f, 2.0f / H, 0.0f, 0.0f);
+	m.Rows[2] = VectorSet(0.0f, 0.0f, 1.0f / DZ, 0.0f);
+	m.Rows[3] = VectorSet(0.0f, 0.0f, -Zn / DZ, 1.0f);
 	return m;
 }
 
@@ -1454,10 +1250,10 @@ inline FMatrix FMatrix::OrthoLH_XForward(float Width, float Height, float Xn, fl
 
 	FMatrix m = FMatrix::Identity();
 
-	m.Rows[0] = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f / DX);
-	m.Rows[1] = _mm_set_ps(0.0f, 0.0f, 2.0f / W, 0.0f);
-	m.Rows[2] = _mm_set_ps(0.0f, 2.0f / H, 0.0f, 0.0f);
-	m.Rows[3] = _mm_set_ps(1.0f, 0.0f, 0.0f, -Xn / DX);
+	m.Rows[0] = VectorSet(1.0f / DX, 0.0f, 0.0f, 0.0f);
+	m.Rows[1] = VectorSet(0.0f, 2.0f / W, 0.0f, 0.0f);
+	m.Rows[2] = VectorSet(0.0f, 0.0f, 2.0f / H, 0.0f);
+	m.Rows[3] = VectorSet(-Xn / DX, 0.0f, 0.0f, 1.0f);
 	return m;
 }
 
@@ -1491,12 +1287,12 @@ inline FMatrix FTransform::ToMatrix() const
 	FMatrix R = Rotation.ToMatrix();
 
 	// Scale the rotation part using SIMD
-	R.Rows[0] = _mm_mul_ps(R.Rows[0], _mm_set1_ps(Scale3D.X));
-	R.Rows[1] = _mm_mul_ps(R.Rows[1], _mm_set1_ps(Scale3D.Y));
-	R.Rows[2] = _mm_mul_ps(R.Rows[2], _mm_set1_ps(Scale3D.Z));
+	R.Rows[0] = VectorMultiply(R.Rows[0], VectorSetFloat1(Scale3D.X));
+	R.Rows[1] = VectorMultiply(R.Rows[1], VectorSetFloat1(Scale3D.Y));
+	R.Rows[2] = VectorMultiply(R.Rows[2], VectorSetFloat1(Scale3D.Z));
 
 	// Set the translation part using SIMD
-	R.Rows[3] = _mm_set_ps(1.0f, Translation.Z, Translation.Y, Translation.X);
+	R.Rows[3] = VectorSet(Translation.X, Translation.Y, Translation.Z, 1.0f);
 
 	// The multiplication will use the SIMD-optimized operator*
 	return R;
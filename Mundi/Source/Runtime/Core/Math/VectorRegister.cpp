@@ -0,0 +1,56 @@
+#include "pch.h"
+#include "VectorRegister.h"
+
+#if defined(MUNDI_SIMD_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+const char* VectorGetBackendName()
+{
+#if defined(MUNDI_SIMD_AVX2)
+	return "AVX2";
+#elif defined(MUNDI_SIMD_SSE)
+	return "SSE";
+#else
+	return "Scalar";
+#endif
+}
+
+bool VectorIsBackendSupported()
+{
+#if defined(MUNDI_SIMD_AVX2)
+#if defined(_MSC_VER)
+	int32 Info[4];
+	__cpuid(Info, 0);
+	if (Info[0] < 7)
+	{
+		return false;
+	}
+
+	// CPUID.1:ECX - FMA(12), OSXSAVE(27), AVX(28)
+	__cpuid(Info, 1);
+	const bool bFMA = (Info[2] & (1 << 12)) != 0;
+	const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+	const bool bAVX = (Info[2] & (1 << 28)) != 0;
+	if (!bFMA || !bOSXSave || !bAVX)
+	{
+		return false;
+	}
+
+	// OS가 YMM 레지스터 상태를 저장해 주는지
+	if ((_xgetbv(0) & 0x6) != 0x6)
+	{
+		return false;
+	}
+
+	// CPUID.7.0:EBX - AVX2(5)
+	__cpuidex(Info, 7, 0);
+	return (Info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#else
+	// SSE2는 x64의 기본 사양, Scalar는 조건 없음
+	return true;
+#endif
+}
@@ -0,0 +1,437 @@
+#pragma once
+#include <cmath>
+
+/**
+ * @brief 4-float 벡터 레지스터 추상화 (FVector4/FMatrix/FQuat의 SIMD 경로가 이 위에서 동작)
+ * 백엔드는 컴파일 시점에 하나가 고정된다.
+ * - AVX2 : __AVX2__ (MSVC /arch:AVX2, GCC/Clang -mavx2). SSE 경로 + FMA, 행렬 곱은 두 행씩 256비트로 처리
+ * - SSE  : x64 기본 (SSE2만 사용)
+ * - Scalar : 그 외 플랫폼, 또는 MUNDI_SIMD_FORCE_SCALAR 정의 시 (결과 비교/디버깅용)
+ *
+ * 레지스터 안의 성분 순서는 항상 메모리 순서(X, Y, Z, W)다.
+ * VectorSet은 _mm_set_ps와 달리 X부터 받는다.
+ */
+#if defined(MUNDI_SIMD_FORCE_SCALAR)
+	#define MUNDI_SIMD_SCALAR 1
+#elif defined(__AVX2__)
+	#define MUNDI_SIMD_AVX2 1
+	#define MUNDI_SIMD_SSE 1
+#elif defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+	#define MUNDI_SIMD_SSE 1
+#else
+	#define MUNDI_SIMD_SCALAR 1
+#endif
+
+#if defined(MUNDI_SIMD_SSE)
+	#include <immintrin.h>
+#endif
+
+#if defined(MUNDI_SIMD_SSE)
+
+typedef __m128 VectorRegister4f;
+
+#define MUNDI_SHUFFLE_MASK(A0, A1, B2, B3) ((A0) | ((A1) << 2) | ((B2) << 4) | ((B3) << 6))
+
+inline VectorRegister4f VectorZero() { return _mm_setzero_ps(); }
+inline VectorRegister4f VectorSet(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+inline VectorRegister4f VectorSetFloat1(float F) { return _mm_set1_ps(F); }
+
+// Ptr은 16B 정렬이어야 한다
+inline VectorRegister4f VectorLoadAligned(const float* Ptr) { return _mm_load_ps(Ptr); }
+inline VectorRegister4f VectorLoad(const float* Ptr) { return _mm_loadu_ps(Ptr); }
+// (X, Y, Z, 0). 4번째 float 너머를 읽지 않는다
+inline VectorRegister4f VectorLoadFloat3(const float* Ptr) { return _mm_setr_ps(Ptr[0], Ptr[1], Ptr[2], 0.0f); }
+
+inline void VectorStoreAligned(const VectorRegister4f& V, float* Ptr) { _mm_store_ps(Ptr, V); }
+inline void VectorStore(const VectorRegister4f& V, float* Ptr) { _mm_storeu_ps(Ptr, V); }
+inline void VectorStoreFloat3(const VectorRegister4f& V, float* Ptr)
+{
+	alignas(16) float Temp[4];
+	_mm_store_ps(Temp, V);
+	Ptr[0] = Temp[0];
+	Ptr[1] = Temp[1];
+	Ptr[2] = Temp[2];
+}
+
+template<int Index>
+inline float VectorGetComponent(const VectorRegister4f& V)
+{
+	return _mm_cvtss_f32(_mm_shuffle_ps(V, V, MUNDI_SHUFFLE_MASK(Index, Index, Index, Index)));
+}
+
+inline VectorRegister4f VectorAdd(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_add_ps(A, B); }
+inline VectorRegister4f VectorSubtract(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_sub_ps(A, B); }
+inline VectorRegister4f VectorMultiply(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_mul_ps(A, B); }
+inline VectorRegister4f VectorDivide(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_div_ps(A, B); }
+inline VectorRegister4f VectorMin(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_min_ps(A, B); }
+inline VectorRegister4f VectorMax(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_max_ps(A, B); }
+inline VectorRegister4f VectorSqrt(const VectorRegister4f& V) { return _mm_sqrt_ps(V); }
+inline VectorRegister4f VectorAbs(const VectorRegister4f& V) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), V); }
+inline VectorRegister4f VectorNegate(const VectorRegister4f& V) { return _mm_xor_ps(_mm_set1_ps(-0.0f), V); }
+
+// A * B + C
+inline VectorRegister4f VectorMultiplyAdd(const VectorRegister4f& A, const VectorRegister4f& B, const VectorRegister4f& C)
+{
+#if defined(MUNDI_SIMD_AVX2)
+	return _mm_fmadd_ps(A, B, C);
+#else
+	return _mm_add_ps(_mm_mul_ps(A, B), C);
+#endif
+}
+
+// C - A * B
+inline VectorRegister4f VectorNegateMultiplyAdd(const VectorRegister4f& A, const VectorRegister4f& B, const VectorRegister4f& C)
+{
+#if defined(MUNDI_SIMD_AVX2)
+	return _mm_fnmadd_ps(A, B, C);
+#else
+	return _mm_sub_ps(C, _mm_mul_ps(A, B));
+#endif
+}
+
+// (V[X], V[Y], V[Z], V[W])
+template<int X, int Y, int Z, int W>
+inline VectorRegister4f VectorSwizzle(const VectorRegister4f& V)
+{
+	return _mm_shuffle_ps(V, V, MUNDI_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+// (A[X], A[Y], B[Z], B[W])
+template<int X, int Y, int Z, int W>
+inline VectorRegister4f VectorShuffle(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	return _mm_shuffle_ps(A, B, MUNDI_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+// A[i] <= B[i]인 성분의 비트 i가 켜진 4비트 마스크 (NaN은 거짓)
+inline int VectorMaskLessEqual(const VectorRegister4f& A, const VectorRegister4f& B) { return _mm_movemask_ps(_mm_cmple_ps(A, B)); }
+
+#else // MUNDI_SIMD_SCALAR
+
+struct alignas(16) VectorRegister4f
+{
+	float V[4];
+};
+
+inline VectorRegister4f VectorZero() { return VectorRegister4f{ { 0.0f, 0.0f, 0.0f, 0.0f } }; }
+inline VectorRegister4f VectorSet(float X, float Y, float Z, float W) { return VectorRegister4f{ { X, Y, Z, W } }; }
+inline VectorRegister4f VectorSetFloat1(float F) { return VectorRegister4f{ { F, F, F, F } }; }
+
+inline VectorRegister4f VectorLoadAligned(const float* Ptr) { return VectorRegister4f{ { Ptr[0], Ptr[1], Ptr[2], Ptr[3] } }; }
+inline VectorRegister4f VectorLoad(const float* Ptr) { return VectorRegister4f{ { Ptr[0], Ptr[1], Ptr[2], Ptr[3] } }; }
+inline VectorRegister4f VectorLoadFloat3(const float* Ptr) { return VectorRegister4f{ { Ptr[0], Ptr[1], Ptr[2], 0.0f } }; }
+
+inline void VectorStoreAligned(const VectorRegister4f& V, float* Ptr) { Ptr[0] = V.V[0]; Ptr[1] = V.V[1]; Ptr[2] = V.V[2]; Ptr[3] = V.V[3]; }
+inline void VectorStore(const VectorRegister4f& V, float* Ptr) { VectorStoreAligned(V, Ptr); }
+inline void VectorStoreFloat3(const VectorRegister4f& V, float* Ptr) { Ptr[0] = V.V[0]; Ptr[1] = V.V[1]; Ptr[2] = V.V[2]; }
+
+template<int Index>
+inline float VectorGetComponent(const VectorRegister4f& V) { return V.V[Index]; }
+
+#define MUNDI_SCALAR_VECTOR_OP(Name, Expr) \
+	inline VectorRegister4f Name(const VectorRegister4f& A, const VectorRegister4f& B) \
+	{ \
+		VectorRegister4f R; \
+		for (int i = 0; i < 4; ++i) { const float a = A.V[i]; const float b = B.V[i]; R.V[i] = (Expr); } \
+		return R; \
+	}
+
+MUNDI_SCALAR_VECTOR_OP(VectorAdd, a + b)
+MUNDI_SCALAR_VECTOR_OP(VectorSubtract, a - b)
+MUNDI_SCALAR_VECTOR_OP(VectorMultiply, a * b)
+MUNDI_SCALAR_VECTOR_OP(VectorDivide, a / b)
+MUNDI_SCALAR_VECTOR_OP(VectorMin, a < b ? a : b)
+MUNDI_SCALAR_VECTOR_OP(VectorMax, a > b ? a : b)
+
+#undef MUNDI_SCALAR_VECTOR_OP
+
+inline VectorRegister4f VectorSqrt(const VectorRegister4f& V) { return VectorRegister4f{ { std::sqrt(V.V[0]), std::sqrt(V.V[1]), std::sqrt(V.V[2]), std::sqrt(V.V[3]) } }; }
+inline VectorRegister4f VectorAbs(const VectorRegister4f& V) { return VectorRegister4f{ { std::fabs(V.V[0]), std::fabs(V.V[1]), std::fabs(V.V[2]), std::fabs(V.V[3]) } }; }
+inline VectorRegister4f VectorNegate(const VectorRegister4f& V) { return VectorRegister4f{ { -V.V[0], -V.V[1], -V.V[2], -V.V[3] } }; }
+
+inline VectorRegister4f VectorMultiplyAdd(const VectorRegister4f& A, const VectorRegister4f& B, const VectorRegister4f& C)
+{
+	return VectorAdd(VectorMultiply(A, B), C);
+}
+
+inline VectorRegister4f VectorNegateMultiplyAdd(const VectorRegister4f& A, const VectorRegister4f& B, const VectorRegister4f& C)
+{
+	return VectorSubtract(C, VectorMultiply(A, B));
+}
+
+template<int X, int Y, int Z, int W>
+inline VectorRegister4f VectorSwizzle(const VectorRegister4f& V)
+{
+	return VectorRegister4f{ { V.V[X], V.V[Y], V.V[Z], V.V[W] } };
+}
+
+template<int X, int Y, int Z, int W>
+inline VectorRegister4f VectorShuffle(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	return VectorRegister4f{ { A.V[X], A.V[Y], B.V[Z], B.V[W] } };
+}
+
+inline int VectorMaskLessEqual(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	int Mask = 0;
+	for (int i = 0; i < 4; ++i) { Mask |= (A.V[i] <= B.V[i]) ? (1 << i) : 0; }
+	return Mask;
+}
+
+#endif
+
+// ─────────────────────────────
+// 백엔드 공통 (위 연산만으로 구성)
+// ─────────────────────────────
+
+template<int Index>
+inline VectorRegister4f VectorReplicate(const VectorRegister4f& V) { return VectorSwizzle<Index, Index, Index, Index>(V); }
+
+// 결과는 모든 성분에 복제된다
+inline VectorRegister4f VectorDot4(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	const VectorRegister4f Mul = VectorMultiply(A, B);
+	const VectorRegister4f Sum = VectorAdd(Mul, VectorSwizzle<1, 0, 3, 2>(Mul));    // (x+y, x+y, z+w, z+w)
+	return VectorAdd(Sum, VectorSwizzle<2, 2, 0, 0>(Sum));
+}
+
+inline VectorRegister4f VectorDot3(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	const VectorRegister4f Mul = VectorMultiply(A, B);
+	return VectorAdd(VectorAdd(VectorReplicate<0>(Mul), VectorReplicate<1>(Mul)), VectorReplicate<2>(Mul));
+}
+
+// W는 0
+inline VectorRegister4f VectorCross(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	// (A * B.yzx - A.yzx * B).yzx
+	const VectorRegister4f C = VectorNegateMultiplyAdd(VectorSwizzle<1, 2, 0, 3>(A), B, VectorMultiply(A, VectorSwizzle<1, 2, 0, 3>(B)));
+	return VectorSwizzle<1, 2, 0, 3>(C);
+}
+
+inline void VectorTranspose4x4(VectorRegister4f& R0, VectorRegister4f& R1, VectorRegister4f& R2, VectorRegister4f& R3)
+{
+	const VectorRegister4f T0 = VectorShuffle<0, 1, 0, 1>(R0, R1);
+	const VectorRegister4f T1 = VectorShuffle<2, 3, 2, 3>(R0, R1);
+	const VectorRegister4f T2 = VectorShuffle<0, 1, 0, 1>(R2, R3);
+	const VectorRegister4f T3 = VectorShuffle<2, 3, 2, 3>(R2, R3);
+
+	R0 = VectorShuffle<0, 2, 0, 2>(T0, T2);
+	R1 = VectorShuffle<1, 3, 1, 3>(T0, T2);
+	R2 = VectorShuffle<0, 2, 0, 2>(T1, T3);
+	R3 = VectorShuffle<1, 3, 1, 3>(T1, T3);
+}
+
+// 행벡터 V * M (M은 행 4개)
+inline VectorRegister4f VectorTransformVector(const VectorRegister4f& V, const VectorRegister4f* M)
+{
+	VectorRegister4f Result = VectorMultiply(VectorReplicate<0>(V), M[0]);
+	Result = VectorMultiplyAdd(VectorReplicate<1>(V), M[1], Result);
+	Result = VectorMultiplyAdd(VectorReplicate<2>(V), M[2], Result);
+	Result = VectorMultiplyAdd(VectorReplicate<3>(V), M[3], Result);
+	return Result;
+}
+
+// Result = A * B (행 4개씩). Result가 A나 B와 같아도 된다.
+inline void VectorMatrixMultiply(VectorRegister4f* Result, const VectorRegister4f* A, const VectorRegister4f* B)
+{
+#if defined(MUNDI_SIMD_AVX2)
+	// A의 두 행을 256비트 하나에 담고 B의 각 행을 양쪽 128비트에 복제해 두 행을 한 번에 계산
+	const __m256 B0 = _mm256_broadcast_ps(&B[0]);
+	const __m256 B1 = _mm256_broadcast_ps(&B[1]);
+	const __m256 B2 = _mm256_broadcast_ps(&B[2]);
+	const __m256 B3 = _mm256_broadcast_ps(&B[3]);
+
+	const __m256 A01 = _mm256_set_m128(A[1], A[0]);
+	const __m256 A23 = _mm256_set_m128(A[3], A[2]);
+
+	__m256 R01 = _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, MUNDI_SHUFFLE_MASK(0, 0, 0, 0)), B0);
+	R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, MUNDI_SHUFFLE_MASK(1, 1, 1, 1)), B1, R01);
+	R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, MUNDI_SHUFFLE_MASK(2, 2, 2, 2)), B2, R01);
+	R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, MUNDI_SHUFFLE_MASK(3, 3, 3, 3)), B3, R01);
+
+	__m256 R23 = _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, MUNDI_SHUFFLE_MASK(0, 0, 0, 0)), B0);
+	R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, MUNDI_SHUFFLE_MASK(1, 1, 1, 1)), B1, R23);
+	R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, MUNDI_SHUFFLE_MASK(2, 2, 2, 2)), B2, R23);
+	R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, MUNDI_SHUFFLE_MASK(3, 3, 3, 3)), B3, R23);
+
+	Result[0] = _mm256_castps256_ps128(R01);
+	Result[1] = _mm256_extractf128_ps(R01, 1);
+	Result[2] = _mm256_castps256_ps128(R23);
+	Result[3] = _mm256_extractf128_ps(R23, 1);
+#else
+	const VectorRegister4f R0 = VectorTransformVector(A[0], B);
+	const VectorRegister4f R1 = VectorTransformVector(A[1], B);
+	const VectorRegister4f R2 = VectorTransformVector(A[2], B);
+	const VectorRegister4f R3 = VectorTransformVector(A[3], B);
+	Result[0] = R0;
+	Result[1] = R1;
+	Result[2] = R2;
+	Result[3] = R3;
+#endif
+}
+
+/**
+ * 2x2 블록 분할로 구한 일반 4x4 역행렬
+ * M = | A B |  (각 블록은 (m00, m01, m10, m11) 순서의 레지스터 하나)
+ *     | C D |
+ * |det M|이 MinDeterminant보다 작으면 Result를 건드리지 않고 false.
+ */
+inline bool VectorMatrixInverse(VectorRegister4f* Result, const VectorRegister4f* M, float MinDeterminant)
+{
+	// 2x2 블록 연산: A*B, adj(A)*B, A*adj(B)
+	struct FMat2
+	{
+		static VectorRegister4f Mul(const VectorRegister4f& A, const VectorRegister4f& B)
+		{
+			return VectorMultiplyAdd(VectorSwizzle<1, 0, 3, 2>(A), VectorSwizzle<2, 1, 2, 1>(B), VectorMultiply(A, VectorSwizzle<0, 3, 0, 3>(B)));
+		}
+		static VectorRegister4f AdjMul(const VectorRegister4f& A, const VectorRegister4f& B)
+		{
+			return VectorNegateMultiplyAdd(VectorSwizzle<1, 1, 2, 2>(A), VectorSwizzle<2, 3, 0, 1>(B), VectorMultiply(VectorSwizzle<3, 3, 0, 0>(A), B));
+		}
+		static VectorRegister4f MulAdj(const VectorRegister4f& A, const VectorRegister4f& B)
+		{
+			return VectorNegateMultiplyAdd(VectorSwizzle<1, 0, 3, 2>(A), VectorSwizzle<2, 1, 2, 1>(B), VectorMultiply(A, VectorSwizzle<3, 0, 3, 0>(B)));
+		}
+	};
+
+	const VectorRegister4f A = VectorShuffle<0, 1, 0, 1>(M[0], M[1]);
+	const VectorRegister4f B = VectorShuffle<2, 3, 2, 3>(M[0], M[1]);
+	const VectorRegister4f C = VectorShuffle<0, 1, 0, 1>(M[2], M[3]);
+	const VectorRegister4f D = VectorShuffle<2, 3, 2, 3>(M[2], M[3]);
+
+	// (|A|, |B|, |C|, |D|)
+	const VectorRegister4f DetSub = VectorNegateMultiplyAdd(
+		VectorShuffle<1, 3, 1, 3>(M[0], M[2]), VectorShuffle<0, 2, 0, 2>(M[1], M[3]),
+		VectorMultiply(VectorShuffle<0, 2, 0, 2>(M[0], M[2]), VectorShuffle<1, 3, 1, 3>(M[1], M[3])));
+	const VectorRegister4f DetA = VectorReplicate<0>(DetSub);
+	const VectorRegister4f DetB = VectorReplicate<1>(DetSub);
+	const VectorRegister4f DetC = VectorReplicate<2>(DetSub);
+	const VectorRegister4f DetD = VectorReplicate<3>(DetSub);
+
+	const VectorRegister4f D_C = FMat2::AdjMul(D, C);
+	const VectorRegister4f A_B = FMat2::AdjMul(A, B);
+
+	// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+	const VectorRegister4f Trace = VectorDot4(A_B, VectorSwizzle<0, 2, 1, 3>(D_C));
+	const VectorRegister4f DetM = VectorSubtract(VectorMultiplyAdd(DetB, DetC, VectorMultiply(DetA, DetD)), Trace);
+	const float Det = VectorGetComponent<0>(DetM);
+	if (std::fabs(Det) < MinDeterminant)
+	{
+		return false;
+	}
+
+	// M^-1 = 1/|M| * | X Y |  (각 블록은 adjugate 형태)
+	//                 | Z W |
+	VectorRegister4f X = VectorSubtract(VectorMultiply(DetD, A), FMat2::Mul(B, D_C));
+	VectorRegister4f Y = VectorSubtract(VectorMultiply(DetB, C), FMat2::MulAdj(D, A_B));
+	VectorRegister4f Z = VectorSubtract(VectorMultiply(DetC, B), FMat2::MulAdj(A, D_C));
+	VectorRegister4f W = VectorSubtract(VectorMultiply(DetA, D), FMat2::Mul(C, A_B));
+
+	// 각 블록의 adjugate 부호를 역행렬식과 함께 곱한다
+	const VectorRegister4f RcpDet = VectorDivide(VectorSet(1.0f, -1.0f, -1.0f, 1.0f), DetM);
+	X = VectorMultiply(X, RcpDet);
+	Y = VectorMultiply(Y, RcpDet);
+	Z = VectorMultiply(Z, RcpDet);
+	W = VectorMultiply(W, RcpDet);
+
+	// adjugate 셔플과 블록 재배치를 한 번에
+	Result[0] = VectorShuffle<3, 1, 3, 1>(X, Y);
+	Result[1] = VectorShuffle<2, 0, 2, 0>(X, Y);
+	Result[2] = VectorShuffle<3, 1, 3, 1>(Z, W);
+	Result[3] = VectorShuffle<2, 0, 2, 0>(Z, W);
+	return true;
+}
+
+/**
+ * Affine 역행렬 (행 0~2의 W = 0, 행 3 = (T, 1) 가정)
+ * 상단 3x3의 역은 행끼리의 외적으로 구한다: R^-1 = [r1 x r2 | r2 x r0 | r0 x r1] / det (열 기준)
+ * |det R|이 MinDeterminant보다 작으면 Result를 건드리지 않고 false.
+ */
+inline bool VectorMatrixInverseAffine(VectorRegister4f* Result, const VectorRegister4f* M, float MinDeterminant)
+{
+	VectorRegister4f C0 = VectorCross(M[1], M[2]);
+	VectorRegister4f C1 = VectorCross(M[2], M[0]);
+	VectorRegister4f C2 = VectorCross(M[0], M[1]);
+
+	const VectorRegister4f Det = VectorDot3(M[0], C0);
+	if (std::fabs(VectorGetComponent<0>(Det)) < MinDeterminant)
+	{
+		return false;
+	}
+
+	// 외적 결과의 W는 0이므로 전치 후 각 행의 W도 0
+	VectorRegister4f C3 = VectorZero();
+	VectorTranspose4x4(C0, C1, C2, C3);
+
+	const VectorRegister4f RcpDet = VectorDivide(VectorSetFloat1(1.0f), Det);
+	const VectorRegister4f Inv0 = VectorMultiply(C0, RcpDet);
+	const VectorRegister4f Inv1 = VectorMultiply(C1, RcpDet);
+	const VectorRegister4f Inv2 = VectorMultiply(C2, RcpDet);
+
+	// -T * R^-1 (행벡터)
+	VectorRegister4f InvT = VectorMultiply(VectorReplicate<0>(M[3]), Inv0);
+	InvT = VectorMultiplyAdd(VectorReplicate<1>(M[3]), Inv1, InvT);
+	InvT = VectorMultiplyAdd(VectorReplicate<2>(M[3]), Inv2, InvT);
+
+	Result[0] = Inv0;
+	Result[1] = Inv1;
+	Result[2] = Inv2;
+	Result[3] = VectorSubtract(VectorSet(0.0f, 0.0f, 0.0f, 1.0f), InvT);
+	return true;
+}
+
+// 상단 3x3이 정규직교(회전)인 affine 행렬의 역: R^T와 -T * R^T
+inline void VectorMatrixInverseOrthonormal(VectorRegister4f* Result, const VectorRegister4f* M)
+{
+	// 행 0~2의 W를 0으로 두고 전치해야 결과 행의 W가 0이 된다
+	const VectorRegister4f Mask = VectorSet(1.0f, 1.0f, 1.0f, 0.0f);
+	VectorRegister4f R0 = VectorMultiply(M[0], Mask);
+	VectorRegister4f R1 = VectorMultiply(M[1], Mask);
+	VectorRegister4f R2 = VectorMultiply(M[2], Mask);
+	VectorRegister4f R3 = VectorZero();
+	VectorTranspose4x4(R0, R1, R2, R3);
+
+	VectorRegister4f InvT = VectorMultiply(VectorReplicate<0>(M[3]), R0);
+	InvT = VectorMultiplyAdd(VectorReplicate<1>(M[3]), R1, InvT);
+	InvT = VectorMultiplyAdd(VectorReplicate<2>(M[3]), R2, InvT);
+
+	Result[0] = R0;
+	Result[1] = R1;
+	Result[2] = R2;
+	Result[3] = VectorSubtract(VectorSet(0.0f, 0.0f, 0.0f, 1.0f), InvT);
+}
+
+// 쿼터니언 곱 A * B (X, Y, Z, W 순서)
+inline VectorRegister4f VectorQuaternionMultiply(const VectorRegister4f& A, const VectorRegister4f& B)
+{
+	VectorRegister4f Result = VectorMultiply(VectorReplicate<3>(A), B);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<0>(A), VectorSwizzle<3, 2, 1, 0>(B)), VectorSet(1.0f, -1.0f, 1.0f, -1.0f), Result);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<1>(A), VectorSwizzle<2, 3, 0, 1>(B)), VectorSet(1.0f, 1.0f, -1.0f, -1.0f), Result);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<2>(A), VectorSwizzle<1, 0, 3, 2>(B)), VectorSet(-1.0f, 1.0f, 1.0f, -1.0f), Result);
+	return Result;
+}
+
+// v' = v + w * t + cross(q.xyz, t),  t = 2 * cross(q.xyz, v)
+inline VectorRegister4f VectorQuaternionRotateVector(const VectorRegister4f& Quat, const VectorRegister4f& V)
+{
+	const VectorRegister4f T = VectorMultiply(VectorCross(Quat, V), VectorSetFloat1(2.0f));
+	return VectorAdd(VectorMultiplyAdd(VectorReplicate<3>(Quat), T, V), VectorCross(Quat, T));
+}
+
+// 길이가 MinSize 이하이면 Fallback
+inline VectorRegister4f VectorNormalizeSafe4(const VectorRegister4f& V, const VectorRegister4f& Fallback, float MinSize)
+{
+	const VectorRegister4f Size = VectorSqrt(VectorDot4(V, V));
+	if (VectorGetComponent<0>(Size) <= MinSize)
+	{
+		return Fallback;
+	}
+	return VectorDivide(V, Size);
+}
+
+// 빌드에 들어간 백엔드 이름 ("AVX2", "SSE", "Scalar")
+const char* VectorGetBackendName();
+// 실행 중인 CPU가 빌드된 백엔드의 명령어를 지원하는지 (AVX2 빌드를 구형 CPU에서 띄운 경우 false)
+bool VectorIsBackendSupported();
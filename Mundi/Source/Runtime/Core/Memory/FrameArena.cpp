@@ -0,0 +1,195 @@
+#include "pch.h"
+#include "FrameArena.h"
+#include <atomic>
+#include <cstddef>
+
+namespace
+{
+    constexpr SIZE_T DefaultBlockSize = 256 * 1024;
+
+#if defined(_DEBUG)
+    constexpr uint8 FreedPoison = 0xDD;      // Free로 돌려받은 구간
+    constexpr uint8 RewoundPoison = 0xCD;    // 프레임이 지나 되감긴 구간
+#endif
+
+    struct FFrameArenaBlock
+    {
+        uint8* Data = nullptr;
+        SIZE_T Size = 0;
+    };
+
+    // 한 스레드의 한 프레임 분량 (짝수/홀수 프레임마다 하나)
+    struct FFrameArenaBuffer
+    {
+        TArray<FFrameArenaBlock> Blocks;
+        int32 CurrentBlock = 0;
+        SIZE_T Offset = 0;
+        uint64 Frame = 0;
+
+        void Rewind()
+        {
+#if defined(_DEBUG)
+            for (int32 i = 0; i <= CurrentBlock && i < Blocks.Num(); ++i)
+            {
+                const SIZE_T Used = (i == CurrentBlock) ? Offset : Blocks[i].Size;
+                memset(Blocks[i].Data, RewoundPoison, Used);
+            }
+#endif
+            CurrentBlock = 0;
+            Offset = 0;
+        }
+
+        void* Allocate(SIZE_T Size, SIZE_T Alignment)
+        {
+            while (CurrentBlock < Blocks.Num())
+            {
+                FFrameArenaBlock& Block = Blocks[CurrentBlock];
+                const uintptr_t Base = reinterpret_cast<uintptr_t>(Block.Data);
+                const uintptr_t Aligned = (Base + Offset + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+                const SIZE_T NewOffset = static_cast<SIZE_T>(Aligned - Base) + Size;
+                if (NewOffset <= Block.Size)
+                {
+                    Offset = NewOffset;
+                    return reinterpret_cast<void*>(Aligned);
+                }
+
+                // 다음 블록으로 (남은 꼬리는 버림)
+                ++CurrentBlock;
+                Offset = 0;
+            }
+
+            // 블록이 모자라면 추가 (큰 요청은 그 크기만큼)
+            FFrameArenaBlock NewBlock;
+            NewBlock.Size = std::max(DefaultBlockSize, Size + Alignment);
+            NewBlock.Data = static_cast<uint8*>(::operator new(NewBlock.Size));
+            Blocks.Add(NewBlock);
+            CurrentBlock = Blocks.Num() - 1;
+            Offset = 0;
+            return Allocate(Size, Alignment);
+        }
+
+        SIZE_T GetReservedBytes() const
+        {
+            SIZE_T Total = 0;
+            for (const FFrameArenaBlock& Block : Blocks)
+            {
+                Total += Block.Size;
+            }
+            return Total;
+        }
+    };
+
+    std::atomic<uint64> GFrameNumber{ 1 };
+    std::atomic<SIZE_T> GFrameBytes{ 0 };
+    std::atomic<SIZE_T> GReservedBytes{ 0 };
+    SIZE_T GLastFrameBytes = 0;
+    SIZE_T GHighWaterMark = 0;
+
+    struct FFrameArenaThreadState
+    {
+        FFrameArenaBuffer Buffers[2];
+
+        ~FFrameArenaThreadState()
+        {
+            for (FFrameArenaBuffer& Buffer : Buffers)
+            {
+                GReservedBytes.fetch_sub(Buffer.GetReservedBytes(), std::memory_order_relaxed);
+                for (FFrameArenaBlock& Block : Buffer.Blocks)
+                {
+                    ::operator delete(Block.Data);
+                }
+            }
+        }
+    };
+
+    FFrameArenaThreadState& GetThreadState()
+    {
+        thread_local FFrameArenaThreadState State;
+        return State;
+    }
+}
+
+void FFrameArena::BeginFrame()
+{
+    const SIZE_T Used = GFrameBytes.exchange(0, std::memory_order_relaxed);
+    GLastFrameBytes = Used;
+    if (Used > GHighWaterMark)
+    {
+#if defined(_DEBUG)
+        // 사용량이 크게 늘었을 때만 알림 (매 프레임 로그 방지)
+        if (Used > GHighWaterMark + GHighWaterMark / 4)
+        {
+            UE_LOG("[FrameArena] New high-water mark: %.1f KB (reserved %.1f KB)",
+                Used / 1024.0, GReservedBytes.load(std::memory_order_relaxed) / 1024.0);
+        }
+#endif
+        GHighWaterMark = Used;
+    }
+
+    GFrameNumber.fetch_add(1, std::memory_order_release);
+}
+
+void* FFrameArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+    if (Alignment < alignof(std::max_align_t))
+    {
+        Alignment = alignof(std::max_align_t);
+    }
+
+    const uint64 Frame = GFrameNumber.load(std::memory_order_acquire);
+    FFrameArenaBuffer& Buffer = GetThreadState().Buffers[Frame & 1];
+
+    // 이 스레드가 이번 프레임에 처음 할당: 두 프레임 전 데이터를 되감는다
+    if (Buffer.Frame != Frame)
+    {
+        Buffer.Rewind();
+        Buffer.Frame = Frame;
+    }
+
+    const int32 NumBlocksBefore = Buffer.Blocks.Num();
+    void* Ptr = Buffer.Allocate(Size, Alignment);
+    if (Buffer.Blocks.Num() != NumBlocksBefore)
+    {
+        GReservedBytes.fetch_add(Buffer.Blocks.Last().Size, std::memory_order_relaxed);
+    }
+
+    GFrameBytes.fetch_add(Size, std::memory_order_relaxed);
+    return Ptr;
+}
+
+void FFrameArena::Free(void* Ptr, SIZE_T Size)
+{
+#if defined(_DEBUG)
+    if (Ptr)
+    {
+        memset(Ptr, FreedPoison, Size);
+    }
+#else
+    (void)Ptr;
+    (void)Size;
+#endif
+}
+
+uint64 FFrameArena::GetFrameNumber()
+{
+    return GFrameNumber.load(std::memory_order_relaxed);
+}
+
+SIZE_T FFrameArena::GetLastFrameBytes()
+{
+    return GLastFrameBytes;
+}
+
+SIZE_T FFrameArena::GetHighWaterMark()
+{
+    return GHighWaterMark;
+}
+
+SIZE_T FFrameArena::GetReservedBytes()
+{
+    return GReservedBytes.load(std::memory_order_relaxed);
+}
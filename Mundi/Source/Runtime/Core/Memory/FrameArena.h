@@ -0,0 +1,70 @@
+#pragma once
+#include "UEContainer.h"
+#include "InlineArray.h"
+
+/**
+ * @brief 프레임 단위 임시 데이터용 선형(bump) 할당자
+ * - 스레드마다 자기 아레나를 가지므로 할당에 잠금이 없다
+ * - 아레나는 두 벌(짝수/홀수 프레임)이라, 프레임 N에 받은 메모리는 프레임 N+1이 끝날 때까지 유효하다
+ * - 각 스레드는 새 프레임에서 처음 할당할 때 두 프레임 전 버퍼를 되감는다 (블록은 반납하지 않고 재사용)
+ * - 개별 해제는 하지 않는다. Free는 디버그 빌드에서 해당 구간을 오염(poison)시키는 용도뿐
+ *
+ * 프레임을 넘겨 보관하는 데이터에는 절대 쓰지 말 것.
+ */
+class FFrameArena
+{
+public:
+    // 게임 스레드에서 프레임 시작 시 한 번 호출
+    static void BeginFrame();
+
+    static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+    static void Free(void* Ptr, SIZE_T Size);
+
+    static uint64 GetFrameNumber();
+
+    // 직전 프레임에 모든 스레드가 아레나에서 받은 바이트 수
+    static SIZE_T GetLastFrameBytes();
+    // 지금까지 한 프레임 사용량의 최대치
+    static SIZE_T GetHighWaterMark();
+    // 모든 스레드가 확보해 둔 블록 총량
+    static SIZE_T GetReservedBytes();
+};
+
+/**
+ * @brief FFrameArena에서 메모리를 받는 STL 할당자
+ */
+template<typename T>
+class TFrameAllocator
+{
+public:
+    using value_type = T;
+
+    TFrameAllocator() noexcept = default;
+
+    template<typename U>
+    TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+    T* allocate(SIZE_T Count)
+    {
+        return static_cast<T*>(FFrameArena::Allocate(sizeof(T) * Count, alignof(T)));
+    }
+
+    void deallocate(T* Ptr, SIZE_T Count) noexcept
+    {
+        FFrameArena::Free(Ptr, sizeof(T) * Count);
+    }
+
+    template<typename U>
+    bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+/** 프레임 아레나를 쓰는 TArray (FSceneRenderer처럼 한 프레임 안에서 만들고 버리는 목록용) */
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
+
+/** 넘칠 때 힙 대신 프레임 아레나로 옮기는 TInlineArray */
+template<typename T, int32 N>
+using TFrameInlineArray = TInlineArray<T, N, TFrameAllocator<T>>;
@@ -3,45 +3,357 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <atomic>
+#include <new>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+uint64 FMemoryManager::FrameStartHeapAllocations = 0;
+uint64 FMemoryManager::LastFrameHeapAllocations = 0;
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 정적 초기화 이전의 할당도 셀 수 있도록 아래 상태는 모두 상수 초기화된다
+	constexpr int32 NumTags = static_cast<int32>(EMemoryTag::Count);
+
+	// 스레드별 카운터 블록. 소유 스레드만 쓰므로 공유 원자 RMW(lock 접두사) 없이 relaxed load/store로 갱신하고,
+	// 통계를 읽을 때 모든 블록을 합친다. 다른 스레드에서 해제하면 그 스레드 블록이 음수가 될 수 있지만 합은 맞다.
+	struct FThreadCounters
+	{
+		std::atomic<int64> CurrentBytes[NumTags]{};
+		std::atomic<int64> CurrentCount[NumTags]{};
+		std::atomic<uint64> TotalAllocations[NumTags]{};
+		std::atomic<uint64> HeapAllocations{ 0 };
+	};
+
+	// 블록은 고정 풀에서 스레드마다 하나씩 받고 돌려주지 않는다 (종료한 스레드의 누계도 합에 남아야 하므로)
+	// 풀이 바닥나면 이후 스레드는 원자 RMW로 갱신하는 공용 블록을 쓴다
+	constexpr int32 MaxThreadCounters = 128;
+	FThreadCounters GThreadCounters[MaxThreadCounters];
+	std::atomic<int32> GNumThreadCounters{ 0 };
+	FThreadCounters GSharedCounters;
+
+	thread_local FThreadCounters* GLocalCounters = nullptr;
+	thread_local EMemoryTag GCurrentMemoryTag = EMemoryTag::Untagged;
+
+	// 스레드 블록 합으로는 순간 최고치를 알 수 없어, 통계를 읽는 시점(BeginFrame 포함)에 표본을 떠서 갱신
+	std::atomic<uint64> GPeakBytes[NumTags]{};
+
+	FThreadCounters& GetLocalCounters()
+	{
+		if (!GLocalCounters)
+		{
+			const int32 Index = GNumThreadCounters.fetch_add(1, std::memory_order_relaxed);
+			GLocalCounters = Index < MaxThreadCounters ? &GThreadCounters[Index] : &GSharedCounters;
+		}
+		return *GLocalCounters;
+	}
+
+	template<typename T>
+	void AddCounter(FThreadCounters& Counters, std::atomic<T>& Counter, T Delta)
+	{
+		if (&Counters == &GSharedCounters)
+		{
+			Counter.fetch_add(Delta, std::memory_order_relaxed);
+		}
+		else
+		{
+			Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+		}
+	}
+
+	// 등록된 모든 스레드 블록 + 공용 블록에 대해 Func 호출
+	template<typename FuncType>
+	void ForEachCounters(FuncType&& Func)
+	{
+		const int32 NumBlocks = (std::min)(GNumThreadCounters.load(std::memory_order_relaxed), MaxThreadCounters);
+		for (int32 i = 0; i < NumBlocks; ++i)
+		{
+			Func(GThreadCounters[i]);
+		}
+		Func(GSharedCounters);
+	}
+
+	constexpr const char* GTagNames[] = { "Untagged", "Objects", "Rendering", "Animation", "Assets", "Lua" };
+	static_assert(sizeof(GTagNames) / sizeof(GTagNames[0]) == static_cast<SIZE_T>(EMemoryTag::Count), "EMemoryTag와 GTagNames 개수가 다름");
+
+	// 추적하는 모든 할당 바로 앞에 붙는 헤더. 해제 시 크기와 태그를 여기서 읽는다.
+	// 16B라 기본 정렬(16B)을 깨지 않는다.
+	// 경계: 여기서 나간 포인터만 delete/Deallocate로 돌아와야 한다. malloc/_aligned_malloc이나 다른 모듈(DLL)의
+	// operator new로 잡은 메모리를 넘기면 Magic이 맞지 않으며, 그 경우 해제하지 않고 새게 둔다 (잘못된 free보다 안전).
+	// 반대로 여기서 할당한 포인터를 free()나 DLL 쪽 delete로 넘겨서도 안 된다.
+	struct FAllocationHeader
+	{
+		uint64 Size;
+		uint32 Offset;      // 원본 블록 시작 ~ 사용자 포인터
+		EMemoryTag Tag;
+		uint8 bAligned;
+		uint16 Magic;
+	};
+	static_assert(sizeof(FAllocationHeader) == 16, "FAllocationHeader must stay 16 bytes");
 
+	constexpr uint16 HeaderMagic = 0x4D4D;
+	constexpr SIZE_T DefaultAlignment = 16;
+
+	void* AllocateTagged(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag)
+	{
+		// 16B를 넘는 정렬은 정렬 크기만큼 앞을 비워 헤더를 둔다
+		const bool bAligned = Alignment > DefaultAlignment;
+		const SIZE_T Offset = bAligned ? Alignment : sizeof(FAllocationHeader);
+
+		void* Raw = nullptr;
+		if (bAligned)
+		{
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+			Raw = _aligned_malloc_dbg(Size + Offset, Alignment, nullptr, 0);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+			Raw = _aligned_malloc(Size + Offset, Alignment);
 #endif
-	if (!Raw)
-		return nullptr;
+		}
+		else
+		{
+			Raw = std::malloc(Size + Offset);
+		}
+		if (!Raw)
+		{
+			return nullptr;
+		}
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+		unsigned char* UserPtr = static_cast<unsigned char*>(Raw) + Offset;
+		FAllocationHeader* Header = reinterpret_cast<FAllocationHeader*>(UserPtr) - 1;
+		Header->Size = Size;
+		Header->Offset = static_cast<uint32>(Offset);
+		Header->Tag = Tag;
+		Header->bAligned = bAligned ? 1 : 0;
+		Header->Magic = HeaderMagic;
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
-}
+		FMemoryManager::TrackAllocation(Tag, Size);
+		return UserPtr;
+	}
 
-void FMemoryManager::Deallocate(void* Ptr)
-{
-	if (!Ptr)
-		return;
+	void FreeTagged(void* Ptr)
+	{
+		if (!Ptr)
+		{
+			return;
+		}
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+		FAllocationHeader* Header = static_cast<FAllocationHeader*>(Ptr) - 1;
+		if (Header->Magic != HeaderMagic)
+		{
+			assert(false && "Freeing memory that was not allocated by FMemoryManager");
+			return;
+		}
+		// 이중 해제도 위에서 걸리도록 표식을 지운다
+		Header->Magic = 0;
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+		FMemoryManager::TrackFree(Header->Tag, Header->Size);
 
+		void* Raw = static_cast<unsigned char*>(Ptr) - Header->Offset;
+		if (Header->bAligned)
+		{
 #if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
+			_aligned_free_dbg(Raw);
 #else
-	_aligned_free(Raw);
+			_aligned_free(Raw);
 #endif
-}
\ No newline at end of file
+		}
+		else
+		{
+			std::free(Raw);
+		}
+	}
+
+	void* AllocateForOperatorNew(SIZE_T Size, SIZE_T Alignment)
+	{
+		FThreadCounters& Counters = GetLocalCounters();
+		AddCounter<uint64>(Counters, Counters.HeapAllocations, 1);
+		if (Size == 0)
+		{
+			Size = 1;
+		}
+
+		while (true)
+		{
+			if (void* Ptr = AllocateTagged(Size, Alignment, GCurrentMemoryTag))
+			{
+				return Ptr;
+			}
+
+			std::new_handler Handler = std::get_new_handler();
+			if (!Handler)
+			{
+				throw std::bad_alloc();
+			}
+			Handler();
+		}
+	}
+}
+
+// 전역 operator new/delete 교체: 할당 횟수를 세고, 현재 태그로 크기를 계정한 뒤 CRT로 넘긴다
+// (new[]/nothrow/sized delete 기본 구현은 아래 함수들을 거친다)
+void* operator new(SIZE_T Size)
+{
+	return AllocateForOperatorNew(Size, DefaultAlignment);
+}
+
+void operator delete(void* Ptr) noexcept
+{
+	FreeTagged(Ptr);
+}
+
+void* operator new(SIZE_T Size, std::align_val_t Alignment)
+{
+	return AllocateForOperatorNew(Size, static_cast<SIZE_T>(Alignment));
+}
+
+void operator delete(void* Ptr, std::align_val_t) noexcept
+{
+	FreeTagged(Ptr);
+}
+
+uint64 FMemoryManager::GetHeapAllocationCount()
+{
+	uint64 Total = 0;
+	ForEachCounters([&Total](const FThreadCounters& Counters)
+	{
+		Total += Counters.HeapAllocations.load(std::memory_order_relaxed);
+	});
+	return Total;
+}
+
+void FMemoryManager::BeginFrame()
+{
+	const uint64 Now = GetHeapAllocationCount();
+	LastFrameHeapAllocations = Now - FrameStartHeapAllocations;
+	FrameStartHeapAllocations = Now;
+
+	// 태그별 최고치 표본
+	for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+	{
+		GetTagStats(static_cast<EMemoryTag>(TagIndex));
+	}
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	return Allocate(Size, Alignment, GCurrentMemoryTag);
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag)
+{
+	return AllocateTagged(Size, Alignment, Tag);
+}
+
+void FMemoryManager::Deallocate(void* Ptr)
+{
+	FreeTagged(Ptr);
+}
+
+void FMemoryManager::TrackAllocation(EMemoryTag Tag, SIZE_T Size)
+{
+	const int32 TagIndex = static_cast<int32>(Tag);
+	FThreadCounters& Counters = GetLocalCounters();
+	AddCounter<int64>(Counters, Counters.CurrentBytes[TagIndex], static_cast<int64>(Size));
+	AddCounter<int64>(Counters, Counters.CurrentCount[TagIndex], 1);
+	AddCounter<uint64>(Counters, Counters.TotalAllocations[TagIndex], 1);
+}
+
+void FMemoryManager::TrackFree(EMemoryTag Tag, SIZE_T Size)
+{
+	const int32 TagIndex = static_cast<int32>(Tag);
+	FThreadCounters& Counters = GetLocalCounters();
+	AddCounter<int64>(Counters, Counters.CurrentBytes[TagIndex], -static_cast<int64>(Size));
+	AddCounter<int64>(Counters, Counters.CurrentCount[TagIndex], -1);
+}
+
+EMemoryTag FMemoryManager::GetCurrentTag()
+{
+	return GCurrentMemoryTag;
+}
+
+void FMemoryManager::SetCurrentTag(EMemoryTag Tag)
+{
+	GCurrentMemoryTag = Tag;
+}
+
+const char* FMemoryManager::GetTagName(EMemoryTag Tag)
+{
+	return (Tag < EMemoryTag::Count) ? GTagNames[static_cast<int32>(Tag)] : "Invalid";
+}
+
+FMemoryTagStats FMemoryManager::GetTagStats(EMemoryTag Tag)
+{
+	const int32 TagIndex = static_cast<int32>(Tag);
+
+	int64 CurrentBytes = 0;
+	int64 CurrentCount = 0;
+	uint64 TotalAllocations = 0;
+	ForEachCounters([&](const FThreadCounters& Counters)
+	{
+		CurrentBytes += Counters.CurrentBytes[TagIndex].load(std::memory_order_relaxed);
+		CurrentCount += Counters.CurrentCount[TagIndex].load(std::memory_order_relaxed);
+		TotalAllocations += Counters.TotalAllocations[TagIndex].load(std::memory_order_relaxed);
+	});
+
+	// 다른 스레드가 갱신하는 도중에 읽으면 잠깐 음수가 될 수 있다
+	FMemoryTagStats Stats;
+	Stats.CurrentBytes = static_cast<uint64>((std::max)(CurrentBytes, int64(0)));
+	Stats.CurrentCount = static_cast<uint64>((std::max)(CurrentCount, int64(0)));
+	Stats.TotalAllocations = TotalAllocations;
+
+	uint64 Peak = GPeakBytes[TagIndex].load(std::memory_order_relaxed);
+	while (Stats.CurrentBytes > Peak && !GPeakBytes[TagIndex].compare_exchange_weak(Peak, Stats.CurrentBytes, std::memory_order_relaxed))
+	{
+	}
+	Stats.PeakBytes = (std::max)(Peak, Stats.CurrentBytes);
+	return Stats;
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	int64 Total = 0;
+	ForEachCounters([&Total](const FThreadCounters& Counters)
+	{
+		for (const std::atomic<int64>& Bytes : Counters.CurrentBytes)
+		{
+			Total += Bytes.load(std::memory_order_relaxed);
+		}
+	});
+	return static_cast<uint64>((std::max)(Total, int64(0)));
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	int64 Total = 0;
+	ForEachCounters([&Total](const FThreadCounters& Counters)
+	{
+		for (const std::atomic<int64>& Count : Counters.CurrentCount)
+		{
+			Total += Count.load(std::memory_order_relaxed);
+		}
+	});
+	return static_cast<uint64>((std::max)(Total, int64(0)));
+}
+
+void FMemoryManager::ReportLeaks()
+{
+	UE_LOG("[Memory] Outstanding allocations at shutdown:");
+	for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count); ++TagIndex)
+	{
+		const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+		const FMemoryTagStats Stats = GetTagStats(Tag);
+		if (Stats.CurrentCount == 0)
+		{
+			continue;
+		}
+		UE_LOG("[Memory]   %-10s %10.1f KB in %llu allocs (peak %.1f KB)", GetTagName(Tag),
+			Stats.CurrentBytes / 1024.0, Stats.CurrentCount, Stats.PeakBytes / 1024.0);
+	}
+
+	// UObject는 DeleteAll 이후 전부 해제되어 있어야 한다 (나머지 태그는 정적 캐시 등이 남을 수 있음)
+	const FMemoryTagStats ObjectStats = GetTagStats(EMemoryTag::Objects);
+	if (ObjectStats.CurrentCount > 0)
+	{
+		UE_LOG("[Memory] LEAK: %llu UObject allocations (%.1f KB) were never freed",
+			ObjectStats.CurrentCount, ObjectStats.CurrentBytes / 1024.0);
+	}
+}
@@ -2,14 +2,88 @@
 #include <cstddef>
 #include "UEContainer.h"
 
+// 메모리 사용처 분류 (서브시스템별 예산 관리용)
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	Objects,
+	Rendering,
+	Animation,
+	Assets,
+	Lua,
+
+	Count
+};
+
+struct FMemoryTagStats
+{
+	uint64 CurrentBytes = 0;
+	uint64 PeakBytes = 0;          // 통계를 읽은 시점(매 프레임 BeginFrame 포함)에서 본 최고치
+	uint64 CurrentCount = 0;       // 아직 해제되지 않은 할당 수
+	uint64 TotalAllocations = 0;   // 누적 할당 수
+};
+
 class FMemoryManager
 {
 public:
 	// 인자 변수를 PascalCase로 변경
+	// 태그를 생략하면 현재 스레드의 태그(FScopedMemoryTag)를 쓴다
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	static void* Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag);
 	static void  Deallocate(void* Ptr);
 
+	// 크기를 스스로 아는 할당자(오브젝트 풀, Lua 할당자)가 직접 계정에 반영
+	static void TrackAllocation(EMemoryTag Tag, SIZE_T Size);
+	static void TrackFree(EMemoryTag Tag, SIZE_T Size);
+
+	static EMemoryTag GetCurrentTag();
+	static const char* GetTagName(EMemoryTag Tag);
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+
+	// 모든 태그의 합 (모든 스레드)
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+
+	// 전역 operator new를 거친 힙 할당의 누적 횟수 (TArray/std 컨테이너 포함, 모든 스레드)
+	static uint64 GetHeapAllocationCount();
+
+	// 프레임 경계에서 한 번 호출: 직전 프레임 동안의 힙 할당 횟수를 확정
+	static void BeginFrame();
+	static uint64 GetLastFrameHeapAllocations() { return LastFrameHeapAllocations; }
+
+	// 종료 시 호출: 아직 해제되지 않은 할당을 태그별로 로그에 남긴다
+	static void ReportLeaks();
+
+private:
+	friend class FScopedMemoryTag;
+	static void SetCurrentTag(EMemoryTag Tag);
+
+	static uint64 FrameStartHeapAllocations;
+	static uint64 LastFrameHeapAllocations;
+};
+
+/**
+ * @brief 범위 안에서 현재 스레드의 할당을 지정한 태그로 계정
+ * 예) FScopedMemoryTag MemoryTag(EMemoryTag::Assets);
+ * 해제는 할당 시점의 태그로 돌아가므로 다른 범위에서 해제해도 된다.
+ */
+class FScopedMemoryTag
+{
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	explicit FScopedMemoryTag(EMemoryTag Tag)
+		: PreviousTag(FMemoryManager::GetCurrentTag())
+	{
+		FMemoryManager::SetCurrentTag(Tag);
+	}
+
+	~FScopedMemoryTag()
+	{
+		FMemoryManager::SetCurrentTag(PreviousTag);
+	}
+
+	FScopedMemoryTag(const FScopedMemoryTag&) = delete;
+	FScopedMemoryTag& operator=(const FScopedMemoryTag&) = delete;
+
+private:
+	EMemoryTag PreviousTag;
+};
@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "ObjectPool.h"
+#include "MemoryManager.h"
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+    // 16B 단위 16개 (~256B), 64B 단위 12개 (~1KB), 256B 단위 12개 (~4KB)
+    constexpr int32 NumSmallClasses = 16;
+    constexpr int32 NumMediumClasses = 12;
+    constexpr int32 NumLargeClasses = 12;
+    constexpr int32 NumSizeClasses = NumSmallClasses + NumMediumClasses + NumLargeClasses;
+
+#if defined(_DEBUG)
+    constexpr uint8 AllocatedPoison = 0xCD;
+    constexpr uint8 FreedPoison = 0xDD;
+#endif
+
+    int32 GetSizeClassIndex(SIZE_T Size)
+    {
+        if (Size <= 256)
+        {
+            return static_cast<int32>((Size + 15) / 16) - 1;
+        }
+        if (Size <= 1024)
+        {
+            return NumSmallClasses + static_cast<int32>((Size - 256 + 63) / 64) - 1;
+        }
+        return NumSmallClasses + NumMediumClasses + static_cast<int32>((Size - 1024 + 255) / 256) - 1;
+    }
+
+    SIZE_T GetSlotSize(int32 ClassIndex)
+    {
+        if (ClassIndex < NumSmallClasses)
+        {
+            return static_cast<SIZE_T>(ClassIndex + 1) * 16;
+        }
+        if (ClassIndex < NumSmallClasses + NumMediumClasses)
+        {
+            return 256 + static_cast<SIZE_T>(ClassIndex - NumSmallClasses + 1) * 64;
+        }
+        return 1024 + static_cast<SIZE_T>(ClassIndex - NumSmallClasses - NumMediumClasses + 1) * 256;
+    }
+
+    // 스레드 캐시와 전역 free list 사이에 한 번에 옮기는 슬롯 수 (약 16KB 분량)
+    uint32 GetBatchCount(int32 ClassIndex)
+    {
+        return static_cast<uint32>(std::clamp<SIZE_T>((16 * 1024) / GetSlotSize(ClassIndex), 4, 64));
+    }
+
+    // 빈 슬롯의 앞부분을 링크로 쓴다 (슬롯은 최소 16B)
+    struct FFreeSlot
+    {
+        FFreeSlot* Next;
+    };
+
+    struct FSizeClass
+    {
+        std::mutex Lock;
+        FFreeSlot* FreeList = nullptr;
+        TArray<uint8*> Slabs;
+
+        std::atomic<uint32> NumSlabs{ 0 };
+        std::atomic<uint32> NumLive{ 0 };
+
+        // Lock을 잡은 상태에서 호출
+        void AddSlab(SIZE_T SlotSize)
+        {
+            // 슬랩은 CRT에서 직접 받는다 (전역 operator new를 거치면 슬랩과 그 안의 객체가 이중 계정됨)
+            // malloc은 16B 정렬을 보장하므로 모든 슬롯이 16B 정렬된다
+            uint8* Slab = static_cast<uint8*>(std::malloc(FObjectPool::SlabSize));
+            {
+                // 슬랩 목록은 풀과 함께 끝까지 남으므로 호출한 쪽 태그로 잡히지 않게 한다
+                FScopedMemoryTag MemoryTag(EMemoryTag::Untagged);
+                Slabs.Add(Slab);
+            }
+            NumSlabs.fetch_add(1, std::memory_order_relaxed);
+
+            // 주소 오름차순으로 꺼내지도록 뒤에서부터 연결
+            const SIZE_T NumSlots = FObjectPool::SlabSize / SlotSize;
+            for (SIZE_T i = NumSlots; i > 0; --i)
+            {
+                FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(Slab + (i - 1) * SlotSize);
+                Slot->Next = FreeList;
+                FreeList = Slot;
+            }
+        }
+    };
+
+    struct FObjectPoolState
+    {
+        FSizeClass Classes[NumSizeClasses];
+    };
+
+    FObjectPoolState& GetPoolState()
+    {
+        // 종료 시점에 남은 객체가 정적 소멸 이후에 해제될 수 있으므로 일부러 파괴하지 않는다
+        static FObjectPoolState* State = new FObjectPoolState();
+        return *State;
+    }
+
+    struct FObjectPoolThreadCache
+    {
+        FFreeSlot* Heads[NumSizeClasses] = {};
+        uint32 Counts[NumSizeClasses] = {};
+
+        void FlushAll()
+        {
+            for (int32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+            {
+                Flush(ClassIndex, Counts[ClassIndex]);
+            }
+        }
+
+        void Refill(int32 ClassIndex)
+        {
+            FSizeClass& SizeClass = GetPoolState().Classes[ClassIndex];
+            const uint32 BatchCount = GetBatchCount(ClassIndex);
+
+            std::lock_guard<std::mutex> Lock(SizeClass.Lock);
+            for (uint32 i = 0; i < BatchCount; ++i)
+            {
+                if (!SizeClass.FreeList)
+                {
+                    SizeClass.AddSlab(GetSlotSize(ClassIndex));
+                }
+                FFreeSlot* Slot = SizeClass.FreeList;
+                SizeClass.FreeList = Slot->Next;
+
+                Slot->Next = Heads[ClassIndex];
+                Heads[ClassIndex] = Slot;
+                ++Counts[ClassIndex];
+            }
+        }
+
+        void Flush(int32 ClassIndex, uint32 Count)
+        {
+            if (Count == 0)
+            {
+                return;
+            }
+
+            // 떼어낼 구간 [First, Last]를 먼저 찾고 잠금은 이어 붙일 때만 잡는다
+            FFreeSlot* First = Heads[ClassIndex];
+            FFreeSlot* Last = First;
+            for (uint32 i = 1; i < Count; ++i)
+            {
+                Last = Last->Next;
+            }
+            Heads[ClassIndex] = Last->Next;
+            Counts[ClassIndex] -= Count;
+
+            FSizeClass& SizeClass = GetPoolState().Classes[ClassIndex];
+            std::lock_guard<std::mutex> Lock(SizeClass.Lock);
+            Last->Next = SizeClass.FreeList;
+            SizeClass.FreeList = First;
+        }
+    };
+
+    // 스레드 종료 시 캐시에 남은 슬롯을 전역 free list로 돌려준다
+    struct FObjectPoolThreadCacheFlusher
+    {
+        ~FObjectPoolThreadCacheFlusher();
+    };
+
+    FObjectPoolThreadCache& GetThreadCache()
+    {
+        // 캐시 자체는 소멸자가 없어 종료 과정 어디서든 접근해도 안전하다
+        thread_local FObjectPoolThreadCache Cache;
+        thread_local FObjectPoolThreadCacheFlusher Flusher;
+        return Cache;
+    }
+
+    FObjectPoolThreadCacheFlusher::~FObjectPoolThreadCacheFlusher()
+    {
+        GetThreadCache().FlushAll();
+    }
+}
+
+void* FObjectPool::Allocate(SIZE_T Size)
+{
+    if (Size > MaxPooledSize)
+    {
+        return FMemoryManager::Allocate(Size, alignof(std::max_align_t), EMemoryTag::Objects);
+    }
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    const int32 ClassIndex = GetSizeClassIndex(Size);
+    FObjectPoolThreadCache& Cache = GetThreadCache();
+    if (!Cache.Heads[ClassIndex])
+    {
+        Cache.Refill(ClassIndex);
+    }
+
+    FFreeSlot* Slot = Cache.Heads[ClassIndex];
+    Cache.Heads[ClassIndex] = Slot->Next;
+    --Cache.Counts[ClassIndex];
+
+    GetPoolState().Classes[ClassIndex].NumLive.fetch_add(1, std::memory_order_relaxed);
+    FMemoryManager::TrackAllocation(EMemoryTag::Objects, Size);
+
+#if defined(_DEBUG)
+    memset(Slot, AllocatedPoison, GetSlotSize(ClassIndex));
+#endif
+    return Slot;
+}
+
+void FObjectPool::Free(void* Ptr, SIZE_T Size)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+    if (Size > MaxPooledSize)
+    {
+        FMemoryManager::Deallocate(Ptr);
+        return;
+    }
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    const int32 ClassIndex = GetSizeClassIndex(Size);
+
+#if defined(_DEBUG)
+    memset(Ptr, FreedPoison, GetSlotSize(ClassIndex));
+#endif
+
+    FObjectPoolThreadCache& Cache = GetThreadCache();
+    FFreeSlot* Slot = static_cast<FFreeSlot*>(Ptr);
+    Slot->Next = Cache.Heads[ClassIndex];
+    Cache.Heads[ClassIndex] = Slot;
+    ++Cache.Counts[ClassIndex];
+
+    // 캐시가 너무 커지면 절반을 전역 free list로 돌려준다
+    const uint32 BatchCount = GetBatchCount(ClassIndex);
+    if (Cache.Counts[ClassIndex] > BatchCount * 2)
+    {
+        Cache.Flush(ClassIndex, BatchCount);
+    }
+
+    GetPoolState().Classes[ClassIndex].NumLive.fetch_sub(1, std::memory_order_relaxed);
+    FMemoryManager::TrackFree(EMemoryTag::Objects, Size);
+}
+
+FObjectPool::FStats FObjectPool::GetStats()
+{
+    FStats Stats;
+    FObjectPoolState& State = GetPoolState();
+    for (int32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+    {
+        const FSizeClass& SizeClass = State.Classes[ClassIndex];
+        const uint32 NumSlabs = SizeClass.NumSlabs.load(std::memory_order_relaxed);
+        const uint32 NumLive = SizeClass.NumLive.load(std::memory_order_relaxed);
+
+        Stats.NumSlabs += NumSlabs;
+        Stats.NumLive += NumLive;
+        Stats.ReservedBytes += static_cast<SIZE_T>(NumSlabs) * SlabSize;
+        Stats.UsedBytes += static_cast<SIZE_T>(NumLive) * GetSlotSize(ClassIndex);
+    }
+    return Stats;
+}
+
+void FObjectPool::GetSizeClassStats(TArray<FSizeClassStats>& OutStats)
+{
+    OutStats.Empty();
+    FObjectPoolState& State = GetPoolState();
+    for (int32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+    {
+        const FSizeClass& SizeClass = State.Classes[ClassIndex];
+        const uint32 NumSlabs = SizeClass.NumSlabs.load(std::memory_order_relaxed);
+        if (NumSlabs == 0)
+        {
+            continue;
+        }
+
+        FSizeClassStats Stats;
+        Stats.SlotSize = static_cast<uint32>(GetSlotSize(ClassIndex));
+        Stats.NumSlabs = NumSlabs;
+        Stats.NumSlots = NumSlabs * static_cast<uint32>(SlabSize / Stats.SlotSize);
+        Stats.NumLive = SizeClass.NumLive.load(std::memory_order_relaxed);
+        OutStats.Add(Stats);
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief UObject 전용 크기 등급(size class) 풀 할당자
+ * - 64KB 슬랩을 크기 등급별 고정 크기 슬롯으로 잘라 쓴다 (16B 단위 ~256B, 64B 단위 ~1KB, 256B 단위 ~4KB)
+ * - 스레드마다 등급별 free list 캐시를 두어 대부분의 할당/해제에 잠금이 없다
+ * - 해제는 크기를 받아 등급을 찾으므로 sized delete로만 돌려받는다 (UObject::operator delete 참고)
+ * - MaxPooledSize를 넘는 요청은 FMemoryManager 일반 경로로 넘긴다
+ *
+ * 슬랩은 반납하지 않고 같은 등급 안에서 재사용한다. 스폰/파괴가 반복돼도 힙이 조각나지 않고,
+ * 같은 크기의 컴포넌트들은 같은 슬랩에 연속으로 놓인다.
+ */
+class FObjectPool
+{
+public:
+    static constexpr SIZE_T MaxPooledSize = 4096;
+    static constexpr SIZE_T SlabSize = 64 * 1024;
+
+    struct FSizeClassStats
+    {
+        uint32 SlotSize = 0;
+        uint32 NumSlabs = 0;
+        uint32 NumSlots = 0;
+        uint32 NumLive = 0;
+    };
+
+    struct FStats
+    {
+        SIZE_T UsedBytes = 0;       // 살아있는 객체가 차지한 슬롯 바이트
+        SIZE_T ReservedBytes = 0;   // 확보한 슬랩 총량
+        uint32 NumLive = 0;
+        uint32 NumSlabs = 0;
+    };
+
+    static void* Allocate(SIZE_T Size);
+    static void Free(void* Ptr, SIZE_T Size);
+
+    static FStats GetStats();
+    // 슬랩이 하나라도 있는 등급만 채운다
+    static void GetSizeClassStats(TArray<FSizeClassStats>& OutStats);
+};
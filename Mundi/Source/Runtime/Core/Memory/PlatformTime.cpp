@@ -1,11 +1,15 @@
 ﻿
 #include "pch.h"
 #include "PlatformTime.h"
+#include <mutex>
 
 TMap<FString, FTimeProfile> TimeProfileMap;
+// 잡 시스템 워커 스레드에서도 TIME_PROFILE을 쓰므로 맵 갱신은 잠금으로 보호
+std::mutex TimeProfileMutex;
 //Map에 이미 있으면 시간, 콜스택 추가
 void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	if (TimeProfileMap.Contains(Key.Key) == false)
 	{
 		TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
@@ -19,6 +23,7 @@ void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMillisecond
 //시간, 콜스택 초기화
 void FScopeCycleCounter::TimeProfileInit()
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	const TArray<FString> Keys = TimeProfileMap.GetKeys();
 	for (const FString& Key : Keys)
 	{
@@ -30,17 +35,23 @@ void FScopeCycleCounter::TimeProfileInit()
 //{
 //    return TimeProfileMap;
 //}
+// 워커가 동시에 AddTimeProfile을 할 수 있으므로 읽을 때도 잠그고 복사본을 돌려준다
 const TArray<FString> FScopeCycleCounter::GetTimeProfileKeys()
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	return TimeProfileMap.GetKeys();
 }
 const TArray<FTimeProfile> FScopeCycleCounter::GetTimeProfileValues()
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	return TimeProfileMap.GetValues();
 }
-const FTimeProfile& FScopeCycleCounter::GetTimeProfile(const FString& Key)
+FTimeProfile FScopeCycleCounter::GetTimeProfile(const FString& Key)
 {
-	return TimeProfileMap[Key];
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
+	// operator[]는 없는 키를 삽입하므로 Find로 읽기만 한다
+	const FTimeProfile* Found = TimeProfileMap.Find(Key);
+	return Found ? *Found : FTimeProfile{ 0.0, 0 };
 }
 double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
 bool FWindowsPlatformTime::bInitialized = false;
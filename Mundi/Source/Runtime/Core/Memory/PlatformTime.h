@@ -153,7 +153,7 @@ public:
 
 	static const TArray<FString> GetTimeProfileKeys();
 	static const TArray<FTimeProfile> GetTimeProfileValues();
-	static const FTimeProfile& GetTimeProfile(const FString& Key);
+	static FTimeProfile GetTimeProfile(const FString& Key);
 private:
 	bool bIsFinish = false;
 	uint64 StartCycles;
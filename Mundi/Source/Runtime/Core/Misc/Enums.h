@@ -265,3 +265,14 @@ enum class EWorldType : uint8
     End,
     PreviewMinimal,
 };
+
+// 틱 그룹: 그룹 사이에는 순서가 보장되고, 같은 그룹 안에서는 선행 조건이 없는 틱끼리 병렬로 돌 수 있다
+enum class ETickingGroup : uint8
+{
+    PrePhysics,         // 기본값. 이동/입력 등 물리 이전 작업
+    DuringPhysics,      // 물리(충돌/오버랩)와 같은 단계
+    PostPhysics,        // 물리 결과를 읽는 작업 (카메라, 본 부착 등)
+    PostUpdateWork,     // 프레임 마지막 정리 작업
+
+    Max
+};
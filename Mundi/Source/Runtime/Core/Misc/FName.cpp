@@ -1,62 +1,222 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    constexpr uint32 NumShards = 16;                     // 2의 거듭제곱
+    constexpr uint32 ChunkShift = 12;
+    constexpr uint32 EntriesPerChunk = 1u << ChunkShift; // 4096
+    constexpr uint32 MaxChunks = 1024;                   // 최대 약 400만 개 이름
+    constexpr uint32 EmptySlot = FName::InvalidIndex;
+
+    inline char ToLowerAscii(char C)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    bool EqualsCaseInsensitive(const FString& Lower, std::string_view InStr)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        if (Lower.size() != InStr.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            if (Lower[i] != ToLowerAscii(InStr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    /**
+     * 엔트리 저장소: 청크 포인터 테이블은 고정 크기라 재할당이 없고,
+     * 청크가 한 번 게시되면 그 안의 엔트리는 이동하지 않는다.
+     */
+    struct FNameEntryStorage
+    {
+        std::atomic<FNameEntry*> Chunks[MaxChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+        std::mutex AllocLock;
+
+        ~FNameEntryStorage()
+        {
+            for (std::atomic<FNameEntry*>& Chunk : Chunks)
+            {
+                delete[] Chunk.load();
+            }
+        }
+
+        uint32 Allocate(std::string_view InStr, uint32 InHash)
+        {
+            std::lock_guard<std::mutex> Lock(AllocLock);
+
+            const uint32 Index = NumEntries.load(std::memory_order_relaxed);
+            const uint32 ChunkIndex = Index >> ChunkShift;
+            assert(ChunkIndex < MaxChunks && "FNamePool overflow");
+
+            FNameEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+            if (!Chunk)
+            {
+                Chunk = new FNameEntry[EntriesPerChunk];
+                Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+            }
+
+            FNameEntry& Entry = Chunk[Index & (EntriesPerChunk - 1)];
+            Entry.Display.assign(InStr.data(), InStr.size());
+            Entry.Comparison.resize(InStr.size());
+            for (size_t i = 0; i < InStr.size(); ++i)
+            {
+                Entry.Comparison[i] = ToLowerAscii(InStr[i]);
+            }
+            Entry.Hash = InHash;
+
+            NumEntries.store(Index + 1, std::memory_order_release);
+            return Index;
+        }
+
+        const FNameEntry* Find(uint32 Index) const
+        {
+            if (Index >= NumEntries.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+            const FNameEntry* Chunk = Chunks[Index >> ChunkShift].load(std::memory_order_acquire);
+            return &Chunk[Index & (EntriesPerChunk - 1)];
+        }
+    };
+
+    // 샤드: 엔트리 인덱스를 담는 open addressing 테이블 (선형 탐사, 부하율 50% 이하 유지)
+    struct FNameShard
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        mutable std::shared_mutex Lock;
+        TArray<uint32> Slots;
+        uint32 NumUsed = 0;
+
+        uint32 FindLocked(const FNameEntryStorage& Storage, std::string_view InStr, uint32 InHash) const
+        {
+            if (Slots.IsEmpty())
+            {
+                return EmptySlot;
+            }
+
+            const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+            for (uint32 Slot = (InHash >> 4) & Mask; ; Slot = (Slot + 1) & Mask)
+            {
+                const uint32 EntryIndex = Slots[Slot];
+                if (EntryIndex == EmptySlot)
+                {
+                    return EmptySlot;
+                }
+
+                const FNameEntry* Entry = Storage.Find(EntryIndex);
+                if (Entry->Hash == InHash && EqualsCaseInsensitive(Entry->Comparison, InStr))
+                {
+                    return EntryIndex;
+                }
+            }
+        }
+
+        void InsertLocked(const FNameEntryStorage& Storage, uint32 EntryIndex, uint32 InHash)
+        {
+            if ((NumUsed + 1) * 2 > static_cast<uint32>(Slots.Num()))
+            {
+                Grow(Storage);
+            }
+
+            const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+            uint32 Slot = (InHash >> 4) & Mask;
+            while (Slots[Slot] != EmptySlot)
+            {
+                Slot = (Slot + 1) & Mask;
+            }
+            Slots[Slot] = EntryIndex;
+            ++NumUsed;
+        }
+
+        void Grow(const FNameEntryStorage& Storage)
+        {
+            TArray<uint32> OldSlots;
+            OldSlots.swap(Slots);
+
+            const uint32 NewSize = OldSlots.IsEmpty() ? 256u : static_cast<uint32>(OldSlots.Num()) * 2;
+            Slots.SetNum(NewSize, EmptySlot);
+
+            const uint32 Mask = NewSize - 1;
+            for (uint32 EntryIndex : OldSlots)
+            {
+                if (EntryIndex == EmptySlot)
+                {
+                    continue;
+                }
+                uint32 Slot = (Storage.Find(EntryIndex)->Hash >> 4) & Mask;
+                while (Slots[Slot] != EmptySlot)
+                {
+                    Slot = (Slot + 1) & Mask;
+                }
+                Slots[Slot] = EntryIndex;
+            }
+        }
+    };
+
+    struct FNameTable
+    {
+        FNameEntryStorage Storage;
+        FNameShard Shards[NumShards];
+    };
+
+    // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게 단 한 번만 초기화됩니다.
+    FNameTable& GetNameTable()
+    {
+        static FNameTable GTable;
+        return GTable;
     }
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::Add(std::string_view InStr)
 {
-    FString Lower = ToLower(InStr);
+    return Add(InStr, HashCaseInsensitive(InStr));
+}
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+uint32 FNamePool::Add(std::string_view InStr, uint32 InHash)
+{
+    FNameTable& Table = GetNameTable();
+    FNameShard& Shard = Table.Shards[InHash & (NumShards - 1)];
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // 대부분은 이미 있는 이름이므로 공유 잠금으로 먼저 찾는다
+    {
+        std::shared_lock<std::shared_mutex> ReadLock(Shard.Lock);
+        const uint32 Found = Shard.FindLocked(Table.Storage, InStr, InHash);
+        if (Found != EmptySlot)
+        {
+            return Found;
+        }
+    }
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    std::unique_lock<std::shared_mutex> WriteLock(Shard.Lock);
+    const uint32 Found = Shard.FindLocked(Table.Storage, InStr, InHash);
+    if (Found != EmptySlot)
+    {
+        return Found;
+    }
+
+    const uint32 NewIndex = Table.Storage.Allocate(InStr, InHash);
+    Shard.InsertLocked(Table.Storage, NewIndex, InHash);
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
-
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    const FNameEntry* Entry = GetNameTable().Storage.Find(Index);
+    if (!Entry)
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
+        static FNameEntry InvalidEntry = { "Invalid", "invalid", 0 };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return *Entry;
+}
@@ -0,0 +1,338 @@
+#include "pch.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 현재 스레드가 사용하는 큐 슬롯 (워커가 아니면 -1)
+    thread_local int32 GJobSlotIndex = -1;
+}
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Initialize(uint32 InNumWorkers)
+{
+    if (IsInitialized())
+    {
+        return;
+    }
+
+    if (InNumWorkers == 0)
+    {
+        const uint32 HardwareThreads = std::thread::hardware_concurrency();
+        InNumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+    }
+
+    bStopping = false;
+    QueuedJobCount = 0;
+    SleepingWorkers = 0;
+
+    Queues.Empty();
+    StatSlots.Empty();
+    for (uint32 Slot = 0; Slot < InNumWorkers + 1; ++Slot)
+    {
+        Queues.Emplace(std::make_unique<FWorkerQueue>());
+        StatSlots.Emplace(std::make_unique<FWorkerStatSlot>());
+    }
+    LastFrameStats.SetNum(static_cast<int32>(InNumWorkers) + 1);
+
+    NumWorkers = InNumWorkers;
+    Workers.Reserve(NumWorkers);
+    for (uint32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+    {
+        Workers.emplace_back(&FJobSystem::WorkerMain, this, WorkerIndex);
+    }
+
+    UE_LOG("JobSystem: %u worker threads", NumWorkers);
+}
+
+void FJobSystem::Shutdown()
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(SleepMutex);
+        bStopping = true;
+    }
+    SleepCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.Empty();
+
+    // 워커 종료 후 외부 슬롯에 남은 작업은 호출 스레드에서 마저 처리
+    FJob Job;
+    while (TryGetJob(NumWorkers, Job))
+    {
+        ExecuteJob(Job, NumWorkers);
+    }
+
+    NumWorkers = 0;
+    Queues.Empty();
+    StatSlots.Empty();
+}
+
+bool FJobSystem::IsInWorkerThread() const
+{
+    return GJobSlotIndex >= 0 && static_cast<uint32>(GJobSlotIndex) < NumWorkers;
+}
+
+uint32 FJobSystem::GetCurrentSlot() const
+{
+    return IsInWorkerThread() ? static_cast<uint32>(GJobSlotIndex) : NumWorkers;
+}
+
+void FJobSystem::Dispatch(std::function<void()> Function, FJobCounter* Counter, const char* StatName)
+{
+    if (Counter)
+    {
+        Counter->Pending.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    PushJob(FJob{ std::move(Function), Counter, StatName });
+}
+
+void FJobSystem::DispatchAfter(FJobCounter& Prerequisite, std::function<void()> Function, FJobCounter* Counter, const char* StatName)
+{
+    if (Counter)
+    {
+        Counter->Pending.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    FJob Job{ std::move(Function), Counter, StatName };
+    {
+        // 선행 카운터가 아직 남아 있으면 후속 목록에 걸어두고, 완료한 쪽이 풀어준다
+        std::lock_guard<std::mutex> Lock(Prerequisite.ContinuationLock);
+        if (!Prerequisite.IsDone())
+        {
+            Prerequisite.Continuations.Emplace(std::move(Job));
+            return;
+        }
+    }
+
+    PushJob(std::move(Job));
+}
+
+void FJobSystem::WaitForCounter(FJobCounter& Counter)
+{
+    const uint32 Slot = GetCurrentSlot();
+    while (!Counter.IsDone())
+    {
+        FJob Job;
+        if (IsInitialized() && TryGetJob(Slot, Job))
+        {
+            ExecuteJob(Job, Slot);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // 마지막 CompleteJob이 ContinuationLock을 놓을 때까지 기다려야 카운터를 안전하게 파괴할 수 있다
+    std::lock_guard<std::mutex> Lock(Counter.ContinuationLock);
+}
+
+bool FJobSystem::TryExecuteOneJob()
+{
+    if (!IsInitialized())
+    {
+        return false;
+    }
+
+    const uint32 Slot = GetCurrentSlot();
+    FJob Job;
+    if (!TryGetJob(Slot, Job))
+    {
+        return false;
+    }
+
+    ExecuteJob(Job, Slot);
+    return true;
+}
+
+void FJobSystem::PushJob(FJob&& Job)
+{
+    // 워커가 없으면 즉시 실행
+    if (!IsInitialized())
+    {
+        ExecuteJob(Job, 0);
+        return;
+    }
+
+    FWorkerQueue& Queue = *Queues[GetCurrentSlot()];
+    {
+        std::lock_guard<std::mutex> Lock(Queue.Lock);
+        Queue.Jobs.push_back(std::move(Job));
+    }
+    QueuedJobCount.fetch_add(1, std::memory_order_release);
+
+    if (SleepingWorkers.load(std::memory_order_acquire) > 0)
+    {
+        // 잠들기 직전인 워커가 조건 확인과 wait 사이에서 알림을 놓치지 않도록 한 번 잠갔다 푼다
+        {
+            std::lock_guard<std::mutex> Lock(SleepMutex);
+        }
+        SleepCondition.notify_one();
+    }
+}
+
+bool FJobSystem::TryGetJob(uint32 SlotIndex, FJob& OutJob)
+{
+    if (QueuedJobCount.load(std::memory_order_acquire) <= 0)
+    {
+        return false;
+    }
+
+    // 1) 자기 큐: 뒤에서 꺼냄 (캐시에 남아있는 최근 작업 우선)
+    {
+        FWorkerQueue& Own = *Queues[SlotIndex];
+        std::lock_guard<std::mutex> Lock(Own.Lock);
+        if (!Own.Jobs.empty())
+        {
+            OutJob = std::move(Own.Jobs.back());
+            Own.Jobs.pop_back();
+            QueuedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    // 2) 다른 큐: 앞에서 훔침
+    const uint32 NumSlots = static_cast<uint32>(Queues.Num());
+    for (uint32 Offset = 1; Offset < NumSlots; ++Offset)
+    {
+        FWorkerQueue& Victim = *Queues[(SlotIndex + Offset) % NumSlots];
+        std::unique_lock<std::mutex> Lock(Victim.Lock, std::try_to_lock);
+        if (Lock.owns_lock() && !Victim.Jobs.empty())
+        {
+            OutJob = std::move(Victim.Jobs.front());
+            Victim.Jobs.pop_front();
+            QueuedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+            StatSlots[SlotIndex]->StealCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FJobSystem::ExecuteJob(FJob& Job, uint32 SlotIndex)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    if (Job.StatName)
+    {
+        FScopeCycleCounter JobCounter{ TStatId(Job.StatName) };
+        Job.Function();
+    }
+    else
+    {
+        Job.Function();
+    }
+
+    if (SlotIndex < static_cast<uint32>(StatSlots.Num()))
+    {
+        FWorkerStatSlot& Stat = *StatSlots[SlotIndex];
+        Stat.BusyCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+        Stat.JobCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CompleteJob(Job.Counter);
+}
+
+void FJobSystem::CompleteJob(FJobCounter* Counter)
+{
+    if (!Counter)
+    {
+        return;
+    }
+
+    TArray<FJob> ReadyJobs;
+    {
+        std::lock_guard<std::mutex> Lock(Counter->ContinuationLock);
+        if (Counter->Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ReadyJobs.swap(Counter->Continuations);
+        }
+    }
+
+    for (FJob& Job : ReadyJobs)
+    {
+        PushJob(std::move(Job));
+    }
+}
+
+void FJobSystem::WorkerMain(uint32 WorkerIndex)
+{
+    GJobSlotIndex = static_cast<int32>(WorkerIndex);
+
+    while (true)
+    {
+        FJob Job;
+        if (TryGetJob(WorkerIndex, Job))
+        {
+            ExecuteJob(Job, WorkerIndex);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> Lock(SleepMutex);
+        if (bStopping && QueuedJobCount.load(std::memory_order_acquire) <= 0)
+        {
+            break;
+        }
+
+        SleepingWorkers.fetch_add(1, std::memory_order_acq_rel);
+        SleepCondition.wait(Lock, [this]()
+        {
+            return bStopping || QueuedJobCount.load(std::memory_order_acquire) > 0;
+        });
+        SleepingWorkers.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    GJobSlotIndex = -1;
+}
+
+void FJobSystem::FlushStats()
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    for (uint32 Slot = 0; Slot < static_cast<uint32>(StatSlots.Num()); ++Slot)
+    {
+        FWorkerStatSlot& Stat = *StatSlots[Slot];
+        FJobWorkerStats& Out = LastFrameStats[Slot];
+        Out.BusyMs = FPlatformTime::ToMilliseconds(Stat.BusyCycles.exchange(0, std::memory_order_relaxed));
+        Out.JobCount = Stat.JobCount.exchange(0, std::memory_order_relaxed);
+        Out.StealCount = Stat.StealCount.exchange(0, std::memory_order_relaxed);
+
+        char Key[32];
+        if (Slot < NumWorkers)
+        {
+            sprintf_s(Key, sizeof(Key), "JobWorker_%02u", Slot);
+        }
+        else
+        {
+            sprintf_s(Key, sizeof(Key), "JobWorker_Main");
+        }
+        FScopeCycleCounter::AddTimeProfile(TStatId(Key), Out.BusyMs);
+    }
+}
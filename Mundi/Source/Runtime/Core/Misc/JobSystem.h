@@ -0,0 +1,189 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <functional>
+#include <memory>
+#include "UEContainer.h"
+
+class FJobCounter;
+
+/**
+ * @brief 잡 시스템에 넣는 작업 단위
+ * StatName이 있으면 실행 구간이 FScopeCycleCounter로 TimeProfile 맵에 누적된다.
+ */
+struct FJob
+{
+    std::function<void()> Function;
+    FJobCounter* Counter = nullptr;     // 완료 시 감소시킬 카운터
+    const char* StatName = nullptr;     // TIME_PROFILE 키 (정적 문자열만)
+};
+
+/**
+ * @brief 작업 완료 카운터 (의존성 표현용)
+ * Dispatch 시 증가, 작업 완료 시 감소. 0이 되면 DispatchAfter로 걸어둔 후속 작업이 풀린다.
+ * 스택에 둔 카운터는 반드시 WaitForCounter 이후에 파괴해야 한다.
+ */
+class FJobCounter
+{
+public:
+    FJobCounter() = default;
+    FJobCounter(const FJobCounter&) = delete;
+    FJobCounter& operator=(const FJobCounter&) = delete;
+
+    bool IsDone() const { return Pending.load(std::memory_order_acquire) == 0; }
+    int32 GetPending() const { return Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class FJobSystem;
+
+    std::atomic<int32> Pending{ 0 };
+    std::mutex ContinuationLock;
+    TArray<FJob> Continuations;
+};
+
+/** 워커별 한 프레임 사용량 (FlushStats 시점에 갱신) */
+struct FJobWorkerStats
+{
+    double BusyMs = 0.0;
+    uint32 JobCount = 0;
+    uint32 StealCount = 0;
+};
+
+/**
+ * @brief 워크 스틸링 잡 시스템
+ * - 워커마다 deque 하나: 자기 큐는 뒤에서(LIFO) 꺼내고, 다른 큐는 앞에서(FIFO) 훔친다.
+ * - 워커가 아닌 스레드(게임 스레드 등)가 넣는 작업은 마지막 공용 슬롯으로 들어간다.
+ * - WaitForCounter는 대기하는 동안 큐의 작업을 직접 실행한다 (wait and help).
+ * - Initialize 전이거나 워커가 0개면 Dispatch는 호출 스레드에서 즉시 실행된다.
+ */
+class FJobSystem
+{
+public:
+    static FJobSystem& Get();
+
+    // NumWorkers가 0이면 (하드웨어 스레드 수 - 1)개 생성
+    void Initialize(uint32 InNumWorkers = 0);
+    void Shutdown();
+
+    bool IsInitialized() const { return NumWorkers > 0; }
+    uint32 GetNumWorkers() const { return NumWorkers; }
+    bool IsInWorkerThread() const;
+
+    void Dispatch(std::function<void()> Function, FJobCounter* Counter = nullptr, const char* StatName = nullptr);
+
+    // Prerequisite가 0이 된 뒤에 실행되는 작업을 예약한다
+    void DispatchAfter(FJobCounter& Prerequisite, std::function<void()> Function, FJobCounter* Counter = nullptr, const char* StatName = nullptr);
+
+    // Counter가 0이 될 때까지 큐의 작업을 대신 처리하며 대기
+    void WaitForCounter(FJobCounter& Counter);
+
+    // 큐에서 작업 하나를 꺼내 실행. 실행했으면 true
+    bool TryExecuteOneJob();
+
+    /**
+     * @brief 워커 사용량을 TimeProfile 맵으로 내보낸다 (프레임당 1회)
+     * "JobWorker_00".."JobWorker_NN", 게임 스레드가 도운 시간은 "JobWorker_Main" 키로 누적된다.
+     */
+    void FlushStats();
+    const TArray<FJobWorkerStats>& GetLastFrameStats() const { return LastFrameStats; }
+
+private:
+    FJobSystem() = default;
+    ~FJobSystem();
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+
+    struct FWorkerQueue
+    {
+        std::mutex Lock;
+        std::deque<FJob> Jobs;
+    };
+
+    struct FWorkerStatSlot
+    {
+        std::atomic<uint64> BusyCycles{ 0 };
+        std::atomic<uint32> JobCount{ 0 };
+        std::atomic<uint32> StealCount{ 0 };
+    };
+
+    void WorkerMain(uint32 WorkerIndex);
+    uint32 GetCurrentSlot() const;
+
+    void PushJob(FJob&& Job);
+    bool TryGetJob(uint32 SlotIndex, FJob& OutJob);
+    void ExecuteJob(FJob& Job, uint32 SlotIndex);
+    void CompleteJob(FJobCounter* Counter);
+
+private:
+    uint32 NumWorkers = 0;
+    TArray<std::thread> Workers;
+    TArray<std::unique_ptr<FWorkerQueue>> Queues;       // NumWorkers + 1 (마지막은 외부 스레드용)
+    TArray<std::unique_ptr<FWorkerStatSlot>> StatSlots; // Queues와 동일한 인덱스
+    TArray<FJobWorkerStats> LastFrameStats;
+
+    std::atomic<int32> QueuedJobCount{ 0 };
+    std::atomic<int32> SleepingWorkers{ 0 };
+    std::atomic<bool> bStopping{ false };
+    std::mutex SleepMutex;
+    std::condition_variable SleepCondition;
+};
+
+/**
+ * @brief [0, Num) 구간을 GrainSize 단위 청크로 나눠 병렬 실행
+ * 청크는 원자 인덱스로 동적으로 분배되고, 호출 스레드도 청크를 처리한 뒤 나머지를 기다린다.
+ * Body 시그니처: void(int32 Index)
+ */
+template<typename FuncType>
+void ParallelFor(int32 Num, FuncType&& Body, int32 GrainSize = 1, const char* StatName = nullptr)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    FJobSystem& JobSystem = FJobSystem::Get();
+    GrainSize = GrainSize < 1 ? 1 : GrainSize;
+    const int32 NumChunks = (Num + GrainSize - 1) / GrainSize;
+
+    // 청크가 하나뿐이거나 워커가 없으면 직렬 실행
+    if (NumChunks <= 1 || !JobSystem.IsInitialized())
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+        return;
+    }
+
+    std::atomic<int32> NextChunk{ 0 };
+    auto RunChunks = [&]()
+    {
+        for (int32 Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed); Chunk < NumChunks;
+             Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            const int32 Begin = Chunk * GrainSize;
+            const int32 End = (Begin + GrainSize < Num) ? Begin + GrainSize : Num;
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                Body(Index);
+            }
+        }
+    };
+
+    // 호출 스레드도 참여하므로 (청크 수 - 1)개까지만 워커에 던진다
+    const int32 NumHelpers = (NumChunks - 1 < static_cast<int32>(JobSystem.GetNumWorkers()))
+        ? NumChunks - 1
+        : static_cast<int32>(JobSystem.GetNumWorkers());
+
+    FJobCounter Counter;
+    for (int32 Helper = 0; Helper < NumHelpers; ++Helper)
+    {
+        JobSystem.Dispatch(RunChunks, &Counter, StatName);
+    }
+
+    RunChunks();
+    JobSystem.WaitForCounter(Counter);
+}
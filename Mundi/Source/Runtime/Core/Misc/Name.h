@@ -3,6 +3,7 @@
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
+#include <string_view>
 #include"UEContainer.h"
 // ──────────────────────────────
 // FNameEntry & Pool
@@ -11,13 +12,35 @@ struct FNameEntry
 {
     FString Display;    // 원문
     FString Comparison; // lower-case
+    uint32 Hash = 0;    // 대소문자 무시 해시
 };
 
+/**
+ * @brief 스레드 안전 이름 테이블
+ * - 대소문자 무시 해시로 샤드를 고르고, 샤드별 open addressing 테이블에서 찾는다 (조회 시 할당 없음)
+ * - 엔트리는 고정 크기 청크에 저장되어 주소가 바뀌지 않으므로 Get()은 잠금 없이 참조를 돌려준다
+ * - 새 이름 추가만 해당 샤드를 배타적으로 잠근다
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
+
+    // ASCII 대소문자 무시 FNV-1a (리터럴이면 컴파일 타임에 계산 가능)
+    static constexpr uint32 HashCaseInsensitive(std::string_view InStr)
+    {
+        uint32 Hash = 2166136261u;
+        for (char C : InStr)
+        {
+            const char Lower = (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+            Hash ^= static_cast<uint8>(Lower);
+            Hash *= 16777619u;
+        }
+        return Hash;
+    }
+
+    static uint32 Add(std::string_view InStr, uint32 InHash);
 };
 
 // ──────────────────────────────
@@ -31,12 +54,13 @@ struct FName
     uint32 ComparisonIndex = InvalidIndex;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(std::string_view(InStr)); }
+    FName(const FString& InStr) { Init(std::string_view(InStr)); }
+    explicit FName(std::string_view InStr) { Init(InStr); }
 
-    void Init(const FString& InStr)
+    void Init(std::string_view InStr)
     {
-        int32_t Index = FNamePool::Add(InStr);
+        uint32 Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
@@ -48,7 +72,10 @@ struct FName
     }
 
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+
+    // 풀 엔트리는 이동하지 않으므로 복사 없이 참조/뷰를 돌려준다
+    const FString& ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    std::string_view ToStringView() const { return FNamePool::Get(DisplayIndex).Display; }
 
     friend FName operator+(const FName& A, const FName& B)
     {
@@ -66,6 +93,15 @@ struct FName
     }
 };
 
+// 문자열 리터럴 FName을 호출 지점마다 한 번만 만들어 캐시 (해시는 컴파일 타임에 계산)
+#define FNAME_STATIC(Literal) \
+    ([]() -> const FName& \
+    { \
+        static constexpr uint32 LiteralHash = FNamePool::HashCaseInsensitive(Literal); \
+        static const FName CachedName = []() { FName Name; Name.DisplayIndex = Name.ComparisonIndex = FNamePool::Add(Literal, LiteralHash); return Name; }(); \
+        return CachedName; \
+    }())
+
 // --- FName을 위한 std::hash 특수화 ---
 namespace std
 {
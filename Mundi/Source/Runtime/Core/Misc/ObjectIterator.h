@@ -2,19 +2,28 @@
 
 #include "ObjectFactory.h"
 
+/**
+ * @brief TObject와 파생 클래스의 객체만 훑는 반복자
+ * GUObjectArray 전체를 IsA로 검사하지 않고, 클래스별 객체 슬롯 목록(UClass::InstanceSlots)을 직접 훑는다 (할당/정렬 없음).
+ * 방문 순서는 클래스별, 클래스 안에서는 목록의 뒤에서부터이며 GUObjectArray 순서와는 무관하다.
+ * 클래스 목록은 삭제 시 마지막 원소를 빈 자리로 옮기므로, 뒤에서부터 훑으면 현재 객체를 삭제해도 건너뛰는 객체가 없다.
+ * 반복 중 생성된 객체(목록 끝에 추가)는 방문하지 않는다. 아직 방문하지 않은 다른 객체를 삭제하면 이미 방문한 객체를 한 번 더 볼 수 있다.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
+		: Classes(TObject::StaticClass()->GetDerivedClasses())
 	{
-		++(*this); // 첫 번째 유효 객체로 이동
+		BeginClass();
+		AdvanceToNextValidObject(); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		--Position;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +31,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 CurrentObject는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(CurrentObject);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +44,59 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return CurrentObject != Other.CurrentObject;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		return CurrentObject != nullptr;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 클래스 목록의 마지막 원소부터 시작
+	void BeginClass()
+	{
+		Position = ClassIndex < Classes.Num() ? Classes[ClassIndex]->InstanceSlots.Num() - 1 : -1;
+	}
+
+	// 현재 위치부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (ClassIndex < Classes.Num())
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			const TArray<int32>& Slots = Classes[ClassIndex]->InstanceSlots;
+
+			// 반복 중 여러 객체가 삭제되어 목록이 줄었으면 끝으로 당김
+			if (Position >= Slots.Num())
+			{
+				Position = Slots.Num() - 1;
+			}
+
+			if (Position >= 0)
 			{
-				break;
+				const int32 Slot = Slots[Position];
+				if (Slot < GUObjectArray.Num())
+				{
+					if (UObject* Obj = GUObjectArray[Slot])
+					{
+						CurrentObject = Obj;
+						return;
+					}
+				}
+				--Position;
+				continue;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			++ClassIndex;
+			BeginClass();
 		}
+		CurrentObject = nullptr;
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	const TArray<const UClass*>& Classes;
+	int32 ClassIndex = 0;
+	int32 Position = -1;
+	UObject* CurrentObject = nullptr;
 };
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Archive.h"
 #include "Vector.h"
+#include "FlatHashMap.h"
 
 // 직렬화 포맷 (FVertexDynamic와 역할이 달라서 분리됨)
 struct FNormalVertex
@@ -279,11 +280,13 @@ struct FSkeleton
 {
     FString Name; // 스켈레톤 이름
     TArray<FBone> Bones; // 본 배열
-    TMap <FString, int32> BoneNameToIndex; // 이름으로 본 검색
+    TFlatMap<FString, int32> BoneNameToIndex; // 이름으로 본 검색
 
     // Phase 1.5 최적화: 캐시된 데이터
     TArray<FTransform> RefLocalPose;      // 로컬 스페이스 RefPose 캐시 (성능 최적화)
     TArray<int32> ParentIndices;          // 부모 인덱스 배열 캐시 (캐시 친화적)
+    TArray<int32> BonesByDepth;           // 계층 깊이 순으로 정렬한 본 인덱스 (같은 깊이끼리 배치 합성)
+    TArray<int32> DepthLevelStarts;       // 깊이 d의 본 = BonesByDepth[DepthLevelStarts[d], DepthLevelStarts[d + 1])
     bool bCacheInitialized;               // 캐시 초기화 여부
 
     FSkeleton()
@@ -383,6 +386,41 @@ struct FSkeleton
             RefLocalPose[BoneIndex] = FTransform(LocalBindMatrix);
         }
 
+        // 3. 깊이별 본 목록 생성 (FTransformBatch::ComposeIndexed로 한 단계씩 합성)
+        TArray<int32> BoneDepths;
+        BoneDepths.SetNum(NumBones);
+        int32 MaxDepth = 0;
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            int32 Depth = 0;
+            int32 ParentIndex = ParentIndices[BoneIndex];
+            while (ParentIndex >= 0 && ParentIndex < NumBones && Depth < NumBones)
+            {
+                ++Depth;
+                ParentIndex = ParentIndices[ParentIndex];
+            }
+            BoneDepths[BoneIndex] = Depth;
+            MaxDepth = std::max(MaxDepth, Depth);
+        }
+
+        DepthLevelStarts.Empty();
+        DepthLevelStarts.SetNum(MaxDepth + 2, 0);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            ++DepthLevelStarts[BoneDepths[BoneIndex] + 1];
+        }
+        for (int32 Depth = 1; Depth < DepthLevelStarts.Num(); ++Depth)
+        {
+            DepthLevelStarts[Depth] += DepthLevelStarts[Depth - 1];
+        }
+
+        BonesByDepth.SetNum(NumBones);
+        TArray<int32> WriteOffsets = DepthLevelStarts;
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            BonesByDepth[WriteOffsets[BoneDepths[BoneIndex]]++] = BoneIndex;
+        }
+
         bCacheInitialized = true;
     }
 
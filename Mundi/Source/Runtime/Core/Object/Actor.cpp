@@ -11,6 +11,7 @@
 #include "World.h"
 #include "PrimitiveComponent.h"
 #include "GameObject.h"
+#include "TickTaskManager.h"
 #include "Source/Runtime/Engine/Animation/AnimationTypes.h"
 
 /*BEGIN_PROPERTIES(AActor)
@@ -61,13 +62,270 @@ void AActor::Tick(float DeltaSeconds)
 	// 에디터에서 틱 Off면 스킵
 	if (!bTickInEditor && World->bPie == false) return;
 
+	const TArray<UActorComponent*>& Components = GetTickComponents();
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		UActorComponent* Comp = Components[Index];
+
+		// 액터보다 늦은 그룹의 컴포넌트는 월드가 해당 그룹에서 따로 틱함
+		if (Comp->GetTickGroup() > TickGroup)
+		{
+			continue;
+		}
+
+		// 컴포넌트 자체 틱 주기는 액터 델타를 누적해서 처리
+		float ComponentDeltaSeconds = 0.0f;
+		if (Comp->IsComponentTickEnabled() && Comp->ConsumeTickTime(DeltaSeconds, Comp->GetTickInterval(), ComponentDeltaSeconds))
+		{
+			Comp->TickComponent(ComponentDeltaSeconds /*, … 필요 인자*/);
+		}
+
+		// 틱 도중 컴포넌트 구성이 바뀌면 남은 목록은 이미 파괴됐을 수 있으므로 다음 프레임으로 미룸
+		if (bTickComponentsDirty)
+		{
+			break;
+		}
+	}
+}
+
+bool AActor::CanTickOnAnyThread()
+{
+	if (!bAllowTickOnAnyThread)
+	{
+		return false;
+	}
+
+	for (UActorComponent* Comp : GetTickComponents())
+	{
+		// 꺼진 컴포넌트도 검사: 틱 목록은 on/off마다 다시 만들지 않으므로 보수적으로 판단
+		if (Comp->GetTickGroup() <= TickGroup && !Comp->CanTickOnAnyThread())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool AActor::NeedsTickFunction(bool bIsPie)
+{
+	if (!bCanEverTick || IsPendingDestroy())
+	{
+		return false;
+	}
+	if (!bTickInEditor && !bIsPie)
+	{
+		return false;
+	}
+	return !bTickOnlyWithComponents || !GetTickComponents().IsEmpty();
+}
+
+bool AActor::ConsumeTickTime(float DeltaSeconds, float Interval, float& OutDeltaSeconds)
+{
+	if (Interval <= 0.0f && TickAccumulatedSeconds == 0.0f)
+	{
+		OutDeltaSeconds = DeltaSeconds;
+		return true;
+	}
+
+	TickAccumulatedSeconds += DeltaSeconds;
+	if (TickAccumulatedSeconds < Interval)
+	{
+		return false;
+	}
+
+	OutDeltaSeconds = TickAccumulatedSeconds;
+	TickAccumulatedSeconds = 0.0f;
+	return true;
+}
+
+void AActor::SetAllowTickThrottling(bool bInAllow)
+{
+	if (bAllowTickThrottling != bInAllow)
+	{
+		bAllowTickThrottling = bInAllow;
+		NotifyTickStateChanged();
+	}
+}
+
+bool AActor::CanThrottleTick()
+{
+	if (!bAllowTickThrottling)
+	{
+		return false;
+	}
+
+	// 함께 틱하는 컴포넌트 중 하나라도 매 프레임이 필요하면 액터 전체를 유지
+	bool bHasThrottleableWork = false;
+	for (UActorComponent* Comp : GetTickComponents())
+	{
+		if (Comp->GetTickGroup() > TickGroup)
+		{
+			continue;
+		}
+		if (!Comp->CanThrottleTick())
+		{
+			return false;
+		}
+		bHasThrottleableWork = true;
+	}
+	return bHasThrottleableWork;
+}
+
+void AActor::SetTickInEditor(bool b)
+{
+	if (bTickInEditor != b)
+	{
+		bTickInEditor = b;
+		NotifyTickStateChanged();
+	}
+}
+
+void AActor::SetTickGroup(ETickingGroup InGroup)
+{
+	if (TickGroup != InGroup)
+	{
+		TickGroup = InGroup;
+		NotifyTickStateChanged();
+	}
+}
+
+void AActor::SetAllowTickOnAnyThread(bool bInAllow)
+{
+	if (bAllowTickOnAnyThread != bInAllow)
+	{
+		bAllowTickOnAnyThread = bInAllow;
+		NotifyTickStateChanged();
+	}
+}
+
+void AActor::AddTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+	if (!PrerequisiteActor || PrerequisiteActor == this)
+	{
+		return;
+	}
+	TickPrerequisiteActors.AddUnique(TWeakObjectPtr<AActor>(PrerequisiteActor));
+	NotifyTickStateChanged();
+}
+
+void AActor::AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+	if (!PrerequisiteComponent || PrerequisiteComponent->GetOwner() == this)
+	{
+		return;
+	}
+	TickPrerequisiteComponents.AddUnique(TWeakObjectPtr<UActorComponent>(PrerequisiteComponent));
+	NotifyTickStateChanged();
+}
+
+void AActor::RemoveTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+	TickPrerequisiteActors.Remove(TWeakObjectPtr<AActor>(PrerequisiteActor));
+	NotifyTickStateChanged();
+}
+
+void AActor::RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+	TickPrerequisiteComponents.Remove(TWeakObjectPtr<UActorComponent>(PrerequisiteComponent));
+	NotifyTickStateChanged();
+}
+
+void AActor::MarkTickComponentsDirty()
+{
+	bTickComponentsDirty = true;
+	NotifyTickStateChanged();
+}
+
+void AActor::NotifyTickStateChanged()
+{
+	// 생성자/복제 중에는 아직 월드가 없음 (월드 등록 시 목록에 반영됨)
+	if (World && World->GetTickTaskManager())
+	{
+		World->GetTickTaskManager()->MarkTickListDirty();
+	}
+}
+
+const TArray<UActorComponent*>& AActor::GetTickComponents()
+{
+	if (bTickComponentsDirty)
+	{
+		RebuildTickComponents();
+	}
+	return TickComponents;
+}
+
+void AActor::RebuildTickComponents()
+{
+	bTickComponentsDirty = false;
+	TickComponents.Empty();
+
+	bool bHasLocalPrerequisite = false;
 	for (UActorComponent* Comp : OwnedComponents)
 	{
-		if (Comp && Comp->IsComponentTickEnabled())
+		if (Comp && Comp->CanEverTick())
+		{
+			TickComponents.Add(Comp);
+			bHasLocalPrerequisite |= !Comp->GetTickPrerequisiteComponents().IsEmpty();
+		}
+	}
+
+	if (!bHasLocalPrerequisite)
+	{
+		return;
+	}
+
+	// 같은 액터 안의 선행 컴포넌트가 먼저 오도록 정렬 (다른 액터의 컴포넌트는 월드가 처리)
+	auto IsLocalTickComponent = [this](const UActorComponent* Comp)
+	{
+		return std::find(TickComponents.begin(), TickComponents.end(), Comp) != TickComponents.end();
+	};
+
+	TArray<UActorComponent*> Sorted;
+	Sorted.Reserve(TickComponents.Num());
+	TSet<UActorComponent*> Placed;
+	while (Sorted.Num() < TickComponents.Num())
+	{
+		const int32 PlacedBefore = Sorted.Num();
+		for (UActorComponent* Comp : TickComponents)
 		{
-			Comp->TickComponent(DeltaSeconds /*, … 필요 인자*/);
+			if (Placed.Contains(Comp))
+			{
+				continue;
+			}
+
+			bool bReady = true;
+			for (const TWeakObjectPtr<UActorComponent>& Prerequisite : Comp->GetTickPrerequisiteComponents())
+			{
+				UActorComponent* PrerequisiteComp = Prerequisite.Get();
+				if (IsLocalTickComponent(PrerequisiteComp) && !Placed.Contains(PrerequisiteComp))
+				{
+					bReady = false;
+					break;
+				}
+			}
+
+			if (bReady)
+			{
+				Sorted.Add(Comp);
+				Placed.Add(Comp);
+			}
+		}
+
+		// 순환 의존: 남은 컴포넌트는 기존 순서대로 배치
+		if (Sorted.Num() == PlacedBefore)
+		{
+			for (UActorComponent* Comp : TickComponents)
+			{
+				if (!Placed.Contains(Comp))
+				{
+					Sorted.Add(Comp);
+					Placed.Add(Comp);
+				}
+			}
 		}
 	}
+
+	TickComponents = std::move(Sorted);
 }
 
 void AActor::EndPlay()
@@ -100,6 +358,13 @@ void AActor::Destroy()
 		return;
 	}
 
+	// 병렬 틱 중에는 (잡을 돕는 게임 스레드에서도) 월드 목록을 건드리지 않고 게임 스레드 단계로 미룸
+	if (World && World->IsTickingInParallel())
+	{
+		World->EnqueueGameThreadTask([this]() { Destroy(); });
+		return;
+	}
+
 	MarkPendingDestroy();
 
 	World->AddPendingKillActor(this);
@@ -191,6 +456,7 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 	}
 
 	OwnedComponents.insert(Component);
+	MarkTickComponentsDirty();
 	Component->SetOwner(this);
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
@@ -242,6 +508,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 
 	// OwnedComponents에서 제거
 	OwnedComponents.erase(Component);
+	MarkTickComponentsDirty();
 
 	Component->DestroyComponent();
 }
@@ -298,6 +565,7 @@ void AActor::DestroyAllComponents()
 		C->DestroyComponent(); // 내부에서 등록 해제도 처리
 	}
 	OwnedComponents.Empty();
+	MarkTickComponentsDirty();
 
 	SceneComponents.Empty();
 	RootComponent = nullptr;
@@ -601,6 +869,11 @@ void AActor::DuplicateSubObjects()
 	bIsCulled = false;
 	World = nullptr; // PIE World는 복제 프로세스의 상위 레벨에서 설정해 주어야 합니다.
 
+	// 틱 선행 조건은 원본 월드의 객체를 가리키므로 복제하지 않음
+	TickPrerequisiteActors.Empty();
+	TickPrerequisiteComponents.Empty();
+	MarkTickComponentsDirty();
+
 	if (OwnedComponents.IsEmpty())
 	{
 		return; // 복제할 컴포넌트가 없으면 종료
@@ -636,6 +909,7 @@ void AActor::DuplicateSubObjects()
 
 	// 복제된 컴포넌트 목록으로 교체합니다.
 	OwnedComponents = NewOwnedComponents;
+	MarkTickComponentsDirty();
 
 	// ========================================================================
 	// 2단계: 매핑 테이블을 이용해 씬 계층 구조 재구성
@@ -710,15 +984,24 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		JSON ComponentsJson;
 		if (FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
 		{
+			// 0) 컴포넌트 타입을 한 번에 조회
+			TArray<FString> TypeStrings;
+			for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
+			{
+				FString TypeString;
+				FJsonSerializer::ReadString(ComponentsJson[i], "Type", TypeString);
+				TypeStrings.Add(TypeString);
+			}
+
+			TArray<UClass*> ComponentClasses;
+			UClass::FindClasses(TypeStrings, ComponentClasses);
+
 			// 1) OwnedComponents와 SceneComponents에 Component들 추가
 			for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
 			{
 				JSON ComponentJson = ComponentsJson.at(i);
 
-				FString TypeString;
-				FJsonSerializer::ReadString(ComponentJson, "Type", TypeString);
-
-				UClass* NewClass = UClass::FindClass(TypeString);
+				UClass* NewClass = ComponentClasses[i];
 
 				UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
 
@@ -126,9 +126,43 @@ public:
     void MarkPartitionDirty();
 
     // 틱 플래그
-    void SetTickInEditor(bool b) { bTickInEditor = b; }
+    void SetTickInEditor(bool b);
     bool GetTickInEditor() const { return bTickInEditor; }
 
+    // 틱 그룹/선행 조건 (월드의 FTickTaskManager가 스케줄링)
+    void SetTickGroup(ETickingGroup InGroup);
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    // 틱 주기 (0이면 매 프레임). 건너뛴 프레임의 델타는 누적돼 다음 틱에 한 번에 전달된다
+    void SetTickInterval(float InInterval) { TickInterval = InInterval > 0.0f ? InInterval : 0.0f; }
+    float GetTickInterval() const { return TickInterval; }
+    // 누적 시간에 DeltaSeconds를 더하고 Interval 이상이면 누적분을 꺼내 true (FTickTaskManager 전용)
+    bool ConsumeTickTime(float DeltaSeconds, float Interval, float& OutDeltaSeconds);
+
+    // 액터 Tick과 함께 틱하는 컴포넌트가 모두 빈도 조절을 허용해야 true
+    void SetAllowTickThrottling(bool bInAllow);
+    bool CanThrottleTick();
+
+    void SetAllowTickOnAnyThread(bool bInAllow);
+    // 액터 Tick 자체와 함께 틱하는 컴포넌트가 모두 워커 스레드에서 안전해야 true
+    bool CanTickOnAnyThread();
+
+    void AddTickPrerequisiteActor(AActor* PrerequisiteActor);
+    void AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    void RemoveTickPrerequisiteActor(AActor* PrerequisiteActor);
+    void RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    const TArray<TWeakObjectPtr<AActor>>& GetTickPrerequisiteActors() const { return TickPrerequisiteActors; }
+    const TArray<TWeakObjectPtr<UActorComponent>>& GetTickPrerequisiteComponents() const { return TickPrerequisiteComponents; }
+    bool HasTickPrerequisites() const { return !TickPrerequisiteActors.IsEmpty() || !TickPrerequisiteComponents.IsEmpty(); }
+
+    // 틱 가능한 컴포넌트 목록 (컴포넌트 간 선행 조건 순서로 정렬, 구성 변경 시 재생성)
+    const TArray<UActorComponent*>& GetTickComponents();
+    // 컴포넌트 구성/틱 설정이 바뀌면 호출. 월드 틱 목록도 다음 프레임에 다시 만든다
+    void MarkTickComponentsDirty();
+
+    // 월드 틱 목록에 올라갈 필요가 있는지 (활성 여부는 실행 시점에 따로 확인)
+    bool NeedsTickFunction(bool bIsPie);
+
     float GetCustomTimeDillation();
     void  SetCustomTimeDillation(float Duration, float Dillation);
 
@@ -203,6 +237,15 @@ protected:
 
     bool bTickInEditor = false; // 에디터에서도 틱 허용
 
+    ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+    bool bAllowTickOnAnyThread = false;   // 파생 클래스 Tick이 게임 스레드 전용 작업을 하지 않을 때만 켤 것
+    bool bTickOnlyWithComponents = false; // 액터 Tick 자체는 할 일이 없어 틱 컴포넌트가 있을 때만 틱 목록에 등록
+    bool bAllowTickThrottling = false;    // 중요도 매니저의 빈도 조절 허용 (입력/카메라 등 매 프레임 필요한 액터는 끌 것)
+    float TickInterval = 0.0f;
+    float TickAccumulatedSeconds = 0.0f;
+    TArray<TWeakObjectPtr<AActor>> TickPrerequisiteActors;
+    TArray<TWeakObjectPtr<UActorComponent>> TickPrerequisiteComponents;
+
     // Actor의 Visibility는 루트 컴포넌트로 설정
     bool bHiddenInEditor = false;
 
@@ -215,5 +258,11 @@ protected:
     float CustomTimeDillation;
 
 private:
+    void RebuildTickComponents();
+    void NotifyTickStateChanged();
+
     FGameObject* LuaGameObject = nullptr;
+
+    TArray<UActorComponent*> TickComponents;  // OwnedComponents 중 CanEverTick인 것만
+    bool bTickComponentsDirty = true;
 };
@@ -98,6 +98,122 @@ void UActorComponent::TickComponent(float DeltaTime)
     // 매 프레임 처리
 }
 
+void UActorComponent::SetTickGroup(ETickingGroup InGroup)
+{
+    if (TickGroup == InGroup)
+    {
+        return;
+    }
+
+    TickGroup = InGroup;
+
+    // 월드 틱 목록에서 이 컴포넌트가 속한 노드/그룹이 바뀜
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+void UActorComponent::SetTickOnAnyThread(bool bInAnyThread)
+{
+    if (bTickOnAnyThread == bInAnyThread)
+    {
+        return;
+    }
+
+    bTickOnAnyThread = bInAnyThread;
+
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+void UActorComponent::SetAllowTickThrottling(bool bInAllow)
+{
+    if (bAllowTickThrottling == bInAllow)
+    {
+        return;
+    }
+
+    bAllowTickThrottling = bInAllow;
+
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+bool UActorComponent::ConsumeTickTime(float DeltaSeconds, float Interval, float& OutDeltaSeconds)
+{
+    if (Interval <= 0.0f && TickAccumulatedSeconds == 0.0f)
+    {
+        OutDeltaSeconds = DeltaSeconds;
+        return true;
+    }
+
+    TickAccumulatedSeconds += DeltaSeconds;
+    if (TickAccumulatedSeconds < Interval)
+    {
+        return false;
+    }
+
+    OutDeltaSeconds = TickAccumulatedSeconds;
+    TickAccumulatedSeconds = 0.0f;
+    return true;
+}
+
+void UActorComponent::AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+    if (!PrerequisiteComponent || PrerequisiteComponent == this)
+    {
+        return;
+    }
+
+    TickPrerequisiteComponents.AddUnique(TWeakObjectPtr<UActorComponent>(PrerequisiteComponent));
+
+    // 같은 액터 안의 컴포넌트 틱 순서가 바뀔 수 있음
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+void UActorComponent::AddTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+    if (!PrerequisiteActor || PrerequisiteActor == Owner)
+    {
+        return;
+    }
+
+    TickPrerequisiteActors.AddUnique(TWeakObjectPtr<AActor>(PrerequisiteActor));
+
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+void UActorComponent::RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+    TickPrerequisiteComponents.Remove(TWeakObjectPtr<UActorComponent>(PrerequisiteComponent));
+
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
+void UActorComponent::RemoveTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+    TickPrerequisiteActors.Remove(TWeakObjectPtr<AActor>(PrerequisiteActor));
+
+    if (Owner)
+    {
+        Owner->MarkTickComponentsDirty();
+    }
+}
+
 // Override시 Super::EndPlay() 권장
 void UActorComponent::EndPlay()
 {
@@ -113,6 +229,10 @@ void UActorComponent::DuplicateSubObjects()
     Super::DuplicateSubObjects();
 
     Owner = nullptr; // Actor에서 이거 설정해 줌
+
+    // 선행 조건은 원본 월드의 객체를 가리키므로 복제하지 않음
+    TickPrerequisiteComponents.Empty();
+    TickPrerequisiteActors.Empty();
 }
 
 void UActorComponent::PostDuplicate()
@@ -31,6 +31,7 @@ public:
     void DestroyComponent();                           // 소멸
 
     // ─────────────── 활성화/틱
+    // 활성/틱 on-off는 실행 직전에 확인하므로 월드 틱 목록을 다시 만들지 않는다
     void SetActive(bool bNewActive) { bIsActive = bNewActive; }
     bool IsActive() const { return bIsActive; }
 
@@ -51,6 +52,34 @@ public:
         return bIsActive && bCanEverTick && bTickEnabled && bRegistered;
     }
 
+    // ─────────────── 틱 그룹/선행 조건
+    // 소유 액터보다 늦은 그룹이면 월드가 해당 그룹에서 따로 틱하고, 같거나 이르면 액터 틱에 포함된다
+    void SetTickGroup(ETickingGroup InGroup);
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    // 틱 주기 (0이면 매 프레임). 건너뛴 프레임의 델타는 누적돼 다음 틱에 한 번에 전달된다
+    void SetTickInterval(float InInterval) { TickInterval = InInterval > 0.0f ? InInterval : 0.0f; }
+    float GetTickInterval() const { return TickInterval; }
+    // 누적 시간에 DeltaSeconds를 더하고 Interval 이상이면 누적분을 꺼내 true (틱 실행 직전에만 호출)
+    bool ConsumeTickTime(float DeltaSeconds, float Interval, float& OutDeltaSeconds);
+
+    // 중요도 매니저가 멀리 있거나 안 보일 때 틱 빈도를 낮춰도 되는지
+    void SetAllowTickThrottling(bool bInAllow);
+    virtual bool CanThrottleTick() const { return bAllowTickThrottling; }
+
+    // 워커 스레드에서 틱해도 안전한지 (게임 스레드 전용 작업: Lua, 스폰, 오버랩 이벤트, 오디오 등)
+    void SetTickOnAnyThread(bool bInAnyThread);
+    virtual bool CanTickOnAnyThread() const { return bTickOnAnyThread; }
+
+    // 이 컴포넌트보다 먼저 틱해야 하는 대상
+    void AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    void AddTickPrerequisiteActor(AActor* PrerequisiteActor);
+    void RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    void RemoveTickPrerequisiteActor(AActor* PrerequisiteActor);
+    const TArray<TWeakObjectPtr<UActorComponent>>& GetTickPrerequisiteComponents() const { return TickPrerequisiteComponents; }
+    const TArray<TWeakObjectPtr<AActor>>& GetTickPrerequisiteActors() const { return TickPrerequisiteActors; }
+    bool HasTickPrerequisites() const { return !TickPrerequisiteComponents.IsEmpty() || !TickPrerequisiteActors.IsEmpty(); }
+
     // ─────────────── Owner/World
     void   SetOwner(AActor* InOwner) { Owner = InOwner; }
 
@@ -87,6 +116,18 @@ protected:
     // 저장되지 않는 실시간 상태 변수
     bool bRegistered = false;       // RegisterComponent가 호출됐는가
     bool bPendingDestroy = false;   // DestroyComponent 의도 플래그, NOTE: 현재 작동 안함
+
+    // 틱 스케줄링
+    ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+    // 병렬 틱 허용 (기본은 게임 스레드 전용, 예: 스켈레탈 메시 액터의 애니메이션 평가).
+    // 트랜스폼을 바꾸는 틱은 켜지 말 것: 월드 트랜스폼 캐시, 자식 더티 전파, 틱 목록 더티가 동기화되어 있지 않다.
+    // 게임 스레드 전용 호출은 UWorld::IsTickingInParallel일 때 EnqueueGameThreadTask로 미룰 것
+    bool bTickOnAnyThread = false;
+    bool bAllowTickThrottling = false;
+    float TickInterval = 0.0f;
+    float TickAccumulatedSeconds = 0.0f;
+    TArray<TWeakObjectPtr<UActorComponent>> TickPrerequisiteComponents;
+    TArray<TWeakObjectPtr<AActor>> TickPrerequisiteActors;
 public:
 	// 설정 가능한 데이터
 	UPROPERTY(EditAnywhere, Category = "렌더링")
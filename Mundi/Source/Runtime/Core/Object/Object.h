@@ -2,6 +2,7 @@
 #include "UEContainer.h"
 #include "ObjectFactory.h"
 #include "MemoryManager.h"
+#include "ObjectPool.h"
 #include "Name.h"
 #include "Property.h"
 //#include "GlobalConsole.h"
@@ -28,12 +29,32 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 정확히 이 클래스인 살아있는 객체의 GUObjectArray 슬롯 (ObjectFactory가 생성/삭제 시 갱신)
+    TArray<int32> InstanceSlots;
+    mutable TArray<const UClass*> CachedDerivedClasses; // GetDerivedClasses() 캐시 (자신 포함)
+    mutable uint32 DerivedClassesVersion = 0;           // 캐시 시점의 클래스 등록 버전
+
+    // 고정 깊이 조상 테이블 (SignUpClass 시 계산). Ancestors[d] = 깊이 d의 조상, Ancestors[Depth] = 자신
+    static constexpr int32 MaxClassDepth = 16;
+    int32 Depth = -1;                                   // -1이면 테이블 없음 (Super 체인으로 판정)
+    const UClass* Ancestors[MaxClassDepth] = {};
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
     {
     }
     bool IsChildOf(const UClass* Base) const noexcept
+    {
+        if (!Base) return false;
+        // 조상 테이블이 있으면 Base 깊이의 조상 하나만 비교 (O(1))
+        if (Depth >= 0 && Base->Depth >= 0)
+            return Base->Depth <= Depth && Ancestors[Base->Depth] == Base;
+        return IsChildOfByChain(Base);
+    }
+
+    // Super 체인을 따라가는 판정 (조상 테이블이 없는 클래스용, 벤치마크 비교용)
+    bool IsChildOfByChain(const UClass* Base) const noexcept
     {
         if (!Base) return false;
         for (auto c = this; c; c = c->Super)
@@ -41,6 +62,36 @@ struct UClass
         return false;
     }
 
+    // Super 체인으로 조상 테이블 채우기 (부모부터 재귀, 너무 깊으면 테이블 없이 둠)
+    void BuildAncestors()
+    {
+        if (Depth >= 0)
+        {
+            return;
+        }
+
+        if (!Super)
+        {
+            Depth = 0;
+            Ancestors[0] = this;
+            return;
+        }
+
+        UClass* MutableSuper = const_cast<UClass*>(Super);
+        MutableSuper->BuildAncestors();
+        if (Super->Depth < 0 || Super->Depth + 1 >= MaxClassDepth)
+        {
+            return;
+        }
+
+        Depth = Super->Depth + 1;
+        for (int32 i = 0; i < Depth; ++i)
+        {
+            Ancestors[i] = Super->Ancestors[i];
+        }
+        Ancestors[Depth] = this;
+    }
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -52,9 +103,64 @@ struct UClass
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            InClass->BuildAncestors();
+            ++GetClassRegistryVersion();
+        }
+    }
+
+    // 클래스가 새로 등록될 때마다 증가 (파생 클래스 캐시 무효화용)
+    static uint32& GetClassRegistryVersion()
+    {
+        static uint32 Version = 1;
+        return Version;
+    }
+
+    // 자신과 모든 파생 클래스 (TObjectIterator가 클래스별 객체 목록을 훑을 때 사용)
+    const TArray<const UClass*>& GetDerivedClasses() const
+    {
+        if (DerivedClassesVersion != GetClassRegistryVersion())
+        {
+            CachedDerivedClasses.clear();
+            CachedDerivedClasses.Add(this);
+            for (UClass* Class : GetAllClasses())
+            {
+                if (Class && Class != this && Class->IsChildOf(this))
+                {
+                    CachedDerivedClasses.AddUnique(Class);
+                }
+            }
+            DerivedClassesVersion = GetClassRegistryVersion();
         }
+        return CachedDerivedClasses;
     }
+    // 이름(대소문자 무시) → 클래스 해시 인덱스. 클래스 등록 버전이 바뀌면 다시 만든다 (보통 정적 등록 직후 한 번)
+    static const TMap<FName, UClass*>& GetClassNameIndex()
+    {
+        static TMap<FName, UClass*> NameIndex;
+        static uint32 NameIndexVersion = 0;
+        if (NameIndexVersion != GetClassRegistryVersion())
+        {
+            NameIndex.Empty();
+            for (UClass* Class : GetAllClasses())
+            {
+                // 같은 이름이면 먼저 등록된 클래스 우선 (기존 선형 탐색과 동일)
+                if (Class && Class->Name)
+                {
+                    NameIndex.emplace(FName(Class->Name), Class);
+                }
+            }
+            NameIndexVersion = GetClassRegistryVersion();
+        }
+        return NameIndex;
+    }
+
     static UClass* FindClass(const FName& InClassName)
+    {
+        return GetClassNameIndex().FindRef(InClassName);
+    }
+
+    // 해시 인덱스 이전의 선형 탐색 (BENCH SCENELOAD의 비교 기준)
+    static UClass* FindClassLinear(const FName& InClassName)
     {
         for (UClass* Class : GetAllClasses())
         {
@@ -63,10 +169,50 @@ struct UClass
                 return Class;
             }
         }
-
         return nullptr;
     }
 
+    // true면 FindClasses가 이전 로더처럼 문자열마다 선형 탐색한다 (BENCH SCENELOAD 전용, 게임 스레드에서만 바꿀 것)
+    static bool& UseLinearClassLookup()
+    {
+        static bool bLinear = false;
+        return bLinear;
+    }
+
+    /**
+     * @brief 로더용 일괄 조회: InClassNames[i]의 클래스를 OutClasses[i]에 채운다 (없으면 nullptr)
+     * 같은 타입 문자열은 한 번만 FName으로 바꾸므로, 액터마다 FindClass를 부르는 것보다 싸다.
+     */
+    static void FindClasses(const TArray<FString>& InClassNames, TArray<UClass*>& OutClasses)
+    {
+        OutClasses.SetNum(InClassNames.Num());
+        if (UseLinearClassLookup())
+        {
+            for (int32 i = 0; i < InClassNames.Num(); ++i)
+            {
+                OutClasses[i] = FindClassLinear(FName(InClassNames[i]));
+            }
+            return;
+        }
+
+        const TMap<FName, UClass*>& NameIndex = GetClassNameIndex();
+        TMap<FString, UClass*> Resolved;
+
+        for (int32 i = 0; i < InClassNames.Num(); ++i)
+        {
+            const FString& ClassName = InClassNames[i];
+            if (UClass** Cached = Resolved.Find(ClassName))
+            {
+                OutClasses[i] = *Cached;
+                continue;
+            }
+
+            UClass* Class = NameIndex.FindRef(FName(ClassName));
+            Resolved.Add(ClassName, Class);
+            OutClasses[i] = Class;
+        }
+    }
+
     // 리플렉션 시스템 메서드
     // 주의: 프로퍼티는 static 초기화 시점에만 등록되며, 런타임 중 추가/삭제 불가
     void AddProperty(const FProperty& Property)
@@ -178,25 +324,21 @@ protected:
 
 public:
     // UObject-scoped allocation only
+    // 일반 정렬 객체는 크기 등급 풀에서 받는다. 풀은 크기로 등급을 찾으므로
+    // 크기 없는 operator delete는 선언하지 않는다 (선언하면 그쪽이 우선 선택됨).
+    // 가상 소멸자를 통해 delete 시 실제 (파생) 클래스 크기가 넘어온다.
     static void* operator new(SIZE_T Size)
     {
-        return FMemoryManager::Allocate(Size, alignof(std::max_align_t));
-    }
-    static void* operator new(SIZE_T Size, std::align_val_t Alignment)
-    {
-        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment));
-    }
-    static void operator delete(void* Ptr) noexcept
-    {
-        FMemoryManager::Deallocate(Ptr);
+        return FObjectPool::Allocate(Size);
     }
     static void operator delete(void* Ptr, SIZE_T Size) noexcept
     {
-        FMemoryManager::Deallocate(Ptr);
+        FObjectPool::Free(Ptr, Size);
     }
-    static void operator delete(void* Ptr, std::align_val_t Alignment) noexcept
+    // 16B를 넘는 정렬이 필요한 클래스는 일반 경로
+    static void* operator new(SIZE_T Size, std::align_val_t Alignment)
     {
-        FMemoryManager::Deallocate(Ptr);
+        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment), EMemoryTag::Objects);
     }
     static void operator delete(void* Ptr, SIZE_T Size, std::align_val_t Alignment) noexcept
     {
@@ -3,8 +3,89 @@
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
 
+namespace
+{
+    // 슬롯별 시리얼 번호 (GUObjectArray와 같은 인덱스). 객체가 삭제될 때마다 증가하며 0은 쓰지 않음
+    // DeleteAll 이후에도 유지해 이전 약참조가 새 객체를 가리키지 않게 한다
+    TArray<uint32> GUObjectSerialNumbers;
+
+    // 재사용할 빈 슬롯 (LIFO)
+    TArray<int32> GUObjectFreeSlots;
+
+    // 슬롯별 UClass::InstanceSlots 안의 위치 (삭제 시 O(1) 제거용)
+    TArray<int32> GUObjectClassListPositions;
+
+    void LinkToClassList(UObject* Obj, int32 Index)
+    {
+        TArray<int32>& Slots = Obj->GetClass()->InstanceSlots;
+        GUObjectClassListPositions[Index] = Slots.Num();
+        Slots.Add(Index);
+    }
+
+    void UnlinkFromClassList(UObject* Obj, int32 Index)
+    {
+        // 마지막 원소와 교환 후 제거
+        TArray<int32>& Slots = Obj->GetClass()->InstanceSlots;
+        const int32 Position = GUObjectClassListPositions[Index];
+        const int32 LastSlot = Slots.Last();
+        Slots[Position] = LastSlot;
+        GUObjectClassListPositions[LastSlot] = Position;
+        Slots.pop_back();
+        GUObjectClassListPositions[Index] = -1;
+    }
+
+    int32 AllocateObjectSlot(UObject* Obj)
+    {
+        int32 Index;
+        if (!GUObjectFreeSlots.IsEmpty())
+        {
+            Index = GUObjectFreeSlots.Last();
+            GUObjectFreeSlots.pop_back();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = GUObjectArray.Add(Obj);
+            if (Index >= GUObjectSerialNumbers.Num())
+            {
+                GUObjectSerialNumbers.Add(1);
+                GUObjectClassListPositions.Add(-1);
+            }
+        }
+
+        Obj->InternalIndex = static_cast<uint32>(Index);
+        LinkToClassList(Obj, Index);
+        return Index;
+    }
+
+    void ReleaseObjectSlot(int32 Index)
+    {
+        UObject* Obj = GUObjectArray[Index];
+        UnlinkFromClassList(Obj, Index);
+        GUObjectArray[Index] = nullptr;
+        Obj->InternalIndex = UINT32_MAX;
+
+        uint32& Serial = GUObjectSerialNumbers[Index];
+        if (++Serial == 0)
+        {
+            Serial = 1;
+        }
+        GUObjectFreeSlots.Add(Index);
+    }
+}
+
 namespace ObjectFactory
 {
+    uint32 GetObjectSerialNumber(uint32 Index)
+    {
+        return Index < static_cast<uint32>(GUObjectSerialNumbers.Num()) ? GUObjectSerialNumbers[Index] : 0;
+    }
+
+    int32 GetNumFreeSlots()
+    {
+        return GUObjectFreeSlots.Num();
+    }
+
     TMap<UClass*, ConstructFunc>& GetRegistry()
     {
         static TMap<UClass*, ConstructFunc> Registry;
@@ -29,11 +110,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -55,11 +132,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,24 +154,16 @@ namespace ObjectFactory
     {
         if (!Obj) return;
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        // 슬롯은 옮겨지지 않으므로 InternalIndex로 바로 찾고, 슬롯이 이 객체를 가리키며 시리얼이 살아있을 때만 삭제
+        // (배열에 등록되지 않은 객체는 InternalIndex가 UINT32_MAX라서 여기서 걸러짐)
+        const uint32 Index = Obj->InternalIndex;
+        if (Index >= static_cast<uint32>(GUObjectArray.Num()) || GUObjectArray[Index] != Obj || GetObjectSerialNumber(Index) == 0)
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[foundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        ReleaseObjectSlot(static_cast<int32>(Index));
         Obj->DestroyInternal();
     }
 
@@ -114,26 +179,23 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GUObjectFreeSlots.Empty();
     }
 
-    // (선택) null 슬롯 압축
+    // (선택) 끝쪽 null 슬롯 정리
+    // 약참조가 (인덱스, 시리얼)을 들고 있으므로 살아있는 객체는 옮기지 않는다
     void CompactNullSlots()
     {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
+        int32 NewNum = GUObjectArray.Num();
+        while (NewNum > 0 && GUObjectArray[NewNum - 1] == nullptr)
         {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
+            --NewNum;
         }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+        GUObjectArray.SetNum(NewNum);
+
+        // 잘려나간 슬롯은 재사용 목록에서 제거 (시리얼은 유지)
+        GUObjectFreeSlots.erase(
+            std::remove_if(GUObjectFreeSlots.begin(), GUObjectFreeSlots.end(), [NewNum](int32 Index) { return Index >= NewNum; }),
+            GUObjectFreeSlots.end());
     }
 }
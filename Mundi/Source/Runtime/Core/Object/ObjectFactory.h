@@ -42,12 +42,25 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
-    // 개별 삭제(단일 소유자: Factory)
+    // 개별 삭제(단일 소유자: Factory). 슬롯 시리얼을 올려 약참조를 무효화하고 슬롯은 재사용 목록으로
+    // Obj는 살아있는 객체여야 한다 (InternalIndex로 슬롯을 바로 찾음). 이미 지워졌을 수 있는 참조는 약참조 버전을 쓸 것
     void DeleteObject(UObject* Obj);
+    // 약참조가 가리키는 슬롯의 시리얼이 그대로일 때만 삭제
+    template<typename T>
+    inline void DeleteObject(const TWeakObjectPtr<T>& WeakObj)
+    {
+        if (T* Obj = WeakObj.Get())
+        {
+            DeleteObject(Obj);
+        }
+    }
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
+    // 배열 끝의 빈 슬롯만 잘라 크기 축소 (살아있는 객체의 인덱스는 유지)
     void CompactNullSlots();
+
+    // 재사용 대기 중인 빈 슬롯 수
+    int32 GetNumFreeSlots();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <atomic>
 #include "AnimInstance.h"
 #include "SkeletalMeshComponent.h"
 #include "AnimSequenceBase.h"
@@ -69,7 +70,7 @@ void UAnimInstance::UpdateAnimation(float DeltaSeconds)
 		return;
 	}
 
-	static int32 LogCounter = 0;
+	static std::atomic<int32> LogCounter{ 0 };
 	if (LogCounter++ % 60 == 0) // Log every 60 frames
 	{
 		UE_LOG("[AnimInstance] UpdateAnimation: DeltaTime=%.3f, CurrentTime=%.2f, PlayRate=%.2f",
@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <atomic>
 #include "AnimNode_BlendSpace2D.h"
 #include "BlendSpace2D.h"
 #include "AnimSequence.h"
@@ -9,6 +10,8 @@
 #include "Source/Runtime/Engine/Components/CharacterMovementComponent.h"
 #include "Source/Runtime/Engine/Components/SkeletalMeshComponent.h"
 
+static_assert(FAnimNode_BlendSpace2D::MaxSourcePoses == UBlendSpace2D::MaxBlendSamples, "Source pose buffer must match blend sample count");
+
 FAnimNode_BlendSpace2D::FAnimNode_BlendSpace2D()
 	: BlendSpace(nullptr)
 	, BlendParameter(FVector2D::Zero())
@@ -99,7 +102,7 @@ void FAnimNode_BlendSpace2D::SetBlendParameter(FVector2D InParameter)
 	bAutoCalculateParameter = false;
 
 	// 디버그: 설정된 파라미터 확인
-	static int32 SetParamCounter = 0;
+	static std::atomic<int32> SetParamCounter{ 0 };
 	if (SetParamCounter++ % 30 == 0)
 	{
 		UE_LOG("[BlendSpace2D] SetBlendParameter: (%.2f, %.2f)",
@@ -132,7 +135,7 @@ void FAnimNode_BlendSpace2D::Update(float DeltaSeconds)
 	}
 
 	// 디버그: BlendParameter 확인
-	static int32 ParamLogCounter = 0;
+	static std::atomic<int32> ParamLogCounter{ 0 };
 	if (ParamLogCounter++ % 30 == 0)
 	{
 		UE_LOG("[BlendSpace2D] Update: BlendParameter=(%.2f, %.2f)",
@@ -159,8 +162,8 @@ void FAnimNode_BlendSpace2D::Update(float DeltaSeconds)
 	}
 
 	// Step 1: 블렌드 가중치 계산하여 Leader(가장 높은 가중치) 찾기
-	TArray<int32> SampleIndices;
-	TArray<float> Weights;
+	TInlineArray<int32, UBlendSpace2D::MaxBlendSamples> SampleIndices;
+	TInlineArray<float, UBlendSpace2D::MaxBlendSamples> Weights;
 	BlendSpace->GetBlendWeights(BlendParameter, SampleIndices, Weights);
 
 	int32 ReferenceSampleIndex = -1;
@@ -236,7 +239,7 @@ void FAnimNode_BlendSpace2D::Update(float DeltaSeconds)
 	if (!OwnerAnimInstance || !OwnerMeshComp)
 	{
 		// 디버그: AnimInstance/MeshComp가 설정되지 않은 경우
-		static int32 WarnCounter = 0;
+		static std::atomic<int32> WarnCounter{ 0 };
 		if (WarnCounter++ % 300 == 0)
 		{
 			UE_LOG("BlendSpace2D: Update: OwnerAnimInstance=%p, OwnerMeshComp=%p (Notify disabled)",
@@ -379,7 +382,7 @@ void FAnimNode_BlendSpace2D::Update(float DeltaSeconds)
 	PreviousLeaderIndex = ReferenceSampleIndex;
 
 	// 디버그: 시간 동기화 및 Leader 정보 확인
-	static int32 TimeLogCounter = 0;
+	static std::atomic<int32> TimeLogCounter{ 0 };
 	if (TimeLogCounter++ % 60 == 0)
 	{
 		UE_LOG("[BlendSpace2D] Update: NormalizedTime=%.3f, DeltaSeconds=%.4f, Leader=%d (Weight=%.3f)",
@@ -411,8 +414,8 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& OutPose)
 	}
 
 	// 블렌드 가중치 계산
-	TArray<int32> SampleIndices;
-	TArray<float> Weights;
+	TInlineArray<int32, UBlendSpace2D::MaxBlendSamples> SampleIndices;
+	TInlineArray<float, UBlendSpace2D::MaxBlendSamples> Weights;
 
 	BlendSpace->GetBlendWeights(BlendParameter, SampleIndices, Weights);
 
@@ -422,12 +425,15 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& OutPose)
 		return;
 	}
 
-	// 포즈 배열 준비
-	TArray<FPoseContext> SourcePoses;
-	SourcePoses.SetNum(SampleIndices.Num());
+	// 포즈 배열 준비 (멤버 버퍼를 줄이지 않고 재사용하므로 본 배열은 처음 한 번만 할당됨)
+	const int32 NumPoses = SampleIndices.Num();
+	if (SourcePoses.Num() < NumPoses)
+	{
+		SourcePoses.SetNum(NumPoses);
+	}
 
 	// 각 SourcePose 초기화 (Skeleton 설정)
-	for (int32 i = 0; i < SourcePoses.Num(); ++i)
+	for (int32 i = 0; i < NumPoses; ++i)
 	{
 		if (OutPose.Skeleton)
 		{
@@ -435,6 +441,7 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& OutPose)
 		}
 		else
 		{
+			SourcePoses[i].Skeleton = nullptr;
 			SourcePoses[i].LocalSpacePose.SetNum(OutPose.LocalSpacePose.Num());
 		}
 	}
@@ -454,18 +461,12 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& OutPose)
 			continue;
 		}
 
-		// DataModel과 Skeleton 확인 및 설정
+		// DataModel 확인 (SourcePoses[i]가 OutPose의 스켈레톤으로 초기화되어 있으므로 그 본 기준으로 샘플링됨)
 		if (!Sample.Animation->GetDataModel())
 		{
 			continue;
 		}
 
-		// Skeleton 설정 (OutPose에서 가져옴)
-		if (OutPose.Skeleton)
-		{
-			Sample.Animation->GetDataModel()->SetSkeleton(*OutPose.Skeleton);
-		}
-
 		// 애니메이션 시간 가져오기
 		float AnimTime = (SampleIndex < SampleAnimTimes.Num()) ? SampleAnimTimes[SampleIndex] : 0.0f;
 
@@ -479,8 +480,9 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& OutPose)
 
 	// 여러 포즈를 가중치로 블렌딩
 	FAnimationRuntime::BlendPosesTogetherPerBone(
-		SourcePoses,
-		Weights,
+		SourcePoses.GetData(),
+		Weights.GetData(),
+		NumPoses,
 		OutPose
 	);
 }
@@ -519,7 +521,7 @@ void FAnimNode_BlendSpace2D::CalculateBlendParameterFromMovement()
 	BlendParameter.X = Speed;
 	BlendParameter.Y = Angle;
 
-	static int32 LogCounter = 0;
+	static std::atomic<int32> LogCounter{ 0 };
 	if (LogCounter++ % 60 == 0)
 	{
 		UE_LOG("[BlendSpace2D] Speed=%.1f, Angle=%.1f", Speed, Angle);
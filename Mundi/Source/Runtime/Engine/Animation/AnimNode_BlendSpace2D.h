@@ -1,6 +1,7 @@
 #pragma once
 #include "PoseContext.h"
 #include "AnimationTypes.h"
+#include "InlineArray.h"
 
 class UBlendSpace2D;
 class APawn;
@@ -18,6 +19,9 @@ class USkeletalMeshComponent;
 class FAnimNode_BlendSpace2D
 {
 public:
+	// 한 번에 블렌딩하는 최대 샘플 수 (UBlendSpace2D::MaxBlendSamples와 같음)
+	static constexpr int32 MaxSourcePoses = 3;
+
 	FAnimNode_BlendSpace2D();
 	~FAnimNode_BlendSpace2D();
 
@@ -83,6 +87,9 @@ private:
 	// 각 샘플 애니메이션의 재생 시간
 	TArray<float> SampleAnimTimes;
 
+	// Evaluate에서 샘플링한 포즈 버퍼 (프레임 간 재사용, 삼각형 보간이라 최대 3개)
+	TInlineArray<FPoseContext, MaxSourcePoses> SourcePoses;
+
 	// 동기화된 재생 시간 (0~1 정규화)
 	float NormalizedTime;
 
@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <atomic>
 #include "AnimNode_StateMachine.h"
 #include "AnimationRuntime.h"
 #include "AnimSequence.h"
@@ -60,7 +61,7 @@ void FAnimNode_StateMachine::Update(float DeltaSeconds)
 			float X = OwnerAnimInstance->GetFloat(FName(BS->XAxisName));
 			float Y = OwnerAnimInstance->GetFloat(FName(BS->YAxisName));
 
-			static int32 LogCounter = 0;
+			static std::atomic<int32> LogCounter{ 0 };
 			if (LogCounter++ % 30 == 0)
 			{
 				UE_LOG("[StateMachine] BlendSpace2D Parameters: %s=%.2f, %s=%.2f",
@@ -71,7 +72,7 @@ void FAnimNode_StateMachine::Update(float DeltaSeconds)
 		}
 		else
 		{
-			static int32 WarnCounter = 0;
+			static std::atomic<int32> WarnCounter{ 0 };
 			if (WarnCounter++ % 60 == 0)
 			{
 				UE_LOG("[StateMachine] Warning: OwnerAnimInstance is nullptr!");
@@ -278,7 +279,6 @@ static void GetPoseFromNode(const FAnimStateNode* Node, float Time, FPoseContext
 		UAnimSequence* Anim = Node->AnimationAsset;
 		if (Anim->GetDataModel())
 		{
-			Anim->GetDataModel()->SetSkeleton(*OutPose.Skeleton);
 			FAnimationRuntime::GetPoseFromAnimSequence(Anim, Time, OutPose);
 		}
 	}
@@ -289,6 +289,27 @@ static void GetPoseFromNode(const FAnimStateNode* Node, float Time, FPoseContext
 	}
 }
 
+/**
+ * @brief 헬퍼: 재사용 포즈를 OutPose와 같은 본 개수의 Identity 포즈로 초기화
+ * 배열 용량은 유지되므로 본 개수가 같으면 할당이 일어나지 않는다.
+ */
+static void ResetScratchPose(FPoseContext& ScratchPose, const FPoseContext& ReferencePose)
+{
+	ScratchPose.bComponentSpaceValid = false;
+	if (ReferencePose.Skeleton)
+	{
+		ScratchPose.Initialize(ReferencePose.Skeleton);
+		return;
+	}
+
+	ScratchPose.Skeleton = nullptr;
+	ScratchPose.LocalSpacePose.SetNum(ReferencePose.LocalSpacePose.Num());
+	for (FTransform& Transform : ScratchPose.LocalSpacePose)
+	{
+		Transform = FTransform();
+	}
+}
+
 /**
  * @brief 현재 포즈 평가
  */
@@ -299,9 +320,8 @@ void FAnimNode_StateMachine::Evaluate(FPoseContext& OutPose)
 	// ==========================================
 	// 1. 타겟 포즈 계산
 	// ==========================================
-	FPoseContext TargetPose;
-	if (OutPose.Skeleton) { TargetPose.Initialize(OutPose.Skeleton); }
-	else { TargetPose.LocalSpacePose.SetNum(OutPose.LocalSpacePose.Num()); }
+	FPoseContext& TargetPose = TargetPoseScratch;
+	ResetScratchPose(TargetPose, OutPose);
 
 	if (ActiveNode->AnimAssetType == EAnimAssetType::None)
 	{
@@ -334,9 +354,8 @@ void FAnimNode_StateMachine::Evaluate(FPoseContext& OutPose)
 	}
 	else
 	{
-		FPoseContext SourcePose;
-		if (OutPose.Skeleton) { SourcePose.Initialize(OutPose.Skeleton); }
-		else { SourcePose.LocalSpacePose.SetNum(OutPose.LocalSpacePose.Num()); }
+		FPoseContext& SourcePose = SourcePoseScratch;
+		ResetScratchPose(SourcePose, OutPose);
 
 		// 인터럽트 상황인가?
 		if (bIsInterruptedBlend && !FrozenSnapshotPose.empty())
@@ -122,6 +122,10 @@ protected:
 	TArray<FTransform> FrozenSnapshotPose;
 	bool bIsInterruptedBlend;
 
+	// ===== Evaluate 임시 포즈 (매 프레임 재사용, 프레임 간 의미 있는 데이터 아님) =====
+	FPoseContext TargetPoseScratch;
+	FPoseContext SourcePoseScratch;
+
 	// ===== Transition Section =====
 	bool bIsTransitioning;
 	float TransitionAlpha;    // 0.0 ~ 1.0
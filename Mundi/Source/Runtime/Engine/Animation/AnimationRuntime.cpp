@@ -2,6 +2,7 @@
 #include "AnimationRuntime.h"
 #include "AnimSequence.h"
 #include "Source/Runtime/Core/Misc/VertexData.h"
+#include "TransformBatch.h"
 
 // ===== Phase 1.5: ComponentSpace 변환 함수 구현 =====
 
@@ -43,15 +44,14 @@ void FAnimationRuntime::BlendTwoPosesTogether(
 	OutPose.Initialize(PoseA.Skeleton);
 	OutPose.LocalSpacePose.SetNum(NumBonesA);
 
-	// 각 본마다 블렌딩 수행
-	for (int32 BoneIndex = 0; BoneIndex < NumBonesA; ++BoneIndex)
-	{
-		const FTransform& TransformA = PoseA.LocalSpacePose[BoneIndex];
-		const FTransform& TransformB = PoseB.LocalSpacePose[BoneIndex];
-
-		// 블렌딩된 트랜스폼 계산
-		OutPose.LocalSpacePose[BoneIndex] = BlendTransform(TransformA, TransformB, BlendAlpha);
-	}
+	// 전체 본을 한 번에 블렌딩 (위치/스케일 LERP, 회전 NLERP)
+	// 프레임 간 포즈 블렌딩은 두 회전이 가까워 NLERP로 충분하고, SLERP의 acos/sin을 본마다 계산하지 않아도 된다
+	FTransformBatch::Blend(
+		PoseA.LocalSpacePose.GetData(),
+		PoseB.LocalSpacePose.GetData(),
+		BlendAlpha,
+		OutPose.LocalSpacePose.GetData(),
+		NumBonesA);
 }
 
 /**
@@ -63,7 +63,22 @@ void FAnimationRuntime::BlendPosesTogetherPerBone(
 	FPoseContext& OutPose)
 {
 	// 입력 검증
-	if (SourcePoses.Num() == 0 || SourcePoses.Num() != BlendWeights.Num())
+	if (SourcePoses.Num() != BlendWeights.Num())
+	{
+		return;
+	}
+
+	BlendPosesTogetherPerBone(SourcePoses.GetData(), BlendWeights.GetData(), SourcePoses.Num(), OutPose);
+}
+
+void FAnimationRuntime::BlendPosesTogetherPerBone(
+	const FPoseContext* SourcePoses,
+	const float* BlendWeights,
+	int32 NumPoses,
+	FPoseContext& OutPose)
+{
+	// 입력 검증
+	if (NumPoses == 0)
 	{
 		return;
 	}
@@ -80,72 +95,46 @@ void FAnimationRuntime::BlendPosesTogetherPerBone(
 	OutPose.Initialize(TargetSkeleton);
 	OutPose.LocalSpacePose.SetNum(NumBones);
 
-	// 모든 본을 Identity로 초기화
-	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-	{
-		OutPose.LocalSpacePose[BoneIndex] = FTransform();
-	}
-
 	// 가중치 합 계산
 	float TotalWeight = 0.0f;
-	for (float Weight : BlendWeights)
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
 	{
-		TotalWeight += Weight;
+		TotalWeight += BlendWeights[PoseIndex];
 	}
 
-	// 가중치 합이 0이면 중단
+	// 가중치 합이 0이면 Identity 포즈로 중단
 	if (TotalWeight < 0.0001f)
 	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			OutPose.LocalSpacePose[BoneIndex] = FTransform();
+		}
 		return;
 	}
 
-	// 각 본마다 가중치 블렌딩 수행
+	// 0에서 시작해 포즈 단위로 가중 누적
 	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
 	{
-		FVector BlendedPosition = FVector::Zero();
-		FQuat BlendedRotation = FQuat::Identity();
-		FVector BlendedScale = FVector::Zero();
+		OutPose.LocalSpacePose[BoneIndex] = FTransform(FVector::Zero(), FQuat(0.0f, 0.0f, 0.0f, 0.0f), FVector::Zero());
+	}
 
-		// 모든 포즈에 대해 가중치 적용
-		for (int32 PoseIndex = 0; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+	FTransform* BlendedPose = OutPose.LocalSpacePose.GetData();
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		const FPoseContext& SourcePose = SourcePoses[PoseIndex];
+		if (!SourcePose.IsValid() || SourcePose.GetNumBones() != NumBones)
 		{
-			const FPoseContext& SourcePose = SourcePoses[PoseIndex];
-			if (!SourcePose.IsValid() || SourcePose.GetNumBones() != NumBones)
-			{
-				continue;
-			}
-
-			const FTransform& SourceTransform = SourcePose.LocalSpacePose[BoneIndex];
-			const float NormalizedWeight = BlendWeights[PoseIndex] / TotalWeight;
-
-			// Position: 가중 평균
-			BlendedPosition += SourceTransform.Translation * NormalizedWeight;
-
-			// Rotation: 첫 번째 쿼터니언을 기준으로 SLERP
-			if (PoseIndex == 0)
-			{
-				BlendedRotation = SourceTransform.Rotation;
-			}
-			else
-			{
-				// 누적 SLERP (이전 결과와 현재 쿼터니언을 블렌딩)
-				BlendedRotation = FQuat::Slerp(BlendedRotation, SourceTransform.Rotation, NormalizedWeight);
-			}
-
-			// Scale: 가중 평균
-			BlendedScale += SourceTransform.Scale3D * NormalizedWeight;
+			continue;
 		}
 
-		// 정규화된 쿼터니언으로 설정
-		BlendedRotation.Normalize();
-
-		// 블렌딩 결과 저장
-		OutPose.LocalSpacePose[BoneIndex] = FTransform(
-			BlendedPosition,
-			BlendedRotation,
-			BlendedScale
-		);
+		// Position/Scale: 가중 평균
+		// Rotation: 같은 반구로 맞춘 가중 합 (정규화는 마지막에 한 번)
+		const float NormalizedWeight = BlendWeights[PoseIndex] / TotalWeight;
+		FTransformBatch::AccumulateWeighted(SourcePose.LocalSpacePose.GetData(), NormalizedWeight, BlendedPose, NumBones);
 	}
+
+	// 정규화된 쿼터니언으로 마무리
+	FTransformBatch::NormalizeRotations(BlendedPose, NumBones);
 }
 
 /**
@@ -210,23 +199,39 @@ void FAnimationRuntime::ConvertLocalPoseToComponentSpace(
 	const int32 NumBones = LocalPose.Num();
 	OutComponentPose.SetNum(NumBones);
 
-	// 캐시된 ParentIndices 사용 (Phase 1.5 최적화)
-	const TArray<int32>& ParentIndices = Skeleton->bCacheInitialized
-		? Skeleton->ParentIndices
-		: TArray<int32>();
+	// 깊이 캐시가 있으면 같은 깊이의 본끼리 한 번에 합성 (부모는 항상 앞 단계에서 계산됨)
+	if (Skeleton->bCacheInitialized && Skeleton->BonesByDepth.Num() == NumBones && Skeleton->DepthLevelStarts.Num() >= 2)
+	{
+		const TArray<int32>& BonesByDepth = Skeleton->BonesByDepth;
+		const TArray<int32>& DepthLevelStarts = Skeleton->DepthLevelStarts;
+
+		// 루트 본은 LocalSpace = ComponentSpace
+		for (int32 Index = DepthLevelStarts[0]; Index < DepthLevelStarts[1]; ++Index)
+		{
+			const int32 BoneIndex = BonesByDepth[Index];
+			OutComponentPose[BoneIndex] = LocalPose[BoneIndex];
+		}
 
-	// 각 본을 순회하며 ComponentSpace 계산
+		// ComponentSpace = ParentComponentSpace * LocalSpace
+		for (int32 Depth = 1; Depth + 1 < DepthLevelStarts.Num(); ++Depth)
+		{
+			FTransformBatch::ComposeIndexed(
+				LocalPose.GetData(),
+				BonesByDepth.GetData() + DepthLevelStarts[Depth],
+				Skeleton->ParentIndices.GetData(),
+				OutComponentPose.GetData(),
+				DepthLevelStarts[Depth + 1] - DepthLevelStarts[Depth]);
+		}
+		return;
+	}
+
+	// 캐시가 없으면 본 순서대로 하나씩 계산 (부모가 자식보다 앞에 있다고 가정)
 	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
 	{
 		const FTransform& LocalTransform = LocalPose[BoneIndex];
 
-		// 부모 인덱스 가져오기 (캐시 우선)
 		int32 ParentIndex = -1;
-		if (Skeleton->bCacheInitialized && ParentIndices.Num() > BoneIndex)
-		{
-			ParentIndex = ParentIndices[BoneIndex];
-		}
-		else if (BoneIndex < Skeleton->Bones.Num())
+		if (BoneIndex < Skeleton->Bones.Num())
 		{
 			ParentIndex = Skeleton->Bones[BoneIndex].ParentIndex;
 		}
@@ -311,8 +316,9 @@ void FAnimationRuntime::GetPoseFromAnimSequence(
 		return;
 	}
 
-	// 애니메이션에서 스켈레톤 정보 가져오기
-	const FSkeleton* Skeleton = Animation->GetSkeleton();
+	// 호출자가 대상 스켈레톤으로 초기화했으면 그 본 이름으로 샘플링하고, 아니면 애니메이션의 스켈레톤 사용
+	// (공유 애셋의 스켈레톤을 바꾸지 않으므로 여러 컴포넌트가 워커에서 동시에 샘플링해도 안전)
+	const FSkeleton* Skeleton = OutPose.Skeleton ? OutPose.Skeleton : Animation->GetSkeleton();
 	if (!Skeleton)
 	{
 		return;
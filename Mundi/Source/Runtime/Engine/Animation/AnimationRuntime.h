@@ -12,9 +12,10 @@ class FAnimationRuntime
 {
 public:
 	/**
-	 * @brief 두 포즈를 선형 보간(LERP/SLERP)으로 블렌딩
+	 * @brief 두 포즈를 선형 보간(LERP/NLERP)으로 블렌딩
 	 *
-	 * Position과 Scale은 선형 보간(LERP), Rotation은 구면 선형 보간(SLERP) 사용.
+	 * Position과 Scale은 선형 보간(LERP), Rotation은 정규화 선형 보간(NLERP) 사용.
+	 * 전체 본을 FTransformBatch::Blend로 한 번에 처리.
 	 * BlendAlpha = 0일 때 PoseA, BlendAlpha = 1일 때 PoseB.
 	 *
 	 * @param PoseA 첫 번째 포즈 (BlendAlpha=0 일 때 결과)
@@ -33,6 +34,7 @@ public:
 	 *
 	 * 여러 애니메이션을 동시에 블렌딩할 때 사용.
 	 * 예: Blend Space (2D/3D 파라미터 기반 블렌딩)
+	 * Position/Scale은 가중 평균, Rotation은 같은 반구로 맞춘 가중 합을 정규화.
 	 *
 	 * @param SourcePoses 입력 포즈 배열
 	 * @param BlendWeights 각 포즈의 가중치 배열 (합이 1.0이어야 함)
@@ -43,6 +45,15 @@ public:
 		const TArray<float>& BlendWeights,
 		FPoseContext& OutPose);
 
+	/**
+	 * @brief 포인터/개수 버전 (TInlineArray 등 TArray가 아닌 버퍼용)
+	 */
+	static void BlendPosesTogetherPerBone(
+		const FPoseContext* SourcePoses,
+		const float* BlendWeights,
+		int32 NumPoses,
+		FPoseContext& OutPose);
+
 	/**
 	 * @brief 단일 본의 트랜스폼을 블렌딩
 	 *
@@ -97,7 +108,7 @@ public:
 	 *
 	 * @param Animation 샘플링할 애니메이션
 	 * @param Time 샘플링 시간 (초)
-	 * @param OutPose 출력 포즈
+	 * @param OutPose 출력 포즈 (Skeleton이 설정되어 있으면 그 스켈레톤의 본 기준으로 샘플링)
 	 */
 	static void GetPoseFromAnimSequence(
 		class UAnimSequence* Animation,
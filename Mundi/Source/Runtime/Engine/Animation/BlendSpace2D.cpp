@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <atomic>
 #include "BlendSpace2D.h"
 #include "AnimSequence.h"
 #include <filesystem>
@@ -292,6 +293,23 @@ void UBlendSpace2D::GetBlendWeights(
 	FVector2D BlendParameter,
 	TArray<int32>& OutSampleIndices,
 	TArray<float>& OutWeights) const
+{
+	GetBlendWeightsImpl(BlendParameter, OutSampleIndices, OutWeights);
+}
+
+void UBlendSpace2D::GetBlendWeights(
+	FVector2D BlendParameter,
+	TInlineArray<int32, MaxBlendSamples>& OutSampleIndices,
+	TInlineArray<float, MaxBlendSamples>& OutWeights) const
+{
+	GetBlendWeightsImpl(BlendParameter, OutSampleIndices, OutWeights);
+}
+
+template<typename IndexArrayType, typename WeightArrayType>
+void UBlendSpace2D::GetBlendWeightsImpl(
+	FVector2D BlendParameter,
+	IndexArrayType& OutSampleIndices,
+	WeightArrayType& OutWeights) const
 {
 	OutSampleIndices.Empty();
 	OutWeights.Empty();
@@ -346,7 +364,7 @@ void UBlendSpace2D::GetBlendWeights(
 	FindClosestTriangle(NormParam, Index0, Index1, Index2, Weight0, Weight1, Weight2);
 
 	// 디버그: 선택된 삼각형 정보
-	static int32 TriDebugCounter = 0;
+	static std::atomic<int32> TriDebugCounter{ 0 };
 	if (TriDebugCounter++ % 60 == 0)
 	{
 		UE_LOG("[FindTriangle] NormParam=(%.3f, %.3f) -> Triangle[%d,%d,%d]",
@@ -404,7 +422,7 @@ void UBlendSpace2D::GetBlendWeights(
 	}
 
 	// 디버그: 블렌드 가중치 로그 (60프레임마다)
-	static int32 BlendLogCounter = 0;
+	static std::atomic<int32> BlendLogCounter{ 0 };
 	if (BlendLogCounter++ % 60 == 0 && OutWeights.Num() > 0)
 	{
 		UE_LOG("[BlendSpace2D] Param=(%.1f, %.1f) -> %d samples blending:",
@@ -517,7 +535,7 @@ bool UBlendSpace2D::FindContainingTriangle(
 	float& OutWeight1,
 	float& OutWeight2) const
 {
-	static int32 FindDebugCounter = 0;
+	static std::atomic<int32> FindDebugCounter{ 0 };
 	bool bShouldLog = (FindDebugCounter++ % 60 == 0);
 
 	if (bShouldLog)
@@ -705,7 +723,7 @@ void UBlendSpace2D::CalculateBarycentricWeights(
 	OutWeightA = 1.0f - OutWeightB - OutWeightC;
 
 	// 디버그: 클램핑 전 가중치 확인
-	static int32 BaryDebugCounter = 0;
+	static std::atomic<int32> BaryDebugCounter{ 0 };
 	if (BaryDebugCounter++ % 60 == 0)
 	{
 		UE_LOG("[Barycentric] Before clamp: A=%.3f, B=%.3f, C=%.3f (sum=%.3f)",
@@ -1,6 +1,7 @@
 #pragma once
 #include "AnimationAsset.h"
 #include "Source/Runtime/Core/Misc/VertexData.h"
+#include "InlineArray.h"
 
 class UAnimSequence;
 
@@ -185,6 +186,17 @@ public:
 		TArray<int32>& OutSampleIndices,
 		TArray<float>& OutWeights) const;
 
+	// 삼각형 보간이므로 한 번에 섞이는 샘플은 최대 3개
+	static constexpr int32 MaxBlendSamples = 3;
+
+	/**
+	 * @brief 힙 할당 없는 GetBlendWeights (매 프레임 호출하는 애님 노드용)
+	 */
+	void GetBlendWeights(
+		FVector2D BlendParameter,
+		TInlineArray<int32, MaxBlendSamples>& OutSampleIndices,
+		TInlineArray<float, MaxBlendSamples>& OutWeights) const;
+
 	/**
 	 * @brief 파라미터를 정규화된 좌표로 변환 (0~1 범위)
 	 */
@@ -196,6 +208,12 @@ public:
 	FVector2D DenormalizeParameter(FVector2D NormalizedParam) const;
 
 private:
+	template<typename IndexArrayType, typename WeightArrayType>
+	void GetBlendWeightsImpl(
+		FVector2D BlendParameter,
+		IndexArrayType& OutSampleIndices,
+		WeightArrayType& OutWeights) const;
+
 	/**
 	 * @brief 삼각형 보간을 위한 가장 가까운 3개 샘플 찾기
 	 *
@@ -652,47 +652,123 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 {
 	if (!Actor) return false;
 
-	// 액터의 모든 SceneComponent 순회
+	// 액터의 모든 SceneComponent 순회, 가장 가까운 교차를 쓴다
+	FHitResult Hit;
+	float BestDistance = std::numeric_limits<float>::infinity();
+	bool bHit = false;
 	for (auto SceneComponent : Actor->GetSceneComponents())
 	{
 		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
 		{
-			UStaticMesh* MeshRes = StaticMeshComponent->GetStaticMesh();
-			if (!MeshRes) continue;
-
-			FStaticMesh* StaticMesh = MeshRes->GetStaticMeshAsset();
-			if (!StaticMesh) continue;
-
-			// 로컬 공간에서의 레이로 변환
-			const FMatrix WorldMatrix = StaticMeshComponent->GetWorldMatrix();
-			const FMatrix InvWorld = WorldMatrix.InverseAffine();
-			const FVector4 RayOrigin4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f);
-			const FVector4 RayDir4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f);
-			const FVector4 LocalOrigin4 = RayOrigin4 * InvWorld;
-			const FVector4 LocalDir4 = RayDir4 * InvWorld;
-			const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
-
-			// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
-			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
-			if (BVH)
+			if (RaycastComponent(StaticMeshComponent, Ray, BestDistance, Hit))
 			{
-				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
-				{
-					const FVector HitLocal = FVector(
-						LocalOrigin4.X + LocalDir4.X * THitLocal,
-						LocalOrigin4.Y + LocalDir4.Y * THitLocal,
-						LocalOrigin4.Z + LocalDir4.Z * THitLocal);
-					const FVector4 HitLocal4(HitLocal.X, HitLocal.Y, HitLocal.Z, 1.0f);
-					const FVector4 HitWorld4 = HitLocal4 * WorldMatrix;
-					const FVector HitWorld(HitWorld4.X, HitWorld4.Y, HitWorld4.Z);
-					const float THitWorld = (HitWorld - Ray.Origin).Size();
-					OutDistance = THitWorld;
-					return true;
-				}
+				BestDistance = Hit.Distance;
+				bHit = true;
 			}
 		}
 	}
 
-	return false;
+	if (bHit)
+	{
+		OutDistance = BestDistance;
+	}
+	return bHit;
+}
+
+const FMeshBVH* CPickingSystem::GetComponentMeshBVH(UStaticMeshComponent* Component, const FRay& Ray, FRay& OutLocalRay)
+{
+	if (!Component) return nullptr;
+
+	UStaticMesh* MeshRes = Component->GetStaticMesh();
+	if (!MeshRes) return nullptr;
+
+	FStaticMesh* StaticMesh = MeshRes->GetStaticMeshAsset();
+	if (!StaticMesh) return nullptr;
+
+	// 로컬 공간에서의 레이로 변환 (아핀 변환이라 로컬 레이의 t가 월드 레이의 t와 같다)
+	const FMatrix InvWorld = Component->GetWorldMatrix().InverseAffine();
+	const FVector4 LocalOrigin4 = FVector4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f) * InvWorld;
+	const FVector4 LocalDir4 = FVector4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f) * InvWorld;
+	OutLocalRay = FRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
+
+	// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
+	return UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+}
+
+FHitResult CPickingSystem::MakeHitResult(UStaticMeshComponent* Component, const FRay& Ray, const FMeshBVHHit& MeshHit)
+{
+	FHitResult Hit;
+	Hit.Component = Component;
+	Hit.Actor = Component->GetOwner();
+	Hit.Location = Ray.Origin + Ray.Direction * MeshHit.Distance;
+	Hit.Distance = (Hit.Location - Ray.Origin).Size();
+	Hit.TriangleIndex = MeshHit.TriangleIndex;
+	Hit.Barycentric = FVector(1.0f - MeshHit.U - MeshHit.V, MeshHit.U, MeshHit.V);
+
+	// 비균등 스케일이 있으면 로컬 노멀을 그대로 옮길 수 없어 월드 정점으로 다시 계산
+	const FStaticMesh* StaticMesh = Component->GetStaticMesh()->GetStaticMeshAsset();
+	const uint32 FirstIndex = 3 * static_cast<uint32>(MeshHit.TriangleIndex);
+	const FMatrix WorldMatrix = Component->GetWorldMatrix();
+	const FVector A = StaticMesh->Vertices[StaticMesh->Indices[FirstIndex + 0]].pos * WorldMatrix;
+	const FVector B = StaticMesh->Vertices[StaticMesh->Indices[FirstIndex + 1]].pos * WorldMatrix;
+	const FVector C = StaticMesh->Vertices[StaticMesh->Indices[FirstIndex + 2]].pos * WorldMatrix;
+	const FVector Normal = FVector::Cross(B - A, C - A);
+	const float Length = Normal.Size();
+	Hit.Normal = Length > 0.0f ? Normal / Length : MeshHit.Normal;
+	if (FVector::Dot(Hit.Normal, Ray.Direction) > 0.0f)
+	{
+		Hit.Normal = -Hit.Normal;
+	}
+
+	for (int32 SectionIndex = 0; SectionIndex < static_cast<int32>(StaticMesh->GroupInfos.size()); ++SectionIndex)
+	{
+		const FGroupInfo& Group = StaticMesh->GroupInfos[SectionIndex];
+		if (FirstIndex >= Group.StartIndex && FirstIndex < Group.StartIndex + Group.IndexCount)
+		{
+			Hit.SectionIndex = SectionIndex;
+			break;
+		}
+	}
+	return Hit;
+}
+
+bool CPickingSystem::RaycastComponent(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance, FHitResult& OutHit)
+{
+	FRay LocalRay;
+	const FMeshBVH* BVH = GetComponentMeshBVH(Component, Ray, LocalRay);
+	const float DirLength = Ray.Direction.Size();
+	if (!BVH || DirLength <= 0.0f) return false;
+
+	FMeshBVHHit MeshHit;
+	if (!BVH->IntersectRay(LocalRay, MeshHit, MaxDistance / DirLength))
+		return false;
+
+	OutHit = MakeHitResult(Component, Ray, MeshHit);
+	return true;
+}
+
+bool CPickingSystem::RaycastComponentAny(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance)
+{
+	FRay LocalRay;
+	const FMeshBVH* BVH = GetComponentMeshBVH(Component, Ray, LocalRay);
+	const float DirLength = Ray.Direction.Size();
+	if (!BVH || DirLength <= 0.0f) return false;
+
+	return BVH->IntersectRayAny(LocalRay, MaxDistance / DirLength);
+}
+
+int32 CPickingSystem::RaycastComponentAll(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance, TArray<FHitResult>& OutHits)
+{
+	FRay LocalRay;
+	const FMeshBVH* BVH = GetComponentMeshBVH(Component, Ray, LocalRay);
+	const float DirLength = Ray.Direction.Size();
+	if (!BVH || DirLength <= 0.0f) return 0;
+
+	TArray<FMeshBVHHit> MeshHits;
+	BVH->IntersectRayAll(LocalRay, MeshHits, MaxDistance / DirLength);
+	for (const FMeshBVHHit& MeshHit : MeshHits)
+	{
+		OutHits.Add(MakeHitResult(Component, Ray, MeshHit));
+	}
+	return MeshHits.Num();
 }
@@ -5,11 +5,14 @@
 #include "Enums.h"
 
 class UStaticMeshComponent;
+class UPrimitiveComponent;
 class AGizmoActor;
 // Forward Declarations
 class AActor;
 class ACameraActor;
 class FViewport;
+class FMeshBVH;
+struct FMeshBVHHit;
 // Unreal-style simple ray type
 struct alignas(16) FRay
 {
@@ -17,6 +20,19 @@ struct alignas(16) FRay
     FVector Direction; // Normalized
 };
 
+// 레이 질의 결과 (월드 공간)
+struct FHitResult
+{
+    UPrimitiveComponent* Component = nullptr;
+    AActor* Actor = nullptr;
+    float Distance = 0.0f;      // 레이 원점에서 교차점까지 거리
+    FVector Location;           // 교차점
+    FVector Normal;             // 레이를 마주보는 면 노멀
+    int32 TriangleIndex = -1;   // 스태틱 메시 인덱스 버퍼 기준 삼각형 번호
+    FVector Barycentric;        // 삼각형 세 정점(V0, V1, V2)의 가중치
+    int32 SectionIndex = -1;    // FStaticMesh::GroupInfos 인덱스 (Component->GetMaterial(SectionIndex))
+};
+
 // Build A world-space ray from the current mouse position and camera/projection info.
 // - InView: view matrix (row-major, row-vector convention; built by LookAtLH)
 // - InProj: projection matrix created by PerspectiveFovLH in this project
@@ -92,6 +108,14 @@ public:
     /** === 헬퍼 함수들 === */
     static bool CheckActorPicking(const AActor* Actor, const FRay& Ray, float& OutDistance);
 
+    /** === 컴포넌트 단위 레이 질의 (MaxDistance 이상 떨어진 교차는 무시) === */
+    // 가장 가까운 교차
+    static bool RaycastComponent(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance, FHitResult& OutHit);
+    // 교차가 하나라도 있는지 (처음 맞은 삼각형에서 멈춤)
+    static bool RaycastComponentAny(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance);
+    // 모든 교차를 가까운 순서로 OutHits 뒤에 붙이고 붙인 개수를 돌려준다
+    static int32 RaycastComponentAll(UStaticMeshComponent* Component, const FRay& Ray, float MaxDistance, TArray<FHitResult>& OutHits);
+
 
     static uint32 GetPickCount() { return TotalPickCount; }
     static uint64 GetLastPickTime() { return LastPickTime; }
@@ -102,6 +126,10 @@ private:
                                            float ViewWidth, float ViewHeight, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
                                            float& OutDistance, FVector& OutImpactPoint);
 
+    // 컴포넌트 메시의 BVH와 메시 로컬 레이 (t는 월드 레이와 같음). 메시가 없으면 nullptr
+    static const FMeshBVH* GetComponentMeshBVH(UStaticMeshComponent* Component, const FRay& Ray, FRay& OutLocalRay);
+    static FHitResult MakeHitResult(UStaticMeshComponent* Component, const FRay& Ray, const FMeshBVHHit& MeshHit);
+
     static uint32 TotalPickCount;
     static uint64 LastPickTime;
     static uint64 TotalPickTime;
@@ -82,7 +82,7 @@ UDirectionalLightComponent::~UDirectionalLightComponent()
 {
 }
 
-void UDirectionalLightComponent::GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests)
+void UDirectionalLightComponent::GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests)
 {
 	FMatrix ShadowMapView = GetWorldRotation().Inverse().ToMatrix() * FMatrix::ZUpToYUp;
 	FMatrix ViewInv = View->ViewMatrix.InverseAffine();
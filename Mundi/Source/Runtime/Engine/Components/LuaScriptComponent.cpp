@@ -6,6 +6,7 @@
 
 #include "CameraActor.h"
 #include "LuaManager.h"
+#include "PlatformTime.h"
 #include "GameObject.h"
 
 // for test
@@ -178,6 +179,7 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
 	if (FuncTick.valid()) {
+		TIME_PROFILE(Lua_Tick)
 		auto Result = FuncTick(DeltaTime);
 		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
 	}
@@ -2,6 +2,7 @@
 
 #include "SceneComponent.h"
 #include "Material.h"
+#include "FrameArena.h"
 #include "UPrimitiveComponent.generated.h"
 
 // 전방 선언
@@ -39,11 +40,13 @@ public:
 
     void OnRegister(UWorld* InWorld) override;
     void OnUnregister() override;
+    // 등록된 프리미티브는 파티션 BVH/오버랩 쿼리에 쓰이므로 부모 이동을 바로 반영
+    bool NeedsImmediateTransformUpdate() const override { return IsRegistered(); }
 
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
-    virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
+    virtual void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
     {
@@ -19,6 +19,7 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , bIsActive(true)
 {
     bCanEverTick = true;
+    // 이동은 AddWorldOffset으로 트랜스폼 캐시/더티 플래그를 쓰므로 아직 게임 스레드 전용
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -9,6 +9,7 @@ URotatingMovementComponent::URotatingMovementComponent()
     , bRotationInLocalSpace(true)
 {
     bCanEverTick = true;
+    // 회전은 AddLocalRotation으로 트랜스폼 캐시/더티 플래그를 쓰므로 아직 게임 스레드 전용
 }
 
 URotatingMovementComponent::~URotatingMovementComponent()
@@ -6,9 +6,13 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "SceneTransformStore.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
+TArray<USceneComponent*> USceneComponent::DeferredTransformUpdates;
+TArray<USceneComponent*> USceneComponent::DeferredTransformBatch;
+USceneComponent* USceneComponent::DeferredNotifyComponent = nullptr;
 
 USceneComponent::USceneComponent()
     : RelativeLocation(0, 0, 0)
@@ -22,6 +26,12 @@ USceneComponent::USceneComponent()
 
 USceneComponent::~USceneComponent()
 {
+    CancelDeferredTransformUpdate();
+    if (TransformStoreIndex >= 0)
+    {
+        FSceneTransformStore::Get().Unregister(this);
+    }
+
     // 자식 메모리 해제
     // 복사본을 만들어 부모 리스트 무효화 문제를 피함
     TArray<USceneComponent*> ChildrenCopy = AttachChildren;
@@ -52,7 +62,7 @@ void USceneComponent::SetRelativeLocation(const FVector& NewLocation)
 {
     RelativeLocation = NewLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FVector USceneComponent::GetRelativeLocation() const { return RelativeLocation; }
 
@@ -61,7 +71,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& NewRotation)
     RelativeRotation = NewRotation;
     RelativeRotationEuler = NewRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FQuat USceneComponent::GetRelativeRotation() const { return RelativeRotation; }
 
@@ -75,7 +85,7 @@ void USceneComponent::SetRelativeRotationEuler(const FVector& EulerDegrees)
 
     // Euler 재계산 하지 않음 - UI에서 입력한 값을 그대로 유지
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 FVector USceneComponent::GetRelativeRotationEuler() const
@@ -88,7 +98,7 @@ void USceneComponent::SetRelativeScale(const FVector& NewScale)
 {
     RelativeScale = NewScale;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FVector USceneComponent::GetRelativeScale() const { return RelativeScale; }
 
@@ -96,7 +106,7 @@ void USceneComponent::AddRelativeLocation(const FVector& DeltaLocation)
 {
     RelativeLocation = RelativeLocation + DeltaLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
@@ -104,7 +114,7 @@ void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
     RelativeRotation = DeltaRotation * RelativeRotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
@@ -113,7 +123,7 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
         RelativeScale.Y * DeltaScale.Y,
         RelativeScale.Z * DeltaScale.Z);
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 // ──────────────────────────────
@@ -121,13 +131,21 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
-    // Dangling pointer 방지를 위한 체크 
-    if (AttachParent && !AttachParent->IsPendingDestroy())
+    if (bWorldTransformDirty)
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        // Dangling pointer 방지를 위한 체크
+        if (AttachParent && !AttachParent->IsPendingDestroy())
+        {
+            CachedWorldTransform = AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        }
+        else
+        {
+            CachedWorldTransform = RelativeTransform;
+        }
+        bWorldTransformDirty = false;
     }
 
-    return RelativeTransform;
+    return CachedWorldTransform;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -147,7 +165,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
  
 void USceneComponent::SetWorldLocation(const FVector& L)
@@ -249,7 +267,7 @@ void USceneComponent::AddLocalOffset(const FVector& Delta)
     const FVector parentDelta = RelativeRotation.RotateVector(Delta);
     RelativeLocation = RelativeLocation + parentDelta;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
@@ -257,7 +275,7 @@ void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
     RelativeRotation = (RelativeRotation * DeltaRot).GetNormalized(); // 로컬: 우측곱
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat& R)
@@ -266,12 +284,22 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
     RelativeRotation = R.GetNormalized();
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
+    // SoA 저장소가 최신이면 저장소의 연속 배열에서 읽음
+    if (TransformStoreIndex >= 0)
+    {
+        const FSceneTransformStore& Store = FSceneTransformStore::Get();
+        if (Store.IsWorldValid(TransformStoreIndex))
+        {
+            return Store.GetWorldMatrix(TransformStoreIndex);
+        }
+    }
+
     if (bIsTransformDirty)
     {
         CachedWorldMatrix = GetWorldTransform().ToMatrix();
@@ -318,6 +346,10 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+
+    // 부모가 바뀌었으므로 자신과 자손의 월드 캐시 무효화
+    SyncTransformStore();
+    OnAttachParentChanged();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -338,8 +370,10 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
 
+    FSceneTransformStore::Get().MarkHierarchyDirty();
+
     // Notify transform update so shapes can refresh overlaps
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::DuplicateSubObjects()
@@ -349,6 +383,12 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+
+    // 원본의 대기열/저장소 상태는 복사본과 무관
+    bDeferredTransformUpdateQueued = false;
+    TransformStoreIndex = -1;
+    bWorldTransformDirty = true;
+    bIsTransformDirty = true;
 }
 
 // ──────────────────────────────
@@ -376,7 +416,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
         // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
         UpdateRelativeTransform();
-        OnTransformUpdated();
+        PropagateTransformUpdate();
 	}
 	else
 	{
@@ -403,16 +443,157 @@ void USceneComponent::OnRegister(UWorld* InWorld)
         SpriteComponent->SetTexture(GDataDir + "/UI/Icons/EmptyActor.dds");
     }
 
+    FSceneTransformStore::Get().Register(this);
+
     // Notify transform update so shapes can refresh overlaps
-    OnTransformUpdated();
+    PropagateTransformUpdate();
+}
+
+void USceneComponent::OnUnregister()
+{
+    CancelDeferredTransformUpdate();
+    FSceneTransformStore::Get().Unregister(this);
+
+    Super::OnUnregister();
 }
 
 void USceneComponent::OnTransformUpdated()
 {
+    // 캐시는 더티 표시만 하고 (다음 조회 때 부모 캐시로 다시 계산), 자식 알림은 종류에 따라 즉시 또는 일괄로 보낸다
+    MarkWorldTransformDirty();
+    NotifyChildrenTransformUpdated();
+}
+
+void USceneComponent::PropagateTransformUpdate()
+{
+    // OnTransformUpdated를 Super 없이 재정의한 컴포넌트도 캐시는 무효화되도록 먼저 표시
+    SyncTransformStore();
+    MarkWorldTransformDirty();
+    OnTransformUpdated();
+}
+
+void USceneComponent::NotifyChildrenTransformUpdated()
+{
+    // 일괄 처리에서 자기 알림만 받는 중이면 자손은 대기열에 올릴 때 이미 처리됨
+    if (this == DeferredNotifyComponent)
+    {
+        return;
+    }
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (!Child)
+        {
+            continue;
+        }
+
+        // 오버랩/파티션 상태가 있는 자식은 같은 프레임 안의 쿼리가 보도록 바로 알림 (그 자손은 자식이 다시 나눠 처리)
+        if (Child->NeedsImmediateTransformUpdate())
+        {
+            Child->OnTransformUpdated();
+            continue;
+        }
+
+        // 나머지는 한 번만 대기열에 올리고, 그 아래에서 즉시 알림이 필요한 자손만 계속 찾음
+        if (!Child->bDeferredTransformUpdateQueued)
+        {
+            Child->bDeferredTransformUpdateQueued = true;
+            DeferredTransformUpdates.Add(Child);
+        }
+        Child->NotifyChildrenTransformUpdated();
+    }
+}
+
+void USceneComponent::CancelDeferredTransformUpdate()
+{
+    if (!bDeferredTransformUpdateQueued)
+    {
+        return;
+    }
+    bDeferredTransformUpdateQueued = false;
+
+    // 일괄 처리 도중 알림 때문에 파괴될 수도 있으므로 처리 중인 배치에서도 지움
+    DeferredTransformUpdates.Remove(this);
+    for (USceneComponent*& Pending : DeferredTransformBatch)
+    {
+        if (Pending == this)
+        {
+            Pending = nullptr;
+        }
+    }
+}
+
+void USceneComponent::MarkWorldTransformDirty()
+{
+    if (bWorldTransformDirty)
+    {
+        // 깨끗한 자식은 깨끗한 부모로부터만 계산되므로 자손도 이미 더티
+        bIsTransformDirty = true;
+        return;
+    }
+
+    bWorldTransformDirty = true;
     bIsTransformDirty = true;
-    for (USceneComponent* Child : GetAttachChildren())
+    if (TransformStoreIndex >= 0)
+    {
+        FSceneTransformStore::Get().MarkDirty(TransformStoreIndex);
+    }
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
+    }
+}
+
+void USceneComponent::OnAttachParentChanged()
+{
+    FSceneTransformStore::Get().MarkHierarchyDirty();
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::SyncTransformStore()
+{
+    if (TransformStoreIndex >= 0)
+    {
+        FSceneTransformStore::Get().SetRelativeTransform(TransformStoreIndex, RelativeTransform);
+    }
+}
+
+void USceneComponent::FlushPendingTransformUpdates()
+{
+    TArray<USceneComponent*>& Batch = DeferredTransformBatch;
+
+    // SoA 저장소가 켜져 있으면 더티 항목의 월드 트랜스폼을 선형 순회로 확정 (아래 조회는 캐시 반환만 함)
+    FSceneTransformStore::Get().UpdateWorldTransforms();
+
+    // 알림 중 트랜스폼을 다시 바꾸는 컴포넌트가 있을 수 있으므로 몇 번 반복 (나머지는 다음 플러시로)
+    for (int32 Pass = 0; Pass < 4 && !DeferredTransformUpdates.IsEmpty(); ++Pass)
     {
-        Child->OnTransformUpdated();
+        Batch.swap(DeferredTransformUpdates);
+        DeferredTransformUpdates.Empty();
+
+        // 한 프레임에 부모가 여러 번 움직여도 컴포넌트마다 한 번만 알림.
+        // 월드 트랜스폼은 부모 캐시로부터 지연 계산되므로 대기열 순서와 무관하게 올바름
+        for (int32 Index = 0; Index < Batch.Num(); ++Index)
+        {
+            USceneComponent* Component = Batch[Index];
+            if (!Component)
+            {
+                continue;
+            }
+            // 알림 직전에 내려야 이 알림 중에 다시 움직인 경우 다음 패스 대기열에 올라감
+            Component->bDeferredTransformUpdateQueued = false;
+            if (Component->IsPendingDestroy())
+            {
+                continue;
+            }
+            DeferredNotifyComponent = Component;
+            Component->OnTransformUpdated();
+            DeferredNotifyComponent = nullptr;
+        }
+        Batch.Empty();
     }
 }
 
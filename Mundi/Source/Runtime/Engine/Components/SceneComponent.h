@@ -61,6 +61,7 @@ public:
 
     // ──────────────────────────────
     // World Transform API
+    // 월드 트랜스폼은 캐시된다. 자신/조상 변경 시 더티가 되고, 조회 시 부모부터 한 번만 다시 계산한다.
     // ──────────────────────────────
     FTransform GetWorldTransform() const;
     void SetWorldTransform(const FTransform& W);
@@ -108,14 +109,28 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        OnAttachParentChanged();
     }
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
 
+    // 월드 트랜스폼 변경 알림. 캐시를 더티로 표시하고 자식에게 전달한다
+    // (NeedsImmediateTransformUpdate인 자식은 바로, 나머지는 FlushPendingTransformUpdates에서 한 번)
     virtual void OnTransformUpdated();
 
+    // 부모가 움직였을 때 같은 프레임 안에 바로 알림을 받아야 하는지 (오버랩/파티션 상태를 가진 컴포넌트)
+    virtual bool NeedsImmediateTransformUpdate() const { return false; }
+
+    /**
+     * @brief SoA 저장소(FSceneTransformStore)의 더티 월드 트랜스폼을 확정하고, 미뤄둔 자식 알림을 일괄 처리
+     * 부모가 한 프레임에 여러 번 움직여도 미뤄진 자식은 OnTransformUpdated를 한 번만 받는다.
+     * 월드 틱 끝과 씬 렌더 직전에 호출된다 (게임 스레드 전용).
+     */
+    static void FlushPendingTransformUpdates();
+
     // SceneId
     uint32 GetSceneId() const { return SceneId; }
     void SetSceneId(uint32 InId) { SceneId = InId; }
@@ -142,11 +157,18 @@ protected:
     //virtual void OnTransformUpdatedChildImpl();
     
     /**
-     * @brief Transform 갱신시 자식 컴포넌트의 OnTransformUpdated를 강제 호출.
+     * @brief Transform 갱신 시 자손의 월드 캐시를 무효화하고 자신의 OnTransformUpdated를 호출.
      * @note 부모 컴포넌트의 트랜스폼 변화로 인해 월드 관점에서 생길 영향을 처리하기 위한 메소드로,
-     * 자식 컴포넌트들의 로컬 트랜스폼을 직접 변경시키지 않습니다. 
+     * 자식 컴포넌트들의 로컬 트랜스폼을 직접 변경시키지 않습니다. 오버랩/파티션 상태가 있는 자식은 즉시 알리고,
+     * 나머지 자식 알림은 FlushPendingTransformUpdates의 일괄 처리로 미뤄집니다.
      */
-   // void PropagateTransformUpdate();
+    void PropagateTransformUpdate();
+
+    // 자신과 자손의 월드 캐시 무효화 (이미 더티면 자손도 더티이므로 바로 반환)
+    void MarkWorldTransformDirty();
+
+    // 부모 포인터를 직접 바꾼 뒤 호출 (캐시 무효화 + SoA 저장소 재정렬 예약)
+    void OnAttachParentChanged();
 
     //Component 위치 나타내기 위함
     UBillboardComponent* SpriteComponent = nullptr;
@@ -163,6 +185,10 @@ protected:
 
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
     mutable bool bIsTransformDirty = true;
+
+    // 월드 트랜스폼 캐시 (깨끗한 자식은 항상 깨끗한 부모로부터 계산됨)
+    mutable FTransform CachedWorldTransform;
+    mutable bool bWorldTransformDirty = true;
     
     // Hierarchy
     USceneComponent* AttachParent = nullptr;
@@ -176,4 +202,20 @@ protected:
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
     static TMap<uint32, USceneComponent*> SceneIdMap; // 부모를 찾기 위한 Map
+
+private:
+    friend class FSceneTransformStore;
+
+    // SoA 저장소에 로컬 트랜스폼 반영 (저장소에 없으면 무시)
+    void SyncTransformStore();
+    // 자식 알림 (즉시 또는 대기열)
+    void NotifyChildrenTransformUpdated();
+    void CancelDeferredTransformUpdate();
+
+    int32 TransformStoreIndex = -1;             // FSceneTransformStore 항목 인덱스
+    bool bDeferredTransformUpdateQueued = false; // 미뤄진 자식 알림 대기열에 올라가 있는지
+
+    static TArray<USceneComponent*> DeferredTransformUpdates;
+    static TArray<USceneComponent*> DeferredTransformBatch;     // 플러시 중 처리하고 있는 대기열
+    static USceneComponent* DeferredNotifyComponent;   // 일괄 처리에서 자기 알림만 받는 중인 컴포넌트
 };
@@ -0,0 +1,273 @@
+#include "pch.h"
+#include "SceneTransformStore.h"
+#include "SceneComponent.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
+
+FSceneTransformStore& FSceneTransformStore::Get()
+{
+    static FSceneTransformStore Instance;
+    return Instance;
+}
+
+void FSceneTransformStore::SetEnabled(bool bInEnabled)
+{
+    if (bEnabled == bInEnabled)
+    {
+        return;
+    }
+
+    if (!bInEnabled)
+    {
+        for (USceneComponent* Component : Components)
+        {
+            Component->TransformStoreIndex = -1;
+        }
+        Components.Empty();
+        Translations.Empty();
+        Rotations.Empty();
+        Scales.Empty();
+        ParentIndices.Empty();
+        WorldTranslations.Empty();
+        WorldRotations.Empty();
+        WorldScales.Empty();
+        WorldMatrices.Empty();
+        DirtyFlags.Empty();
+        bEnabled = false;
+        return;
+    }
+
+    bEnabled = true;
+    for (TObjectIterator<USceneComponent> It; It; ++It)
+    {
+        USceneComponent* Component = *It;
+        if (Component->IsRegistered() && !Component->IsPendingDestroy())
+        {
+            Register(Component);
+        }
+    }
+}
+
+void FSceneTransformStore::Register(USceneComponent* Component)
+{
+    if (!bEnabled || !Component || Component->TransformStoreIndex >= 0)
+    {
+        return;
+    }
+
+    AddEntry(Component);
+}
+
+void FSceneTransformStore::Unregister(USceneComponent* Component)
+{
+    if (!Component || Component->TransformStoreIndex < 0)
+    {
+        return;
+    }
+
+    RemoveEntry(Component->TransformStoreIndex);
+    Component->TransformStoreIndex = -1;
+}
+
+void FSceneTransformStore::AddEntry(USceneComponent* Component)
+{
+    Component->TransformStoreIndex = Components.Num();
+    Components.Add(Component);
+
+    const FTransform& Relative = Component->RelativeTransform;
+    Translations.Add(Relative.Translation);
+    Rotations.Add(Relative.Rotation);
+    Scales.Add(Relative.Scale3D);
+    ParentIndices.Add(-1);
+
+    WorldTranslations.Add(Relative.Translation);
+    WorldRotations.Add(Relative.Rotation);
+    WorldScales.Add(Relative.Scale3D);
+    WorldMatrices.Add(FMatrix::Identity());
+    DirtyFlags.Add(1);
+
+    // 부모 인덱스와 깊이 순서는 다음 갱신에서 맞춘다
+    bHierarchyDirty = true;
+}
+
+void FSceneTransformStore::RemoveEntry(int32 Index)
+{
+    // 마지막 항목과 교환 후 제거 (순서가 깨지므로 다음 갱신에서 재정렬)
+    const int32 Last = Components.Num() - 1;
+    if (Index != Last)
+    {
+        Components[Index] = Components[Last];
+        Components[Index]->TransformStoreIndex = Index;
+        Translations[Index] = Translations[Last];
+        Rotations[Index] = Rotations[Last];
+        Scales[Index] = Scales[Last];
+        WorldTranslations[Index] = WorldTranslations[Last];
+        WorldRotations[Index] = WorldRotations[Last];
+        WorldScales[Index] = WorldScales[Last];
+        WorldMatrices[Index] = WorldMatrices[Last];
+        DirtyFlags[Index] = DirtyFlags[Last];
+    }
+
+    Components.pop_back();
+    Translations.pop_back();
+    Rotations.pop_back();
+    Scales.pop_back();
+    ParentIndices.pop_back();
+    WorldTranslations.pop_back();
+    WorldRotations.pop_back();
+    WorldScales.pop_back();
+    WorldMatrices.pop_back();
+    DirtyFlags.pop_back();
+
+    bHierarchyDirty = true;
+}
+
+template<typename T>
+void FSceneTransformStore::Permute(TArray<T>& Array, const TArray<int32>& Order, TArray<T>& Scratch)
+{
+    Scratch.SetNum(Order.Num());
+    for (int32 i = 0; i < Order.Num(); ++i)
+    {
+        Scratch[i] = Array[Order[i]];
+    }
+    Array.swap(Scratch);
+}
+
+void FSceneTransformStore::SortByHierarchy()
+{
+    const int32 Count = Components.Num();
+
+    // 계층이 바뀔 때만 포인터를 따라가 깊이를 구하고, 깊이 순으로 배열 전체를 재배치
+    TArray<int32> Depths;
+    Depths.SetNum(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        int32 Depth = 0;
+        for (USceneComponent* Parent = Components[i]->AttachParent; Parent; Parent = Parent->AttachParent)
+        {
+            ++Depth;
+        }
+        Depths[i] = Depth;
+    }
+
+    TArray<int32> Order;
+    Order.SetNum(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Order[i] = i;
+    }
+    std::stable_sort(Order.begin(), Order.end(), [&Depths](int32 A, int32 B) { return Depths[A] < Depths[B]; });
+
+    {
+        TArray<USceneComponent*> Scratch;
+        Permute(Components, Order, Scratch);
+    }
+    {
+        TArray<FVector> Scratch;
+        Permute(Translations, Order, Scratch);
+        Permute(Scales, Order, Scratch);
+        Permute(WorldTranslations, Order, Scratch);
+        Permute(WorldScales, Order, Scratch);
+    }
+    {
+        TArray<FQuat> Scratch;
+        Permute(Rotations, Order, Scratch);
+        Permute(WorldRotations, Order, Scratch);
+    }
+    {
+        TArray<FMatrix> Scratch;
+        Permute(WorldMatrices, Order, Scratch);
+    }
+    {
+        TArray<uint8> Scratch;
+        Permute(DirtyFlags, Order, Scratch);
+    }
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Components[i]->TransformStoreIndex = i;
+    }
+    for (int32 i = 0; i < Count; ++i)
+    {
+        USceneComponent* Parent = Components[i]->AttachParent;
+        ParentIndices[i] = Parent ? Parent->TransformStoreIndex : -1;
+    }
+
+    bHierarchyDirty = false;
+}
+
+void FSceneTransformStore::UpdateWorldTransforms()
+{
+    LastNumUpdated = 0;
+    if (!bEnabled || Components.IsEmpty())
+    {
+        return;
+    }
+
+    TIME_PROFILE(TransformStore_Update)
+
+    if (bHierarchyDirty)
+    {
+        SortByHierarchy();
+    }
+
+    // 부모 인덱스가 항상 앞이므로 한 번의 선형 순회로 충분 (더티 플래그는 컴포넌트 쪽에서 서브트리 전체에 찍힘)
+    const int32 Count = Components.Num();
+    for (int32 i = 0; i < Count; ++i)
+    {
+        if (!DirtyFlags[i])
+        {
+            continue;
+        }
+
+        const int32 ParentIndex = ParentIndices[i];
+        FVector ParentTranslation(0, 0, 0);
+        FQuat ParentRotation(0, 0, 0, 1);
+        FVector ParentScale(1, 1, 1);
+        bool bHasParent = false;
+
+        if (ParentIndex >= 0)
+        {
+            ParentTranslation = WorldTranslations[ParentIndex];
+            ParentRotation = WorldRotations[ParentIndex];
+            ParentScale = WorldScales[ParentIndex];
+            bHasParent = !Components[ParentIndex]->IsPendingDestroy();
+        }
+        else if (USceneComponent* ExternalParent = Components[i]->AttachParent)
+        {
+            // 저장소에 없는 부모 (에디터 전용 컴포넌트 등)
+            if (!ExternalParent->IsPendingDestroy())
+            {
+                const FTransform ParentWorld = ExternalParent->GetWorldTransform();
+                ParentTranslation = ParentWorld.Translation;
+                ParentRotation = ParentWorld.Rotation;
+                ParentScale = ParentWorld.Scale3D;
+                bHasParent = true;
+            }
+        }
+
+        // FTransform::GetWorldTransform과 같은 합성 (회전 곱, 성분별 스케일, 스케일→회전→이동)
+        FTransform World(Translations[i], Rotations[i], Scales[i]);
+        if (bHasParent)
+        {
+            World.Rotation = ParentRotation * Rotations[i];
+            World.Rotation.Normalize();
+            World.Scale3D = FVector(ParentScale.X * Scales[i].X, ParentScale.Y * Scales[i].Y, ParentScale.Z * Scales[i].Z);
+            const FVector Scaled(Translations[i].X * ParentScale.X, Translations[i].Y * ParentScale.Y, Translations[i].Z * ParentScale.Z);
+            World.Translation = ParentTranslation + ParentRotation.RotateVector(Scaled);
+        }
+
+        WorldTranslations[i] = World.Translation;
+        WorldRotations[i] = World.Rotation;
+        WorldScales[i] = World.Scale3D;
+        WorldMatrices[i] = World.ToMatrix();
+        DirtyFlags[i] = 0;
+
+        // 컴포넌트 캐시도 확정 (컴포넌트가 더티면 저장소도 더티라는 규칙 유지)
+        USceneComponent* Component = Components[i];
+        Component->CachedWorldTransform = World;
+        Component->bWorldTransformDirty = false;
+
+        ++LastNumUpdated;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "Vector.h"
+
+class USceneComponent;
+
+/**
+ * @brief 씬 컴포넌트 트랜스폼의 SoA(Struct of Arrays) 저장소 (선택 사항, 기본 꺼짐)
+ * 로컬 T/R/S, 부모 인덱스, 월드 T/R/S/행렬을 각각 연속 배열로 들고,
+ * 항목을 계층 깊이 순(부모 인덱스 < 자식 인덱스)으로 정렬해 두어 월드 갱신을 앞에서부터 한 번에 훑는다.
+ * 켜져 있으면 USceneComponent::GetWorldMatrix가 이 저장소의 행렬을 돌려주므로
+ * FMeshBatchElement::WorldMatrix와 GetWorldAABB도 UObject를 따라가지 않고 여기서 읽는다.
+ *
+ * 등록/해제와 UpdateWorldTransforms는 게임 스레드 전용.
+ * SetRelativeTransform/MarkDirty는 자기 인덱스만 쓰므로 병렬 틱 중에도 호출 가능하다.
+ */
+class FSceneTransformStore
+{
+public:
+    static FSceneTransformStore& Get();
+
+    // 켜면 이미 등록된 씬 컴포넌트를 모두 넣고, 끄면 비운다
+    void SetEnabled(bool bInEnabled);
+    bool IsEnabled() const { return bEnabled; }
+
+    void Register(USceneComponent* Component);
+    void Unregister(USceneComponent* Component);
+
+    void SetRelativeTransform(int32 Index, const FTransform& Relative)
+    {
+        Translations[Index] = Relative.Translation;
+        Rotations[Index] = Relative.Rotation;
+        Scales[Index] = Relative.Scale3D;
+        DirtyFlags[Index] = 1;
+    }
+    void MarkDirty(int32 Index) { DirtyFlags[Index] = 1; }
+    void MarkHierarchyDirty() { bHierarchyDirty = true; }
+
+    bool IsWorldValid(int32 Index) const { return DirtyFlags[Index] == 0; }
+    const FMatrix& GetWorldMatrix(int32 Index) const { return WorldMatrices[Index]; }
+
+    // 더티 항목의 월드 트랜스폼/행렬을 부모→자식 순서로 갱신하고 컴포넌트 캐시에도 기록
+    void UpdateWorldTransforms();
+
+    int32 Num() const { return Components.Num(); }
+    int32 GetLastNumUpdated() const { return LastNumUpdated; }
+
+private:
+    void AddEntry(USceneComponent* Component);
+    void RemoveEntry(int32 Index);
+    void SortByHierarchy();
+
+    template<typename T>
+    static void Permute(TArray<T>& Array, const TArray<int32>& Order, TArray<T>& Scratch);
+
+private:
+    bool bEnabled = false;
+    bool bHierarchyDirty = false;
+    int32 LastNumUpdated = 0;
+
+    TArray<USceneComponent*> Components;
+
+    // 로컬(부모 기준)
+    TArray<FVector> Translations;
+    TArray<FQuat> Rotations;
+    TArray<FVector> Scales;
+    TArray<int32> ParentIndices;        // 저장소 밖 부모이거나 루트면 -1
+
+    // 월드
+    TArray<FVector> WorldTranslations;
+    TArray<FQuat> WorldRotations;
+    TArray<FVector> WorldScales;
+    TArray<FMatrix> WorldMatrices;
+
+    TArray<uint8> DirtyFlags;
+};
@@ -6,6 +6,7 @@
 #include "WorldPartitionManager.h"
 #include "BVHierarchy.h"
 #include "GameObject.h"
+#include "PlatformTime.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 UShapeComponent::UShapeComponent() : bShapeIsVisible(true), bShapeHiddenInGame(true)
 {
@@ -44,6 +45,7 @@ void UShapeComponent::OnTransformUpdated()
 
 void UShapeComponent::TickComponent(float DeltaSeconds)
 {
+    TIME_PROFILE(Collision_Overlap)
     if (GetClass() == UShapeComponent::StaticClass())
     {
         bGenerateOverlapEvents = false;
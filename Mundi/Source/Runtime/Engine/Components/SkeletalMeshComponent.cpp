@@ -1,9 +1,12 @@
 #include "pch.h"
 #include "SkeletalMeshComponent.h"
+#include "PlatformTime.h"
 #include "Source/Runtime/Engine/Animation/AnimInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimSingleNodeInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimStateMachine.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
+#include "Source/Runtime/Engine/Animation/AnimationRuntime.h"
+#include "TransformBatch.h"
 
 USkeletalMeshComponent::USkeletalMeshComponent()
     : AnimInstance(nullptr)
@@ -12,6 +15,8 @@ USkeletalMeshComponent::USkeletalMeshComponent()
 {
     // Enable component tick for animation updates
     bCanEverTick = true;
+    // 멀리 있는 메시는 중요도 매니저가 애니메이션 갱신 빈도를 낮춤
+    bAllowTickThrottling = true;
 
     // 테스트용 기본 메시 설정 제거 (메모리 누수 방지)
     // SetSkeletalMesh(GDataDir + "/Test.fbx");
@@ -147,6 +152,8 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
     // Animation 인스턴스 업데이트 (Unreal Engine 방식)
     if (AnimInstance)
     {
+        TIME_PROFILE(Animation_Tick)
+        FScopedMemoryTag MemoryTag(EMemoryTag::Animation);
         // BlendSpace2D 노드 우선 체크 (더 우선순위가 높음)
         FAnimNode_BlendSpace2D* BlendSpace2DNode = AnimInstance->GetBlendSpace2DNode();
         if (BlendSpace2DNode && BlendSpace2DNode->GetBlendSpace())
@@ -394,23 +401,9 @@ void USkeletalMeshComponent::ForceRecomputePose()
 void USkeletalMeshComponent::UpdateComponentSpaceTransforms()
 {
     const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
-    const int32 NumBones = Skeleton.Bones.Num();
-
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FTransform& LocalTransform = CurrentLocalSpacePose[BoneIndex];
-        const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
 
-        if (ParentIndex == -1) // 루트 본
-        {
-            CurrentComponentSpacePose[BoneIndex] = LocalTransform;
-        }
-        else // 자식 본
-        {
-            const FTransform& ParentComponentTransform = CurrentComponentSpacePose[ParentIndex];
-            CurrentComponentSpacePose[BoneIndex] = ParentComponentTransform.GetWorldTransform(LocalTransform);
-        }
-    }
+    // 깊이 캐시가 있으면 같은 깊이의 본끼리 배치로 합성
+    FAnimationRuntime::ConvertLocalPoseToComponentSpace(&Skeleton, CurrentLocalSpacePose, CurrentComponentSpacePose);
 }
 
 /**
@@ -421,13 +414,23 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
     const int32 NumBones = Skeleton.Bones.Num();
 
+    // 본 트랜스폼 → 행렬, InvBindPose × 본 행렬을 배열 단위로 계산
+    TFrameArray<FMatrix> ComponentPoseMatrices;
+    TFrameArray<FMatrix> InvBindPoses;
+    ComponentPoseMatrices.SetNum(NumBones);
+    InvBindPoses.SetNum(NumBones);
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
-        const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
+        InvBindPoses[BoneIndex] = Skeleton.Bones[BoneIndex].InverseBindPose;
+    }
 
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
-        TempFinalSkinningNormalMatrices[BoneIndex] = TempFinalSkinningMatrices[BoneIndex].Inverse().Transpose();
+    FTransformBatch::ToMatrices(CurrentComponentSpacePose.GetData(), ComponentPoseMatrices.GetData(), NumBones);
+    FTransformBatch::MultiplyMatrices(InvBindPoses.GetData(), ComponentPoseMatrices.GetData(), TempFinalSkinningMatrices.GetData(), NumBones);
+
+    // 스키닝 행렬은 아핀이므로 일반 역행렬 대신 InverseAffine
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        TempFinalSkinningNormalMatrices[BoneIndex] = TempFinalSkinningMatrices[BoneIndex].InverseAffine().Transpose();
     }
 }
 
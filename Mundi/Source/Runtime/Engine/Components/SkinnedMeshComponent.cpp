@@ -2,6 +2,7 @@
 #include "SkinnedMeshComponent.h"
 #include "MeshBatchElement.h"
 #include "PlatformTime.h"
+#include "JobSystem.h"
 #include "SceneView.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
@@ -44,7 +45,7 @@ void USkinnedMeshComponent::DuplicateSubObjects()
    SkeletalMesh->CreateVertexBufferForComp(&VertexBuffer);
 }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
@@ -248,7 +249,8 @@ void USkinnedMeshComponent::PerformSkinning()
    const int32 NumVertices = SrcVertices.Num();
    SkinnedVertices.SetNum(NumVertices);
 
-   for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+   // 정점끼리 독립적이므로 청크 단위로 워커에 분배
+   ParallelFor(NumVertices, [&](int32 Idx)
    {
       const FSkinnedVertex& SrcVert = SrcVertices[Idx];
       FNormalVertex& DstVert = SkinnedVertices[Idx];
@@ -257,7 +259,7 @@ void USkinnedMeshComponent::PerformSkinning()
       DstVert.normal = SkinVertexNormal(SrcVert);
       DstVert.Tangent = SkinVertexTangent(SrcVert);
       DstVert.tex = SrcVert.UV;
-   }
+   }, /*GrainSize*/ 1024);
 }
 
 void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, const TArray<FMatrix>& InSkinningNormalMatrices)
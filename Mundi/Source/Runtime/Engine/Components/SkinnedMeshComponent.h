@@ -25,7 +25,7 @@ public:
 
     UPROPERTY(EditAnywhere, Category = "Skeletal Mesh", Tooltip = "Skeletal mesh asset to render")
     USkeletalMesh* SkeletalMesh;
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
     FAABB GetWorldAABB() const override;
     void OnTransformUpdated() override;
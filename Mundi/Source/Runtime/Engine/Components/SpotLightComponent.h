@@ -26,7 +26,7 @@ public:
 
 	UPROPERTY(EditAnywhere, Category="Light", Range="0.0, 90.0")
 	float OuterConeAngle = 45.0f; // 외부 원뿔 각도
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// Cone Angles
 	void SetInnerConeAngle(float InAngle)
@@ -29,7 +29,7 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	StaticMesh = nullptr;
 }
 
-void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UStaticMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
 	{
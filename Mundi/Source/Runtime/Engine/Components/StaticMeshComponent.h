@@ -31,7 +31,7 @@ public:
 	UStaticMesh* StaticMesh = nullptr;
 	void OnStaticMeshReleased(UStaticMesh* ReleasedMesh);
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
@@ -9,6 +9,7 @@
 AAmbientLightActor::AAmbientLightActor()
 {
 	ObjectName = "Ambient Light Actor";
+	bTickOnlyWithComponents = true;
 	LightComponent = CreateDefaultSubobject<UAmbientLightComponent>("AmbientLightComponent");
 
 	RootComponent = LightComponent;
@@ -9,6 +9,7 @@
 ADecalActor::ADecalActor()
 {
 	ObjectName = "Static Mesh Actor";
+	bTickOnlyWithComponents = true;
 	DecalComponent = CreateDefaultSubobject<UDecalComponent>("DecalComponent");
 
 	RootComponent = DecalComponent;
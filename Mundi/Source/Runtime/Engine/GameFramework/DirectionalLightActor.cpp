@@ -9,6 +9,7 @@
 ADirectionalLightActor::ADirectionalLightActor()
 {
 	ObjectName = "Directional Light Actor";
+	bTickOnlyWithComponents = true;
 	LightComponent = CreateDefaultSubobject<UDirectionalLightComponent>("DirectionalLightComponent");
 
 	RootComponent = LightComponent;
@@ -7,6 +7,9 @@
 #include <ObjManager.h>
 
 #include "MiniDump.h"
+#include "JobSystem.h"
+#include "MemoryManager.h"
+#include "FrameArena.h"
 
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -180,6 +183,14 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // AVX2로 빌드한 바이너리를 지원하지 않는 CPU에서 띄우면 수학 연산 중 잘못된 명령어로 죽는다
+    UE_LOG("[Math] SIMD backend: %s", VectorGetBackendName());
+    if (!VectorIsBackendSupported())
+    {
+        UE_LOG("[Math] This CPU does not support the %s build. Rebuild without /arch:AVX2.", VectorGetBackendName());
+        return false;
+    }
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -193,6 +204,7 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     //매니저 초기화
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
+    FJobSystem::Get().Initialize();
 
     FObjManager::Preload();
     UFbxLoader::PreLoad();
@@ -284,6 +296,9 @@ void UEditorEngine::MainLoop()
 
     while (bRunning)
     {
+        FMemoryManager::BeginFrame();
+        FFrameArena::BeginFrame();
+
         QueryPerformanceCounter(&CurrTime);
         float DeltaSeconds = static_cast<float>((CurrTime.QuadPart - PrevTime.QuadPart) / double(Frequency.QuadPart));
         PrevTime = CurrTime;
@@ -322,6 +337,7 @@ void UEditorEngine::MainLoop()
         }
 
         Tick(DeltaSeconds);
+        FJobSystem::Get().FlushStats();
         Render();
 
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
@@ -340,6 +356,9 @@ void UEditorEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 월드 삭제까지 끝난 뒤 워커 정리 (남은 작업은 여기서 모두 소진됨)
+    FJobSystem::Get().Shutdown();
+
     // Release ImGui first (it may hold D3D11 resources)
     UUIManager::GetInstance().Release();
 
@@ -365,6 +384,9 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 모든 해제가 끝난 뒤 태그별로 남은 할당 보고
+    FMemoryManager::ReportLeaks();
 }
 
 
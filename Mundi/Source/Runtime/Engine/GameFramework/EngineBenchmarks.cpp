@@ -0,0 +1,1072 @@
+#include "pch.h"
+#include "EngineBenchmarks.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <random>
+#include "PlatformTime.h"
+#include "TransformBatch.h"
+#include "BVHierarchy.h"
+#include "JobSystem.h"
+#include "StaticMesh.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "EmptyActor.h"
+#include "PointLightActor.h"
+#include "Level.h"
+#include "JsonSerializer.h"
+#include "SkeletalMeshComponent.h"
+#include "LightComponent.h"
+#include "FlatHashMap.h"
+#include "MeshBVH.h"
+#include "Picking.h"
+
+namespace
+{
+	// 레지스터 계층으로 옮기기 전의 스칼라 구현 (결과/시간 비교용)
+	FMatrix ScalarMatrixMultiply(const FMatrix& A, const FMatrix& B)
+	{
+		FMatrix Result;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Result.M[Row][Col] = A.M[Row][0] * B.M[0][Col] + A.M[Row][1] * B.M[1][Col] + A.M[Row][2] * B.M[2][Col] + A.M[Row][3] * B.M[3][Col];
+			}
+		}
+		return Result;
+	}
+
+	// 여인수 전개 (수반 행렬 / 행렬식)
+	FMatrix ScalarMatrixInverse(const FMatrix& In)
+	{
+		const float (&m)[4][4] = In.M;
+
+		const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+		const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+		const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+		const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+		const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+		const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+		const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+		const float Det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		if (std::fabs(Det) < KINDA_SMALL_NUMBER)
+		{
+			return FMatrix::Identity();
+		}
+		const float InvDet = 1.0f / Det;
+
+		return FMatrix(
+			(m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * InvDet,
+			(-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * InvDet,
+			(m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * InvDet,
+			(-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * InvDet,
+
+			(-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * InvDet,
+			(m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * InvDet,
+			(-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * InvDet,
+			(m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * InvDet,
+
+			(m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * InvDet,
+			(-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * InvDet,
+			(m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * InvDet,
+			(-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * InvDet,
+
+			(-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * InvDet,
+			(m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * InvDet,
+			(-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * InvDet,
+			(m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * InvDet);
+	}
+
+	// 상단 3x3 여인수 + 평행이동 (마지막 열은 무시)
+	FMatrix ScalarMatrixInverseAffine(const FMatrix& In)
+	{
+		const float (&m)[4][4] = In.M;
+		const float C00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+		const float C10 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+		const float C20 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+		const float Det = m[0][0] * C00 + m[0][1] * C10 + m[0][2] * C20;
+		if (std::fabs(Det) < KINDA_SMALL_NUMBER)
+		{
+			return FMatrix::Identity();
+		}
+		const float InvDet = 1.0f / Det;
+
+		FMatrix Out = FMatrix::Identity();
+		Out.M[0][0] = C00 * InvDet;
+		Out.M[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * InvDet;
+		Out.M[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * InvDet;
+		Out.M[1][0] = C10 * InvDet;
+		Out.M[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * InvDet;
+		Out.M[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * InvDet;
+		Out.M[2][0] = C20 * InvDet;
+		Out.M[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * InvDet;
+		Out.M[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * InvDet;
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			Out.M[3][Col] = -(m[3][0] * Out.M[0][Col] + m[3][1] * Out.M[1][Col] + m[3][2] * Out.M[2][Col]);
+		}
+		return Out;
+	}
+
+	FQuat ScalarQuatMultiply(const FQuat& A, const FQuat& B)
+	{
+		return FQuat(
+			A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y,
+			A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+			A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W,
+			A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z);
+	}
+
+	FVector ScalarRotateVector(const FQuat& Q, const FVector& V)
+	{
+		const FVector T(
+			2.0f * (Q.Y * V.Z - Q.Z * V.Y),
+			2.0f * (Q.Z * V.X - Q.X * V.Z),
+			2.0f * (Q.X * V.Y - Q.Y * V.X));
+		return FVector(
+			V.X + Q.W * T.X + (Q.Y * T.Z - Q.Z * T.Y),
+			V.Y + Q.W * T.Y + (Q.Z * T.X - Q.X * T.Z),
+			V.Z + Q.W * T.Z + (Q.X * T.Y - Q.Y * T.X));
+	}
+
+	FTransform ScalarWorldTransform(const FTransform& Parent, const FTransform& Child)
+	{
+		FTransform Result;
+		Result.Rotation = ScalarQuatMultiply(Parent.Rotation, Child.Rotation);
+		const float Size = std::sqrt(FQuat::Dot(Result.Rotation, Result.Rotation));
+		Result.Rotation = Size > KINDA_SMALL_NUMBER ? Result.Rotation * (1.0f / Size) : FQuat::Identity();
+		Result.Scale3D = FVector(Parent.Scale3D.X * Child.Scale3D.X, Parent.Scale3D.Y * Child.Scale3D.Y, Parent.Scale3D.Z * Child.Scale3D.Z);
+		const FVector Scaled(Child.Translation.X * Parent.Scale3D.X, Child.Translation.Y * Parent.Scale3D.Y, Child.Translation.Z * Parent.Scale3D.Z);
+		Result.Translation = Parent.Translation + ScalarRotateVector(Parent.Rotation, Scaled);
+		return Result;
+	}
+
+	// FTransformBatch::Blend와 같은 식을 원소마다 (위치/스케일 Lerp, 회전 Nlerp)
+	FTransform ScalarBlendTransform(const FTransform& A, const FTransform& B, float Alpha)
+	{
+		FTransform Result;
+		Result.Translation = FMath::Lerp(A.Translation, B.Translation, Alpha);
+		Result.Rotation = FQuat::Nlerp(A.Rotation, B.Rotation, Alpha);
+		Result.Scale3D = FMath::Lerp(A.Scale3D, B.Scale3D, Alpha);
+		return Result;
+	}
+
+	float MaxAbsDiff(const float* A, const float* B, int32 Count)
+	{
+		float MaxDiff = 0.0f;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			MaxDiff = std::max(MaxDiff, std::fabs(A[i] - B[i]));
+		}
+		return MaxDiff;
+	}
+
+	template<typename FuncType>
+	double TimeMathLoop(int32 Iterations, FuncType&& Func)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Func(i);
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	// 같은 키 시퀀스로 삽입/조회/순회/삭제 시간을 잰다 (ms, 순서대로). 조회/순회 결과 합은 Sink에 더한다
+	template<typename MapType>
+	void TimeMapOperations(const TArray<const void*>& Keys, int32 Rounds, double OutMs[4], int64& Sink)
+	{
+		MapType Map;
+
+		uint64 Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Keys.Num(); ++i)
+		{
+			Map.Add(Keys[i], i);
+		}
+		OutMs[0] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		volatile int64 FindSink = 0;
+		Start = FPlatformTime::Cycles64();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			for (const void* Key : Keys)
+			{
+				if (const int32* Value = Map.Find(Key))
+				{
+					FindSink += *Value;
+				}
+			}
+		}
+		OutMs[1] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		volatile int64 IterateSink = 0;
+		Start = FPlatformTime::Cycles64();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			for (const auto& Pair : Map)
+			{
+				IterateSink += Pair.second;
+			}
+		}
+		OutMs[2] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		Start = FPlatformTime::Cycles64();
+		for (const void* Key : Keys)
+		{
+			Map.Remove(Key);
+		}
+		OutMs[3] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		Sink += FindSink + IterateSink + Map.Num();
+	}
+
+	// 무작위 AABB 질의 결과가 전수 검사와 다른 횟수
+	int32 CountQueryMismatches(const FBVHierarchy& BVH, const TArray<UPrimitiveComponent*>& Components, std::mt19937& Rng, int32 NumQueries)
+	{
+		std::uniform_real_distribution<float> Position(-5000.0f, 5000.0f);
+		std::uniform_real_distribution<float> HalfSize(50.0f, 1000.0f);
+
+		int32 Mismatches = 0;
+		for (int32 Query = 0; Query < NumQueries; ++Query)
+		{
+			const FVector Center(Position(Rng), Position(Rng), Position(Rng) * 0.2f);
+			const float Half = HalfSize(Rng);
+			const FAABB Box(Center - FVector(Half, Half, Half), Center + FVector(Half, Half, Half));
+
+			TArray<UPrimitiveComponent*> Found = BVH.QueryIntersectedComponents(Box);
+			TArray<UPrimitiveComponent*> Expected;
+			for (UPrimitiveComponent* Component : Components)
+			{
+				if (Box.Intersects(Component->GetWorldAABB()))
+				{
+					Expected.Add(Component);
+				}
+			}
+			std::sort(Found.begin(), Found.end());
+			std::sort(Expected.begin(), Expected.end());
+			Mismatches += (Found == Expected) ? 0 : 1;
+		}
+		return Mismatches;
+	}
+}
+
+bool FEngineBenchmarks::Run(const FString& Name, FBenchmarkResult& OutResult)
+{
+	FString Lower = Name;
+	std::transform(Lower.begin(), Lower.end(), Lower.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+	OutResult = FBenchmarkResult();
+	OutResult.Name = Lower;
+	if (Lower == "math")
+	{
+		RunMath(OutResult);
+		return true;
+	}
+	if (Lower == "bvh")
+	{
+		RunBVHBuild(OutResult);
+		return true;
+	}
+	if (Lower == "bvhrefit")
+	{
+		RunBVHRefit(OutResult);
+		return true;
+	}
+	if (Lower == "sceneload")
+	{
+		RunSceneLoad(OutResult);
+		return true;
+	}
+	if (Lower == "isa")
+	{
+		RunIsA(OutResult);
+		return true;
+	}
+	if (Lower == "map")
+	{
+		RunMap(OutResult);
+		return true;
+	}
+	if (Lower == "meshbvh")
+	{
+		RunMeshBVH(OutResult);
+		return true;
+	}
+	return false;
+}
+
+void FEngineBenchmarks::RunMath(FBenchmarkResult& OutResult)
+{
+	// 같은 입력으로 이전 스칼라 구현과 레지스터 경로(현재 빌드의 백엔드)를 비교: 시간과 최대 오차
+	constexpr int32 NumInputs = 1024;
+	constexpr int32 Iterations = 1000000;
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Dist(-2.0f, 2.0f);
+	auto RandomQuat = [&]() { return FQuat(Dist(Rng), Dist(Rng), Dist(Rng), Dist(Rng)).GetNormalized(); };
+	auto RandomVector = [&]() { return FVector(Dist(Rng), Dist(Rng), Dist(Rng)); };
+
+	TArray<FMatrix> Matrices;
+	TArray<FTransform> Transforms;
+	Matrices.SetNum(NumInputs);
+	Transforms.SetNum(NumInputs);
+	for (int32 i = 0; i < NumInputs; ++i)
+	{
+		// affine이 아닌 일반 역행렬 경로를 재도록 마지막 열에 작은 원근 성분을 섞는다
+		Transforms[i] = FTransform(RandomVector(), RandomQuat(), FVector(1.0f, 1.0f, 1.0f) + RandomVector() * 0.25f);
+		Matrices[i] = Transforms[i].ToMatrix();
+		Matrices[i].M[0][3] = Dist(Rng) * 0.1f;
+		Matrices[i].M[1][3] = Dist(Rng) * 0.1f;
+	}
+
+	volatile float Sink = 0.0f;
+	constexpr int32 Mask = NumInputs - 1;
+
+	{
+		FBenchmarkRow Row{ "Matrix multiply" };
+		FMatrix Accum = FMatrix::Identity();
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Accum = ScalarMatrixMultiply(Matrices[i & Mask], Matrices[(i + 1) & Mask]); Sink += Accum.M[3][3]; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Accum = Matrices[i & Mask] * Matrices[(i + 1) & Mask]; Sink += Accum.M[3][3]; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FMatrix Expected = ScalarMatrixMultiply(Matrices[i], Matrices[(i + 1) & Mask]);
+			const FMatrix Actual = Matrices[i] * Matrices[(i + 1) & Mask];
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.M[0][0], &Actual.M[0][0], 16));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Matrix inverse" };
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += ScalarMatrixInverse(Matrices[i & Mask]).M[3][3]; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += Matrices[i & Mask].Inverse().M[3][3]; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FMatrix Expected = ScalarMatrixInverse(Matrices[i]);
+			const FMatrix Actual = Matrices[i].Inverse();
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.M[0][0], &Actual.M[0][0], 16));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Affine inverse" };
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += ScalarMatrixInverseAffine(Matrices[i & Mask]).M[3][0]; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += Matrices[i & Mask].InverseAffine().M[3][0]; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FMatrix Expected = ScalarMatrixInverseAffine(Matrices[i]);
+			const FMatrix Actual = Matrices[i].InverseAffine();
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.M[0][0], &Actual.M[0][0], 16));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Quat multiply" };
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += ScalarQuatMultiply(Transforms[i & Mask].Rotation, Transforms[(i + 1) & Mask].Rotation).W; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += (Transforms[i & Mask].Rotation * Transforms[(i + 1) & Mask].Rotation).W; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FQuat Expected = ScalarQuatMultiply(Transforms[i].Rotation, Transforms[(i + 1) & Mask].Rotation);
+			const FQuat Actual = Transforms[i].Rotation * Transforms[(i + 1) & Mask].Rotation;
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.X, &Actual.X, 4));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Quat rotate" };
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += ScalarRotateVector(Transforms[i & Mask].Rotation, Transforms[(i + 1) & Mask].Translation).Z; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += Transforms[i & Mask].Rotation.RotateVector(Transforms[(i + 1) & Mask].Translation).Z; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FVector Expected = ScalarRotateVector(Transforms[i].Rotation, Transforms[(i + 1) & Mask].Translation);
+			const FVector Actual = Transforms[i].Rotation.RotateVector(Transforms[(i + 1) & Mask].Translation);
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.X, &Actual.X, 3));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Transform compose" };
+		Row.BaselineMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += ScalarWorldTransform(Transforms[i & Mask], Transforms[(i + 1) & Mask]).Translation.X; });
+		Row.OptimizedMs = TimeMathLoop(Iterations, [&](int32 i) { Sink += Transforms[i & Mask].GetWorldTransform(Transforms[(i + 1) & Mask]).Translation.X; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			const FTransform Expected = ScalarWorldTransform(Transforms[i], Transforms[(i + 1) & Mask]);
+			const FTransform Actual = Transforms[i].GetWorldTransform(Transforms[(i + 1) & Mask]);
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.Translation.X, &Actual.Translation.X, 3));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.Rotation.X, &Actual.Rotation.X, 4));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected.Scale3D.X, &Actual.Scale3D.X, 3));
+		}
+		OutResult.Rows.Add(Row);
+	}
+
+	// 배치 커널: 같은 원소 수를 원소별 호출(scalar 열)과 FTransformBatch(SIMD 열)로 처리
+	constexpr int32 NumPasses = Iterations / NumInputs;
+	TArray<FTransform> NextTransforms;
+	TArray<FQuat> Rotations;
+	TArray<FQuat> NextRotations;
+	NextTransforms.SetNum(NumInputs);
+	Rotations.SetNum(NumInputs);
+	NextRotations.SetNum(NumInputs);
+	for (int32 i = 0; i < NumInputs; ++i)
+	{
+		NextTransforms[i] = Transforms[(i + 1) & Mask];
+		Rotations[i] = Transforms[i].Rotation;
+		NextRotations[i] = NextTransforms[i].Rotation;
+	}
+
+	{
+		FBenchmarkRow Row{ "Batch TRS to matrix" };
+		TArray<FMatrix> Expected;
+		TArray<FMatrix> Actual;
+		Expected.SetNum(NumInputs);
+		Actual.SetNum(NumInputs);
+		Row.BaselineMs = TimeMathLoop(NumPasses, [&](int32) { for (int32 i = 0; i < NumInputs; ++i) { Expected[i] = Transforms[i].ToMatrix(); } Sink += Expected[0].M[3][3]; });
+		Row.OptimizedMs = TimeMathLoop(NumPasses, [&](int32) { FTransformBatch::ToMatrices(Transforms.GetData(), Actual.GetData(), NumInputs); Sink += Actual[0].M[3][3]; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].M[0][0], &Actual[i].M[0][0], 16));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Batch quat nlerp" };
+		constexpr float Alpha = 0.35f;
+		TArray<FQuat> Expected;
+		TArray<FQuat> Actual;
+		Expected.SetNum(NumInputs);
+		Actual.SetNum(NumInputs);
+		Row.BaselineMs = TimeMathLoop(NumPasses, [&](int32) { for (int32 i = 0; i < NumInputs; ++i) { Expected[i] = FQuat::Nlerp(Rotations[i], NextRotations[i], Alpha); } Sink += Expected[0].W; });
+		Row.OptimizedMs = TimeMathLoop(NumPasses, [&](int32) { FTransformBatch::NlerpQuats(Rotations.GetData(), NextRotations.GetData(), Alpha, Actual.GetData(), NumInputs); Sink += Actual[0].W; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].X, &Actual[i].X, 4));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Batch pose blend" };
+		constexpr float Alpha = 0.35f;
+		TArray<FTransform> Expected;
+		TArray<FTransform> Actual;
+		Expected.SetNum(NumInputs);
+		Actual.SetNum(NumInputs);
+		Row.BaselineMs = TimeMathLoop(NumPasses, [&](int32) { for (int32 i = 0; i < NumInputs; ++i) { Expected[i] = ScalarBlendTransform(Transforms[i], NextTransforms[i], Alpha); } Sink += Expected[0].Translation.X; });
+		Row.OptimizedMs = TimeMathLoop(NumPasses, [&](int32) { FTransformBatch::Blend(Transforms.GetData(), NextTransforms.GetData(), Alpha, Actual.GetData(), NumInputs); Sink += Actual[0].Translation.X; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Translation.X, &Actual[i].Translation.X, 3));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Rotation.X, &Actual[i].Rotation.X, 4));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Scale3D.X, &Actual[i].Scale3D.X, 3));
+		}
+		OutResult.Rows.Add(Row);
+	}
+	{
+		FBenchmarkRow Row{ "Batch transform compose" };
+		TArray<FTransform> Expected;
+		TArray<FTransform> Actual;
+		Expected.SetNum(NumInputs);
+		Actual.SetNum(NumInputs);
+		Row.BaselineMs = TimeMathLoop(NumPasses, [&](int32) { for (int32 i = 0; i < NumInputs; ++i) { Expected[i] = Transforms[i].GetWorldTransform(NextTransforms[i]); } Sink += Expected[0].Translation.X; });
+		Row.OptimizedMs = TimeMathLoop(NumPasses, [&](int32) { FTransformBatch::Compose(Transforms.GetData(), NextTransforms.GetData(), Actual.GetData(), NumInputs); Sink += Actual[0].Translation.X; });
+		for (int32 i = 0; i < NumInputs; ++i)
+		{
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Translation.X, &Actual[i].Translation.X, 3));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Rotation.X, &Actual[i].Rotation.X, 4));
+			Row.MaxError = std::max(Row.MaxError, MaxAbsDiff(&Expected[i].Scale3D.X, &Actual[i].Scale3D.X, 3));
+		}
+		OutResult.Rows.Add(Row);
+	}
+
+	char Description[128];
+	snprintf(Description, sizeof(Description), "%s backend, %d iterations", VectorGetBackendName(), Iterations);
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "scalar";
+	OutResult.OptimizedLabel = "SIMD";
+	OutResult.bHasError = true;
+}
+
+void FEngineBenchmarks::RunBVHBuild(FBenchmarkResult& OutResult)
+{
+	// 같은 바운드 배열로 컴포넌트 없이 트리만 짓는다 (리프당 1개, 월드 파티션과 같은 설정)
+	constexpr int32 NumPrimitives = 100000;
+	constexpr int32 Runs = 5;
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Position(-5000.0f, 5000.0f);
+	std::uniform_real_distribution<float> HalfSize(0.5f, 10.0f);
+
+	TArray<FAABB> PrimitiveBounds;
+	PrimitiveBounds.Reserve(NumPrimitives);
+	for (int32 i = 0; i < NumPrimitives; ++i)
+	{
+		const FVector Center(Position(Rng), Position(Rng), Position(Rng) * 0.2f);
+		const float Half = HalfSize(Rng);
+		PrimitiveBounds.Add(FAABB(Center - FVector(Half, Half, Half), Center + FVector(Half, Half, Half)));
+	}
+
+	// 첫 실행의 할당/캐시 영향을 빼려고 여러 번 돌려 최솟값을 쓴다
+	FBenchmarkRow Row;
+	Row.Label = "Bounds-only build";
+	Row.BaselineMs = std::numeric_limits<double>::max();
+	Row.OptimizedMs = std::numeric_limits<double>::max();
+	int32 NumNodes = 0;
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		uint64 Start = FPlatformTime::Cycles64();
+		NumNodes = FBVHierarchy::BuildFromBounds(PrimitiveBounds, 1, false);
+		Row.BaselineMs = std::min(Row.BaselineMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+
+		Start = FPlatformTime::Cycles64();
+		NumNodes = FBVHierarchy::BuildFromBounds(PrimitiveBounds, 1, true);
+		Row.OptimizedMs = std::min(Row.OptimizedMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	}
+	OutResult.Rows.Add(Row);
+
+	char Description[128];
+	snprintf(Description, sizeof(Description), "%d primitives, %d nodes, %u workers, best of %d runs",
+		NumPrimitives, NumNodes, FJobSystem::Get().GetNumWorkers(), Runs);
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "serial";
+	OutResult.OptimizedLabel = "parallel";
+}
+
+void FEngineBenchmarks::RunBVHRefit(FBenchmarkResult& OutResult)
+{
+	// 월드에 넣지 않은 액터로 같은 움직임을 두 트리에 먹인다: refit 경로 vs 매 프레임 Clear + BulkUpdate
+	// 트리 설정은 월드 파티션과 같다 (리프당 컴포넌트 1개)
+	constexpr int32 NumComponents = 5000;
+	constexpr int32 NumFrames = 300;
+	constexpr int32 NumQueries = 64;
+	const int32 MoverCounts[] = { 40, 400 };
+
+	// 로드된 메시가 있으면 붙여서 바운드에 크기를 준다 (없으면 점 바운드)
+	FString MeshPath;
+	for (UStaticMesh* StaticMesh : UResourceManager::GetInstance().GetStaticMeshes())
+	{
+		if (StaticMesh && StaticMesh->GetStaticMeshAsset())
+		{
+			MeshPath = StaticMesh->GetAssetPathFileName();
+			break;
+		}
+	}
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Position(-5000.0f, 5000.0f);
+	std::uniform_real_distribution<float> Step(-20.0f, 20.0f);
+
+	TArray<AStaticMeshActor*> Actors;
+	TArray<UPrimitiveComponent*> Components;
+	Actors.Reserve(NumComponents);
+	Components.Reserve(NumComponents);
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		AStaticMeshActor* Actor = NewObject<AStaticMeshActor>();
+		if (!MeshPath.empty())
+		{
+			Actor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+		}
+		Actor->SetActorLocation(FVector(Position(Rng), Position(Rng), Position(Rng) * 0.2f));
+		Actors.Add(Actor);
+		Components.Add(Actor->GetStaticMeshComponent());
+	}
+
+	int32 QueryMismatches = 0;
+	uint32 RefitFullRebuilds = 0;
+	for (int32 NumMovers : MoverCounts)
+	{
+		FBVHierarchy RefitBVH(FAABB(), 0, 8, 1);
+		FBVHierarchy RebuildBVH(FAABB(), 0, 8, 1);
+		RefitBVH.BulkUpdate(Components);
+		const uint32 FullRebuildsBefore = RefitBVH.GetStats().NumFullRebuilds;
+
+		FBenchmarkRow Row;
+		Row.Label = std::to_string(NumMovers) + " movers per frame";
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Mover = 0; Mover < NumMovers; ++Mover)
+			{
+				AActor* Actor = Actors[Mover];
+				Actor->SetActorLocation(Actor->GetActorLocation() + FVector(Step(Rng), Step(Rng), Step(Rng)));
+			}
+
+			uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Mover = 0; Mover < NumMovers; ++Mover)
+			{
+				RefitBVH.Update(Components[Mover]);
+			}
+			RefitBVH.FlushRebuild();
+			Row.OptimizedMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			RebuildBVH.Clear();
+			RebuildBVH.BulkUpdate(Components);
+			Row.BaselineMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		Row.BaselineMs /= NumFrames;
+		Row.OptimizedMs /= NumFrames;
+		OutResult.Rows.Add(Row);
+
+		// 움직임이 끝난 상태에서 refit 트리의 질의가 전수 검사와 같아야 한다
+		QueryMismatches += CountQueryMismatches(RefitBVH, Components, Rng, NumQueries);
+		RefitFullRebuilds += RefitBVH.GetStats().NumFullRebuilds - FullRebuildsBefore;
+	}
+
+	// 월드 파티션의 승격/강등 흐름: 매 프레임 몇 개가 움직이기 시작해 트리에서 빠지고(Remove),
+	// 일정 프레임 뒤 멈춘 자리에서 다시 들어온다(Update). 비교 기준은 쉬는 컴포넌트만으로 매 프레임 재구축
+	constexpr int32 StartsPerFrame = 10;
+	constexpr int32 MoveFrames = 60;
+	{
+		FBVHierarchy RefitBVH(FAABB(), 0, 8, 1);
+		FBVHierarchy RebuildBVH(FAABB(), 0, 8, 1);
+		RefitBVH.BulkUpdate(Components);
+		const uint32 FullRebuildsBefore = RefitBVH.GetStats().NumFullRebuilds;
+
+		std::uniform_int_distribution<int32> Pick(0, NumComponents - 1);
+		TArray<int32> MoveFramesLeft;
+		MoveFramesLeft.SetNum(NumComponents);
+		TArray<UPrimitiveComponent*> Promoted;
+		TArray<UPrimitiveComponent*> Demoted;
+		TArray<UPrimitiveComponent*> Resting;
+
+		FBenchmarkRow Row;
+		Row.Label = std::to_string(StartsPerFrame) + " promote/demote per frame";
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Promoted.clear();
+			Demoted.clear();
+			for (int32 Attempt = 0; Attempt < StartsPerFrame; ++Attempt)
+			{
+				const int32 Index = Pick(Rng);
+				if (MoveFramesLeft[Index] == 0)
+				{
+					MoveFramesLeft[Index] = MoveFrames;
+					Promoted.Add(Components[Index]);
+				}
+			}
+			Resting.clear();
+			for (int32 Index = 0; Index < NumComponents; ++Index)
+			{
+				if (MoveFramesLeft[Index] == 0)
+				{
+					Resting.Add(Components[Index]);
+					continue;
+				}
+				AActor* Actor = Actors[Index];
+				Actor->SetActorLocation(Actor->GetActorLocation() + FVector(Step(Rng), Step(Rng), Step(Rng)));
+				if (--MoveFramesLeft[Index] == 0)
+				{
+					Demoted.Add(Components[Index]);
+					Resting.Add(Components[Index]);
+				}
+			}
+
+			uint64 Start = FPlatformTime::Cycles64();
+			for (UPrimitiveComponent* Component : Promoted)
+			{
+				RefitBVH.Remove(Component);
+			}
+			for (UPrimitiveComponent* Component : Demoted)
+			{
+				RefitBVH.Update(Component);
+			}
+			RefitBVH.FlushRebuild();
+			Row.OptimizedMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			RebuildBVH.Clear();
+			RebuildBVH.BulkUpdate(Resting);
+			Row.BaselineMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		Row.BaselineMs /= NumFrames;
+		Row.OptimizedMs /= NumFrames;
+		OutResult.Rows.Add(Row);
+
+		// 트리에는 쉬는 컴포넌트만 있어야 한다
+		QueryMismatches += CountQueryMismatches(RefitBVH, Resting, Rng, NumQueries);
+		RefitFullRebuilds += RefitBVH.GetStats().NumFullRebuilds - FullRebuildsBefore;
+	}
+
+	for (AStaticMeshActor* Actor : Actors)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+
+	char Description[192];
+	snprintf(Description, sizeof(Description), "%d components (%s bounds), %d frames, ms per frame; refit path: %u full rebuilds, %d/%d query mismatches vs brute force",
+		NumComponents, MeshPath.empty() ? "point" : "mesh", NumFrames, RefitFullRebuilds, QueryMismatches, NumQueries * (static_cast<int32>(std::size(MoverCounts)) + 1));
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "rebuild";
+	OutResult.OptimizedLabel = "refit";
+}
+
+void FEngineBenchmarks::RunSceneLoad(FBenchmarkResult& OutResult)
+{
+	// 저장 포맷과 같은 씬 JSON을 만들어 ULevel::Serialize 로드를 잰다: 이전 로더(문자열마다 선형 FindClass) vs 해시 인덱스 일괄 조회
+	// 월드 없이 레벨 객체에만 로드하므로 카메라 정보는 넣지 않는다
+	constexpr int32 NumActors = 20000;
+	constexpr int32 Runs = 3;
+
+	FString MeshPath;
+	for (UStaticMesh* StaticMesh : UResourceManager::GetInstance().GetStaticMeshes())
+	{
+		if (StaticMesh && StaticMesh->GetStaticMeshAsset())
+		{
+			MeshPath = StaticMesh->GetAssetPathFileName();
+			break;
+		}
+	}
+
+	// 배치 씬과 비슷하게 스태틱 메시 위주로 빈 액터/포인트 라이트를 섞는다
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Position(-5000.0f, 5000.0f);
+	JSON ActorListJson = json::Object();
+	int32 NumComponents = 0;
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		AActor* Actor = nullptr;
+		if (i % 10 == 8)
+		{
+			Actor = NewObject<AEmptyActor>();
+		}
+		else if (i % 10 == 9)
+		{
+			Actor = NewObject<APointLightActor>();
+		}
+		else
+		{
+			AStaticMeshActor* MeshActor = NewObject<AStaticMeshActor>();
+			if (!MeshPath.empty())
+			{
+				MeshActor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+			}
+			Actor = MeshActor;
+		}
+		Actor->SetActorLocation(FVector(Position(Rng), Position(Rng), Position(Rng) * 0.2f));
+
+		JSON ActorJson = json::Object();
+		ActorJson["Type"] = Actor->GetClass()->Name;
+		Actor->Serialize(false, ActorJson);
+		NumComponents += std::max(0, ActorJson["OwnedComponents"].length());
+		ActorListJson[std::to_string(Actor->UUID)] = ActorJson;
+		ObjectFactory::DeleteObject(Actor);
+	}
+	JSON SceneJson = json::Object();
+	SceneJson["Version"] = 1;
+	SceneJson["Actors"] = ActorListJson;
+
+	// 같은 타입 문자열 목록으로 조회만 따로 비교 (결과가 같아야 함)
+	TArray<FString> TypeStrings;
+	for (auto& Pair : ActorListJson.ObjectRange())
+	{
+		FString TypeString;
+		FJsonSerializer::ReadString(Pair.second, "Type", TypeString);
+		TypeStrings.Add(TypeString);
+		JSON ComponentsJson;
+		if (FJsonSerializer::ReadArray(Pair.second, "OwnedComponents", ComponentsJson))
+		{
+			for (uint32 Index = 0; Index < static_cast<uint32>(ComponentsJson.size()); ++Index)
+			{
+				FJsonSerializer::ReadString(ComponentsJson[Index], "Type", TypeString);
+				TypeStrings.Add(TypeString);
+			}
+		}
+	}
+
+	FBenchmarkRow LookupRow;
+	LookupRow.Label = "Class lookup only (" + std::to_string(TypeStrings.Num()) + " type strings)";
+	LookupRow.BaselineMs = std::numeric_limits<double>::max();
+	LookupRow.OptimizedMs = std::numeric_limits<double>::max();
+	FBenchmarkRow LoadRow;
+	LoadRow.Label = "ULevel::Serialize load";
+	LoadRow.BaselineMs = std::numeric_limits<double>::max();
+	LoadRow.OptimizedMs = std::numeric_limits<double>::max();
+
+	int32 LookupMismatches = 0;
+	int32 LoadedActors = 0;
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		for (bool bLinear : { true, false })
+		{
+			TArray<UClass*> Classes;
+			UClass::UseLinearClassLookup() = bLinear;
+			uint64 Start = FPlatformTime::Cycles64();
+			UClass::FindClasses(TypeStrings, Classes);
+			const double LookupMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			std::unique_ptr<ULevel> Level = std::make_unique<ULevel>();
+			Start = FPlatformTime::Cycles64();
+			Level->Serialize(true, SceneJson);
+			const double LoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+			UClass::UseLinearClassLookup() = false;
+
+			double& LookupSlot = bLinear ? LookupRow.BaselineMs : LookupRow.OptimizedMs;
+			double& LoadSlot = bLinear ? LoadRow.BaselineMs : LoadRow.OptimizedMs;
+			LookupSlot = std::min(LookupSlot, LookupMs);
+			LoadSlot = std::min(LoadSlot, LoadMs);
+
+			if (!bLinear)
+			{
+				for (int32 i = 0; i < TypeStrings.Num(); ++i)
+				{
+					LookupMismatches += (Classes[i] == UClass::FindClassLinear(FName(TypeStrings[i]))) ? 0 : 1;
+				}
+			}
+			LoadedActors = Level->GetActors().Num();
+			for (AActor* Actor : Level->GetActors())
+			{
+				ObjectFactory::DeleteObject(Actor);
+			}
+			Level->Clear();
+		}
+	}
+
+	OutResult.Rows.Add(LookupRow);
+	OutResult.Rows.Add(LoadRow);
+
+	char Description[192];
+	snprintf(Description, sizeof(Description), "%d actors (%d loaded), %d components (%s bounds), %d classes registered, best of %d runs, %d lookup mismatches",
+		NumActors, LoadedActors, NumComponents, MeshPath.empty() ? "point" : "mesh", UClass::GetAllClasses().Num(), Runs, LookupMismatches / Runs);
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "linear";
+	OutResult.OptimizedLabel = "hashed";
+}
+
+void FEngineBenchmarks::RunIsA(FBenchmarkResult& OutResult)
+{
+	// USkeletalMeshComponent → USkinnedMeshComponent → UMeshComponent → UPrimitiveComponent → USceneComponent 계층에서
+	// Super 체인 판정과 조상 테이블 판정을 같은 질의(적중/실패 섞음)로 비교
+	const UClass* Leaf = USkeletalMeshComponent::StaticClass();
+	const UClass* Queries[] = {
+		USceneComponent::StaticClass(),
+		UPrimitiveComponent::StaticClass(),
+		UActorComponent::StaticClass(),
+		ULightComponent::StaticClass(),
+	};
+	constexpr int32 NumQueries = sizeof(Queries) / sizeof(Queries[0]);
+	constexpr int32 Iterations = 4000000;
+	constexpr int32 Runs = 3;
+
+	FBenchmarkRow Row;
+	Row.Label = "IsChildOf";
+	Row.BaselineMs = std::numeric_limits<double>::max();
+	Row.OptimizedMs = std::numeric_limits<double>::max();
+	int32 NumMismatches = 0;
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		volatile int32 ChainSink = 0;
+		volatile int32 TableSink = 0;
+		Row.BaselineMs = std::min(Row.BaselineMs, TimeMathLoop(Iterations, [&](int32 i) { ChainSink += Leaf->IsChildOfByChain(Queries[i % NumQueries]) ? 1 : 0; }));
+		Row.OptimizedMs = std::min(Row.OptimizedMs, TimeMathLoop(Iterations, [&](int32 i) { TableSink += Leaf->IsChildOf(Queries[i % NumQueries]) ? 1 : 0; }));
+		NumMismatches += (ChainSink == TableSink) ? 0 : 1;
+	}
+	OutResult.Rows.Add(Row);
+
+	char Description[128];
+	snprintf(Description, sizeof(Description), "%d checks, depth %d, best of %d runs, %d result mismatches", Iterations, Leaf->Depth, Runs, NumMismatches);
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "Super chain";
+	OutResult.OptimizedLabel = "ancestor table";
+}
+
+void FEngineBenchmarks::RunMap(FBenchmarkResult& OutResult)
+{
+	// BVH 바운드 캐시와 같은 형태(포인터 키)로 TMap(노드 기반)과 TFlatMap(open addressing)을 비교
+	constexpr int32 NumKeys = 100000;
+	constexpr int32 Rounds = 8;
+	constexpr int32 Runs = 3;
+
+	TArray<uint64> KeyStorage;
+	KeyStorage.SetNum(NumKeys);
+	TArray<const void*> Keys;
+	Keys.Reserve(NumKeys);
+	for (int32 i = 0; i < NumKeys; ++i)
+	{
+		Keys.Add(&KeyStorage[i]);
+	}
+	// 삽입 순서가 주소 순서와 같지 않도록 섞는다
+	std::shuffle(Keys.begin(), Keys.end(), std::mt19937(1234));
+
+	const char* Labels[4] = { "Insert", "Find", "Iterate", "Remove" };
+	FBenchmarkRow Rows[4];
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Rows[i].Label = Labels[i];
+		Rows[i].BaselineMs = std::numeric_limits<double>::max();
+		Rows[i].OptimizedMs = std::numeric_limits<double>::max();
+	}
+
+	// 두 맵의 조회/순회 결과 합이 다르면 불일치
+	int32 NumMismatches = 0;
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		int64 NodeSink = 0;
+		int64 FlatSink = 0;
+		double NodeMs[4];
+		double FlatMs[4];
+		TimeMapOperations<TMap<const void*, int32>>(Keys, Rounds, NodeMs, NodeSink);
+		TimeMapOperations<TFlatMap<const void*, int32>>(Keys, Rounds, FlatMs, FlatSink);
+		NumMismatches += (NodeSink == FlatSink) ? 0 : 1;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Rows[i].BaselineMs = std::min(Rows[i].BaselineMs, NodeMs[i]);
+			Rows[i].OptimizedMs = std::min(Rows[i].OptimizedMs, FlatMs[i]);
+		}
+	}
+	for (const FBenchmarkRow& Row : Rows)
+	{
+		OutResult.Rows.Add(Row);
+	}
+
+	char Description[128];
+	snprintf(Description, sizeof(Description), "%d pointer keys, %d lookup/iterate rounds, best of %d runs, %d result mismatches",
+		NumKeys, Rounds, Runs, NumMismatches);
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "TMap";
+	OutResult.OptimizedLabel = "TFlatMap";
+}
+
+void FEngineBenchmarks::RunMeshBVH(FBenchmarkResult& OutResult)
+{
+	// 실제 스캔 메시(2K 텍스처 사과)를 Data에서 직접 로드해 피킹 BVH 구축/레이 질의 시간을 잰다 (전수 검사와 결과 비교)
+	// 에디터에 무엇이 로드돼 있는지와 무관하게 같은 입력이 되도록 메시를 고정한다
+	const FString MeshPaths[] = {
+		GDataDir + "/apple_mid.obj",
+		GDataDir + "/bitten_apple_mid.obj",
+	};
+	constexpr int32 Runs = 3;
+	constexpr int32 NumRays = 2000;
+
+	FString Description = std::to_string(NumRays) + " random rays per mesh, best of " + std::to_string(Runs) + " builds";
+	int32 NumMismatches = 0;
+	for (const FString& MeshPath : MeshPaths)
+	{
+		UStaticMesh* StaticMesh = UResourceManager::GetInstance().Load<UStaticMesh>(MeshPath);
+		const FStaticMesh* Mesh = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		const FString MeshName = MeshPath.substr(MeshPath.find_last_of('/') + 1);
+		if (!Mesh || Mesh->Indices.Num() < 3)
+		{
+			Description += "; " + MeshName + " missing";
+			continue;
+		}
+
+		FMeshBVH BVH;
+		double BuildMs = std::numeric_limits<double>::max();
+		for (int32 Run = 0; Run < Runs; ++Run)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			BVH.Build(Mesh->Vertices, Mesh->Indices);
+			BuildMs = std::min(BuildMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+		}
+
+		// 바운드를 감싸는 구 표면에서 바운드 안쪽 임의 지점으로 쏘는 레이
+		FVector BoundsMin = Mesh->Vertices[0].pos;
+		FVector BoundsMax = BoundsMin;
+		for (const FNormalVertex& Vertex : Mesh->Vertices)
+		{
+			BoundsMin = BoundsMin.ComponentMin(Vertex.pos);
+			BoundsMax = BoundsMax.ComponentMax(Vertex.pos);
+		}
+		const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+		const float Radius = std::max((BoundsMax - BoundsMin).Size(), KINDA_SMALL_NUMBER);
+
+		std::mt19937 Rng(1234);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+		TArray<FRay> Rays;
+		Rays.Reserve(NumRays);
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			FVector Dir(Unit(Rng), Unit(Rng), Unit(Rng));
+			Dir = Dir.SizeSquared() > KINDA_SMALL_NUMBER ? Dir.GetNormalized() : FVector(1.0f, 0.0f, 0.0f);
+			const FVector Origin = Center + Dir * Radius;
+			const FVector Target(
+				Center.X + Unit(Rng) * (BoundsMax.X - BoundsMin.X) * 0.5f,
+				Center.Y + Unit(Rng) * (BoundsMax.Y - BoundsMin.Y) * 0.5f,
+				Center.Z + Unit(Rng) * (BoundsMax.Z - BoundsMin.Z) * 0.5f);
+			Rays.Add(FRay{ Origin, (Target - Origin).GetNormalized() });
+		}
+
+		// 전수 검사: bAnyHit이면 첫 교차에서 멈춘다
+		auto BruteForce = [Mesh](const FRay& Ray, bool bAnyHit)
+		{
+			float BestT = std::numeric_limits<float>::infinity();
+			for (int32 Idx = 0; Idx + 2 < Mesh->Indices.Num(); Idx += 3)
+			{
+				float T;
+				if (IntersectRayTriangleMT(Ray, Mesh->Vertices[Mesh->Indices[Idx]].pos, Mesh->Vertices[Mesh->Indices[Idx + 1]].pos,
+					Mesh->Vertices[Mesh->Indices[Idx + 2]].pos, T) && T < BestT)
+				{
+					BestT = T;
+					if (bAnyHit)
+					{
+						break;
+					}
+				}
+			}
+			return BestT;
+		};
+
+		FBenchmarkRow ClosestRow;
+		ClosestRow.Label = MeshName + " closest hit";
+		TArray<float> BruteT;
+		BruteT.SetNum(NumRays);
+		ClosestRow.BaselineMs = TimeMathLoop(NumRays, [&](int32 i) { BruteT[i] = BruteForce(Rays[i], false); });
+
+		TArray<float> BVHT;
+		BVHT.SetNum(NumRays);
+		ClosestRow.OptimizedMs = TimeMathLoop(NumRays, [&](int32 i)
+		{
+			float T = std::numeric_limits<float>::infinity();
+			BVHT[i] = BVH.IntersectRay(Rays[i], T) ? T : std::numeric_limits<float>::infinity();
+		});
+
+		int32 NumHits = 0;
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			const bool bHit = std::isfinite(BVHT[i]);
+			NumHits += bHit ? 1 : 0;
+			// 두 검사의 계산 순서가 달라 거리는 상대 오차를 허용해 비교한다
+			if (bHit != std::isfinite(BruteT[i]) || (bHit && std::abs(BVHT[i] - BruteT[i]) > 1e-3f * std::max(1.0f, BruteT[i])))
+			{
+				++NumMismatches;
+			}
+			else if (bHit)
+			{
+				ClosestRow.MaxError = std::max(ClosestRow.MaxError, std::abs(BVHT[i] - BruteT[i]));
+			}
+		}
+		OutResult.Rows.Add(ClosestRow);
+
+		// 시야 검사처럼 맞았는지만 필요한 경우 (양쪽 모두 첫 교차에서 멈춤)
+		FBenchmarkRow AnyRow;
+		AnyRow.Label = MeshName + " any hit";
+		TArray<bool> BruteAny;
+		BruteAny.SetNum(NumRays);
+		AnyRow.BaselineMs = TimeMathLoop(NumRays, [&](int32 i) { BruteAny[i] = std::isfinite(BruteForce(Rays[i], true)); });
+		TArray<bool> BVHAny;
+		BVHAny.SetNum(NumRays);
+		AnyRow.OptimizedMs = TimeMathLoop(NumRays, [&](int32 i) { BVHAny[i] = BVH.IntersectRayAny(Rays[i]); });
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			NumMismatches += (BruteAny[i] == BVHAny[i]) ? 0 : 1;
+		}
+		OutResult.Rows.Add(AnyRow);
+
+		char MeshDescription[192];
+		snprintf(MeshDescription, sizeof(MeshDescription), "; %s: %d triangles, %d nodes, build %.3f ms, %d hits",
+			MeshName.c_str(), BVH.GetNumTriangles(), BVH.GetNumNodes(), BuildMs, NumHits);
+		Description += MeshDescription;
+	}
+
+	Description += ", " + std::to_string(NumMismatches) + " mismatches vs brute force";
+	OutResult.Description = Description;
+	OutResult.BaselineLabel = "brute force";
+	OutResult.OptimizedLabel = "BVH";
+	OutResult.bHasError = true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// 한 행 = 같은 입력을 기준 경로(Baseline)와 현재 경로(Optimized)로 돌린 시간과 두 결과의 최대 오차
+struct FBenchmarkRow
+{
+    FString Label;
+    double BaselineMs = 0.0;
+    double OptimizedMs = 0.0;
+    float MaxError = 0.0f;
+};
+
+struct FBenchmarkResult
+{
+    FString Name;
+    FString Description;        // 입력 크기, 백엔드 등 (콘솔/리포트 첫 줄)
+    FString BaselineLabel;      // 열 이름 (예: "scalar", "serial")
+    FString OptimizedLabel;
+    bool bHasError = false;     // 결과 비교가 없는 벤치마크는 오차 열을 생략
+    TArray<FBenchmarkRow> Rows;
+};
+
+/**
+ * @brief 콘솔 BENCH 명령과 헤드리스 -bench= 모드가 같이 쓰는 벤치마크
+ * 씬 없이 돌아가므로 헤드리스에서 바로 재현할 수 있다.
+ * 예: Mundi.exe -headless -bench=math -report=BenchMath.csv
+ */
+class FEngineBenchmarks
+{
+public:
+    // Name은 대소문자 무시 ("math", "bvh", "bvhrefit", "sceneload", "isa", "map", "meshbvh"). 모르는 이름이면 false
+    static bool Run(const FString& Name, FBenchmarkResult& OutResult);
+
+    // BENCH MATH: 이전 스칼라 구현 vs 레지스터 경로(현재 빌드의 백엔드), 원소별 호출 vs FTransformBatch
+    static void RunMath(FBenchmarkResult& OutResult);
+
+    // BENCH BVH: 100k개 바운드로 LBVH 구축, 직렬(std::sort + 재귀) vs 병렬(기수 정렬 + 서브트리 작업)
+    static void RunBVHBuild(FBenchmarkResult& OutResult);
+
+    // BENCH BVHREFIT: 5000개 컴포넌트 중 일부만 매 프레임 움직일 때 refit 경로 vs 매 프레임 전체 재구축
+    // 월드 파티션처럼 움직이기 시작하면 빼고 멈추면 다시 넣는 흐름도 같이 잰다 (전수 검사와 질의 비교, 전체 재구축 횟수)
+    static void RunBVHRefit(FBenchmarkResult& OutResult);
+
+    // BENCH SCENELOAD: 20k 액터 씬 JSON을 ULevel::Serialize로 로드, 이전 선형 FindClass 경로 vs 해시 인덱스 일괄 조회
+    static void RunSceneLoad(FBenchmarkResult& OutResult);
+
+    // BENCH ISA: USkeletalMeshComponent 계층의 IsChildOf, Super 체인을 따라가는 이전 판정 vs 고정 깊이 조상 테이블
+    static void RunIsA(FBenchmarkResult& OutResult);
+
+    // BENCH MAP: 100k 포인터 키로 삽입/조회/순회/삭제, 노드 기반 TMap vs open addressing TFlatMap
+    static void RunMap(FBenchmarkResult& OutResult);
+
+    // BENCH MESHBVH: Data의 사과 스캔 메시로 피킹 BVH 구축, 무작위 레이의 최근접/임의 교차를 전수 검사 vs BVH (결과 불일치 수)
+    static void RunMeshBVH(FBenchmarkResult& OutResult);
+};
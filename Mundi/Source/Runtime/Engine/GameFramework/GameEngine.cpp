@@ -6,6 +6,12 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "PlatformTime.h"
+#include "JobSystem.h"
+#include "SceneTransformStore.h"
+#include "MemoryManager.h"
+#include "FrameArena.h"
+#include "EngineBenchmarks.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -43,6 +49,18 @@ static void SaveIniFile()
         outfile << pair.first << " = " << pair.second << std::endl;
 }
 
+// AVX2로 빌드한 바이너리를 지원하지 않는 CPU에서 띄우면 수학 연산 중 잘못된 명령어로 죽는다
+static bool CheckSimdBackend()
+{
+    UE_LOG("[Math] SIMD backend: %s", VectorGetBackendName());
+    if (!VectorIsBackendSupported())
+    {
+        UE_LOG("[Math] This CPU does not support the %s build. Rebuild without /arch:AVX2.", VectorGetBackendName());
+        return false;
+    }
+    return true;
+}
+
 UGameEngine::UGameEngine()
 {
 
@@ -173,6 +191,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    if (!CheckSimdBackend())
+        return false;
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -183,6 +204,8 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // Initialize audio device for game runtime
     FAudioDevice::Initialize();
 
+    FJobSystem::Get().Initialize();
+
     // 뷰포트 생성
     GameViewport = std::make_unique<FViewport>();
     if (!GameViewport->Initialize(0, 0, ClientWidth, ClientHeight, GetRHIDevice()->GetDevice()))
@@ -199,6 +222,19 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // Preload audio assets
     FAudioDevice::Preload();
 
+    // 시작 scene(level)을 직접 로드 
+    if (!LoadStartupWorld(GDataDir + "/Scenes/PlayScene.scene"))
+    {
+        return false;
+    }
+
+    bPlayActive = true;
+    bRunning = true;
+    return true;
+}
+
+bool UGameEngine::LoadStartupWorld(const FString& ScenePath)
+{
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
     GWorld = WorldContexts[0].World;
@@ -206,11 +242,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     GWorld->bPie = true;
     ///////////////////////////////////
 
-    // 시작 scene(level)을 직접 로드 
-    const FString StartupScenePath = GDataDir + "/Scenes/PlayScene.scene";
-    if (!GWorld->LoadLevelFromFile(UTF8ToWide(StartupScenePath)))
+    if (!GWorld->LoadLevelFromFile(UTF8ToWide(ScenePath)))
     {
-        UE_LOG("Failed to load startup scene: %s", StartupScenePath.c_str());
+        UE_LOG("Failed to load startup scene: %s", ScenePath.c_str());
         return false;
     }
 
@@ -220,12 +254,238 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     {
         Actor->BeginPlay();
     }
+    return true;
+}
+
+// ───────────────────────────────────────────────
+// Headless
+// ───────────────────────────────────────────────
+
+bool FHeadlessRunSettings::ParseCommandLine(const char* CmdLine, FHeadlessRunSettings& OutSettings)
+{
+    if (!CmdLine)
+    {
+        return false;
+    }
+
+    bool bFoundHeadless = false;
+    std::istringstream Stream(CmdLine);
+    FString Token;
+    while (Stream >> Token)
+    {
+        const size_t EqualPos = Token.find('=');
+        const FString Key = Token.substr(0, EqualPos);
+        const FString Value = (EqualPos == FString::npos) ? FString() : Token.substr(EqualPos + 1);
+
+        try
+        {
+            if (Key == "-headless")
+            {
+                bFoundHeadless = true;
+            }
+            else if (Key == "-scene" && !Value.empty())
+            {
+                OutSettings.ScenePath = Value;
+            }
+            else if (Key == "-frames" && !Value.empty())
+            {
+                OutSettings.NumFrames = static_cast<uint32>(std::stoul(Value));
+            }
+            else if (Key == "-dt" && !Value.empty())
+            {
+                OutSettings.FixedDeltaSeconds = std::stof(Value);
+            }
+            else if (Key == "-report" && !Value.empty())
+            {
+                OutSettings.ReportPath = Value;
+            }
+            else if (Key == "-transformsoa")
+            {
+                OutSettings.bUseTransformStore = true;
+            }
+            else if (Key == "-bench" && !Value.empty())
+            {
+                OutSettings.BenchmarkName = Value;
+            }
+        }
+        catch (...) {}
+    }
+    return bFoundHeadless;
+}
+
+bool UGameEngine::StartupHeadless(const FHeadlessRunSettings& InSettings)
+{
+    bHeadless = true;
+    HeadlessSettings = InSettings;
+
+    LoadIniFile();
+
+    if (!CheckSimdBackend())
+        return false;
+
+    // 윈도우/스왑체인/렌더러/뷰포트/오디오 없이 리소스 매니저만 CPU 데이터 전용으로 초기화
+    RHIDevice.InitializeNull();
+
+    FJobSystem::Get().Initialize();
+
+    FObjManager::Preload();
+
+    // 벤치마크는 씬 없이 돈다
+    if (!HeadlessSettings.BenchmarkName.empty())
+    {
+        bRunning = true;
+        return true;
+    }
+
+    // 씬 로드 전에 켜야 컴포넌트가 등록 시점에 저장소로 들어감
+    FSceneTransformStore::Get().SetEnabled(HeadlessSettings.bUseTransformStore);
+
+    const FString ScenePath = HeadlessSettings.ScenePath.empty()
+        ? GDataDir + "/Scenes/PlayScene.scene"
+        : HeadlessSettings.ScenePath;
+    // 씬 로드 시간 (JSON 파싱 + 클래스 조회 + 액터/컴포넌트 생성)은 리포트에 따로 남긴다
+    // (클래스 조회 방식 비교는 -bench=sceneload가 생성한 20k 액터 씬으로 한다)
+    const uint64 LoadStartCycles = FPlatformTime::Cycles64();
+    if (!LoadStartupWorld(ScenePath))
+    {
+        return false;
+    }
+    HeadlessSceneLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStartCycles);
 
     bPlayActive = true;
     bRunning = true;
     return true;
 }
 
+void UGameEngine::RunHeadless()
+{
+    if (!HeadlessSettings.BenchmarkName.empty())
+    {
+        RunHeadlessBenchmark();
+        return;
+    }
+
+    const float DeltaSeconds = HeadlessSettings.FixedDeltaSeconds;
+
+    TArray<double> FrameTimesMs;
+    FrameTimesMs.Reserve(HeadlessSettings.NumFrames);
+    TArray<uint64> FrameHeapAllocs;
+    FrameHeapAllocs.Reserve(HeadlessSettings.NumFrames);
+
+    // 로드/BeginPlay 구간은 리포트에서 제외
+    FScopeCycleCounter::TimeProfileInit();
+
+    for (uint32 Frame = 0; Frame < HeadlessSettings.NumFrames && bRunning; ++Frame)
+    {
+        FFrameArena::BeginFrame();
+        const uint64 HeapAllocsBefore = FMemoryManager::GetHeapAllocationCount();
+        FScopeCycleCounter FrameCounter(TStatId("HeadlessFrame"));
+        Tick(DeltaSeconds);
+        FrameTimesMs.Add(FrameCounter.Finish());
+        FrameHeapAllocs.Add(FMemoryManager::GetHeapAllocationCount() - HeapAllocsBefore);
+        FJobSystem::Get().FlushStats();
+    }
+
+    WriteHeadlessReport(FrameTimesMs, FrameHeapAllocs);
+}
+
+void UGameEngine::RunHeadlessBenchmark() const
+{
+    FBenchmarkResult Result;
+    if (!FEngineBenchmarks::Run(HeadlessSettings.BenchmarkName, Result))
+    {
+        UE_LOG("Unknown benchmark: %s", HeadlessSettings.BenchmarkName.c_str());
+        return;
+    }
+
+    std::ofstream Out(HeadlessSettings.ReportPath);
+    if (!Out.is_open())
+    {
+        return;
+    }
+
+    Out << "Benchmark," << Result.Name << '\n';
+    Out << "Description,\"" << Result.Description << "\"\n";
+    Out << "\nRow," << Result.BaselineLabel << "Ms," << Result.OptimizedLabel << "Ms,Speedup";
+    Out << (Result.bHasError ? ",MaxError\n" : "\n");
+    for (const FBenchmarkRow& Row : Result.Rows)
+    {
+        Out << Row.Label << ',' << Row.BaselineMs << ',' << Row.OptimizedMs << ','
+            << (Row.OptimizedMs > 0.0 ? Row.BaselineMs / Row.OptimizedMs : 0.0);
+        if (Result.bHasError)
+        {
+            Out << ',' << Row.MaxError;
+        }
+        Out << '\n';
+    }
+}
+
+void UGameEngine::WriteHeadlessReport(const TArray<double>& FrameTimesMs, const TArray<uint64>& FrameHeapAllocs) const
+{
+    const int32 NumFrames = FrameTimesMs.Num();
+    if (NumFrames == 0)
+    {
+        return;
+    }
+
+    TArray<double> Sorted = FrameTimesMs;
+    Sorted.Sort();
+    double TotalMs = 0.0;
+    for (double Ms : Sorted)
+    {
+        TotalMs += Ms;
+    }
+    const double AvgMs = TotalMs / NumFrames;
+    const double P95Ms = Sorted[static_cast<int32>((NumFrames - 1) * 0.95)];
+
+    std::ofstream Out(HeadlessSettings.ReportPath);
+    if (!Out.is_open())
+    {
+        return;
+    }
+
+    // 서브시스템별 누적 시간 (TIME_PROFILE 키 단위)
+    Out << "Stat,TotalMs,AvgMsPerFrame,Calls\n";
+    const TArray<FString> Keys = FScopeCycleCounter::GetTimeProfileKeys();
+    for (const FString& Key : Keys)
+    {
+        const FTimeProfile Profile = FScopeCycleCounter::GetTimeProfile(Key);
+        Out << Key << ',' << Profile.Milliseconds << ',' << (Profile.Milliseconds / NumFrames) << ',' << Profile.CallCount << '\n';
+    }
+
+    Out << "\nSceneLoadMs," << HeadlessSceneLoadMs << '\n';
+    Out << "Frames," << NumFrames << '\n';
+    Out << "FrameAvgMs," << AvgMs << '\n';
+    Out << "FrameMinMs," << Sorted[0] << '\n';
+    Out << "FrameP95Ms," << P95Ms << '\n';
+    Out << "FrameMaxMs," << Sorted.Last() << '\n';
+    Out << "TransformStoreEntries," << FSceneTransformStore::Get().Num() << '\n';
+
+    // 스폰이 없는 정상 상태 프레임이면 0이어야 함
+    uint64 TotalHeapAllocs = 0;
+    uint64 MaxHeapAllocs = 0;
+    int32 ZeroAllocFrames = 0;
+    for (uint64 Allocs : FrameHeapAllocs)
+    {
+        TotalHeapAllocs += Allocs;
+        MaxHeapAllocs = std::max(MaxHeapAllocs, Allocs);
+        ZeroAllocFrames += (Allocs == 0) ? 1 : 0;
+    }
+    Out << "HeapAllocsAvgPerFrame," << (static_cast<double>(TotalHeapAllocs) / NumFrames) << '\n';
+    Out << "HeapAllocsMaxPerFrame," << MaxHeapAllocs << '\n';
+    Out << "ZeroHeapAllocFrames," << ZeroAllocFrames << '\n';
+    Out << "FrameArenaHighWaterBytes," << FFrameArena::GetHighWaterMark() << '\n';
+    Out << "FrameArenaReservedBytes," << FFrameArena::GetReservedBytes() << '\n';
+
+    // 태그별 최대 사용량 (메모리 예산 확인용)
+    for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count); ++TagIndex)
+    {
+        const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+        const FMemoryTagStats TagStats = FMemoryManager::GetTagStats(Tag);
+        Out << "MemPeakBytes_" << FMemoryManager::GetTagName(Tag) << ',' << TagStats.PeakBytes << '\n';
+    }
+}
+
 void UGameEngine::Tick(float DeltaSeconds)
 {
     //@TODO UV 스크롤 입력 처리 로직 이동
@@ -240,6 +500,12 @@ void UGameEngine::Tick(float DeltaSeconds)
 
 void UGameEngine::Render()
 {
+    // 헤드리스 모드에는 렌더러가 없음
+    if (!Renderer)
+    {
+        return;
+    }
+
     Renderer->BeginFrame();
 
     if (GWorld)
@@ -295,6 +561,9 @@ void UGameEngine::MainLoop()
 
     while (bRunning)
     {
+        FMemoryManager::BeginFrame();
+        FFrameArena::BeginFrame();
+
         QueryPerformanceCounter(&CurrTime);
         float DeltaSeconds = static_cast<float>((CurrTime.QuadPart - PrevTime.QuadPart) / double(Frequency.QuadPart));
         PrevTime = CurrTime;
@@ -314,6 +583,7 @@ void UGameEngine::MainLoop()
         if (!bRunning) break;
 
         Tick(DeltaSeconds);
+        FJobSystem::Get().FlushStats();
         Render();
 
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
@@ -331,6 +601,8 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    FJobSystem::Get().Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -352,4 +624,7 @@ void UGameEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 모든 해제가 끝난 뒤 태그별로 남은 할당 보고
+    FMemoryManager::ReportLeaks();
 }
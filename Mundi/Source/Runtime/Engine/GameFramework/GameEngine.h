@@ -6,6 +6,26 @@ class D3D11RHI;
 class UWorld;
 class FViewport;
 
+/**
+ * @brief 헤드리스 실행 설정
+ * GPU/윈도우 없이 씬을 고정 델타로 N 프레임 돌린 뒤 서브시스템별 시간을 리포트한다.
+ * 커맨드라인 예: -headless -scene=Data/Scenes/PlayScene.scene -frames=600 -dt=0.016 -report=HeadlessProfile.csv
+ * -transformsoa를 주면 SoA 트랜스폼 저장소(FSceneTransformStore)를 켠 상태로 측정한다.
+ * -bench=<이름>을 주면 씬 대신 FEngineBenchmarks의 벤치마크를 한 번 돌리고 그 결과를 리포트로 쓴다 (예: -bench=math).
+ */
+struct FHeadlessRunSettings
+{
+    FString ScenePath;                          // 비어있으면 기본 PlayScene
+    uint32 NumFrames = 600;
+    float FixedDeltaSeconds = 1.0f / 60.0f;
+    FString ReportPath = "HeadlessProfile.csv";
+    bool bUseTransformStore = false;
+    FString BenchmarkName;                      // 비어있으면 씬 시뮬레이션
+
+    // -headless 플래그가 있으면 true를 반환하고 나머지 옵션을 채운다
+    static bool ParseCommandLine(const char* CmdLine, FHeadlessRunSettings& OutSettings);
+};
+
 class UGameEngine final
 {
 public:
@@ -16,6 +36,11 @@ public:
     void MainLoop();
     void Shutdown();
 
+    // 헤드리스 모드: Null 디바이스로 시작하고 렌더링 없이 틱만 수행
+    bool StartupHeadless(const FHeadlessRunSettings& InSettings);
+    void RunHeadless();
+    bool IsHeadless() const { return bHeadless; }
+
     bool IsPlayActive() const { return bPlayActive; }
 
     HWND GetHWND() const { return HWnd; }
@@ -35,9 +60,14 @@ private:
     static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
     static void GetViewportSize(HWND hWnd);
 
+    bool LoadStartupWorld(const FString& ScenePath);
+
     void Tick(float DeltaSeconds);
     void Render();
 
+    void WriteHeadlessReport(const TArray<double>& FrameTimesMs, const TArray<uint64>& FrameHeapAllocs) const;
+    void RunHeadlessBenchmark() const;
+
     void HandleUVInput(float DeltaSeconds);
 
 private:
@@ -58,6 +88,9 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPlayActive = false;
+    bool bHeadless = false;
+    FHeadlessRunSettings HeadlessSettings;
+    double HeadlessSceneLoadMs = 0.0;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
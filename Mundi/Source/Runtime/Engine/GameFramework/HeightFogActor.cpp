@@ -9,6 +9,7 @@
 AHeightFogActor::AHeightFogActor()
 {
 	ObjectName = "Height Fog Actor";
+	bTickOnlyWithComponents = true;
 	RootComponent = CreateDefaultSubobject<UHeightFogComponent>("HeightFogComponent");
 
 }
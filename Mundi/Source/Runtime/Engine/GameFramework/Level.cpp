@@ -96,18 +96,28 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         JSON ActorListJson;
         if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
         {
-            // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
+            // 1) 타입 문자열을 모아 클래스를 한 번에 조회 (같은 타입은 한 번만 해석)
+            TArray<FString> TypeStrings;
+            for (auto& Pair : ActorListJson.ObjectRange())
+            {
+                FString TypeString;
+                FJsonSerializer::ReadString(Pair.second, "Type", TypeString);
+                TypeStrings.Add(TypeString);
+            }
+
+            TArray<UClass*> ActorClasses;
+            UClass::FindClasses(TypeStrings, ActorClasses);
+
+            // 2) ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
+            int32 ActorIndex = 0;
             for (auto& Pair : ActorListJson.ObjectRange())
             {
                 // Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
                 const FString& IdString = Pair.first;
                 JSON& ActorDataJson = Pair.second;
 
-                FString TypeString;
-                FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
-
                 //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-                UClass* NewClass = UClass::FindClass(TypeString);
+                UClass* NewClass = ActorClasses[ActorIndex++];
 
                 UWorld* World = GWorld;
 
@@ -9,6 +9,7 @@
 APointLightActor::APointLightActor()
 {
 	ObjectName = "Point Light Actor";
+	bTickOnlyWithComponents = true;
 	LightComponent = CreateDefaultSubobject<UPointLightComponent>("PointLightComponent");
 
 	RootComponent = LightComponent;
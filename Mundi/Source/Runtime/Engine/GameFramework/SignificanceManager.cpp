@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "SignificanceManager.h"
+#include "Actor.h"
+#include "World.h"
+#include "CameraActor.h"
+#include "CameraComponent.h"
+#include "PlayerCameraManager.h"
+#include "PlatformTime.h"
+
+void FSignificanceManager::BeginFrame(UWorld* World, uint64 InFrameStartCycles)
+{
+    FrameStartCycles = InFrameStartCycles;
+    bHasView = false;
+
+    if (!World || !Settings.bEnabled)
+    {
+        return;
+    }
+
+    // PIE는 플레이어 카메라, 에디터는 메인 뷰포트 카메라 기준
+    UCameraComponent* ViewCamera = nullptr;
+    if (World->bPie)
+    {
+        if (APlayerCameraManager* CameraManager = World->GetPlayerCameraManager())
+        {
+            ViewCamera = CameraManager->GetViewCamera();
+        }
+    }
+    else if (ACameraActor* EditorCamera = World->GetEditorCameraActor())
+    {
+        ViewCamera = EditorCamera->GetCameraComponent();
+    }
+
+    if (!ViewCamera)
+    {
+        return;
+    }
+
+    bHasView = true;
+    ViewLocation = ViewCamera->GetWorldLocation();
+    ViewForward = ViewCamera->GetForward();
+
+    // FOV는 수직 기준이므로 가로 화면을 덮도록 넉넉하게 잡는다
+    const float HalfAngle = FMath::Clamp(ViewCamera->GetFOV(), 30.0f, 89.0f);
+    ViewCosHalfFov = std::cos(DegreesToRadians(HalfAngle));
+}
+
+void FSignificanceManager::EndFrame(double TickMs)
+{
+    LastTickMs = TickMs;
+
+    if (Settings.TickBudgetMs <= 0.0f)
+    {
+        BudgetScale = 1.0f;
+        return;
+    }
+
+    // 예산을 넘으면 주기를 빠르게 늘리고, 여유가 생기면 천천히 되돌린다
+    if (TickMs > Settings.TickBudgetMs)
+    {
+        BudgetScale = FMath::Min(BudgetScale * 1.25f, 4.0f);
+    }
+    else if (TickMs < Settings.TickBudgetMs * 0.75)
+    {
+        BudgetScale = FMath::Max(BudgetScale * 0.9f, 1.0f);
+    }
+}
+
+float FSignificanceManager::ComputeSignificance(AActor* Actor) const
+{
+    if (!IsActive() || !Actor)
+    {
+        return 1.0f;
+    }
+
+    const FVector ToActor = Actor->GetActorLocation() - ViewLocation;
+    const float Distance = ToActor.Size();
+
+    const float Range = FMath::Max(Settings.MinRateDistance - Settings.FullRateDistance, 0.001f);
+    float Significance = 1.0f - FMath::Clamp((Distance - Settings.FullRateDistance) / Range, 0.0f, 1.0f);
+
+    if (!Actor->IsActorVisible())
+    {
+        Significance *= Settings.HiddenScale;
+    }
+    else if (Distance > Settings.FullRateDistance && FVector::Dot(ToActor, ViewForward) < ViewCosHalfFov * Distance)
+    {
+        // 시야 원뿔 밖 (가까운 액터는 뒤에 있어도 유지)
+        Significance *= Settings.OffscreenScale;
+    }
+
+    return Significance;
+}
+
+float FSignificanceManager::GetTickIntervalForSignificance(float Significance) const
+{
+    // 단계별 주기: 매 프레임 / 30Hz / 10Hz / 최저
+    float Interval = 0.0f;
+    if (Significance >= 0.75f)
+    {
+        Interval = 0.0f;
+    }
+    else if (Significance >= 0.4f)
+    {
+        Interval = 1.0f / 30.0f;
+    }
+    else if (Significance >= 0.15f)
+    {
+        Interval = 0.1f;
+    }
+    else
+    {
+        Interval = Settings.MaxThrottleInterval;
+    }
+
+    return Interval * BudgetScale;
+}
+
+bool FSignificanceManager::IsOverBudget() const
+{
+    if (Settings.TickBudgetMs <= 0.0f)
+    {
+        return false;
+    }
+
+    return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStartCycles) > Settings.TickBudgetMs;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Vector.h"
+
+class UWorld;
+class AActor;
+
+/** 중요도 계산/예산 설정 (거리 단위는 월드 단위) */
+struct FSignificanceSettings
+{
+    // 기본 꺼짐: 틱 빈도가 바뀌면 게임플레이 결과가 달라질 수 있으므로 TICK SIGNIFICANCE ON으로 명시적으로 켠다
+    bool bEnabled = false;
+
+    float FullRateDistance = 15.0f;     // 이 거리 안쪽은 매 프레임
+    float MinRateDistance = 60.0f;      // 이 거리 바깥은 최저 빈도
+    float HiddenScale = 0.25f;          // 숨김 액터 중요도 배율
+    float OffscreenScale = 0.5f;        // 카메라 시야 밖 액터 중요도 배율
+
+    float MaxThrottleInterval = 0.25f;  // 최저 중요도 액터의 틱 주기 (초)
+
+    // 게임플레이 틱 예산. 0이면 끔.
+    // 넘으면 남은 제한 가능 틱은 다음 프레임으로 미루고(누적 델타 유지), 다음 프레임 주기를 늘린다
+    float TickBudgetMs = 0.0f;
+    float MaxDeferSeconds = 0.5f;       // 예산 때문에 이 시간 이상 밀린 틱은 강제로 실행
+};
+
+/**
+ * @brief 틱 빈도 조절용 중요도 매니저
+ * 플레이어(PIE) 또는 에디터 카메라와의 거리, 가시성으로 액터 중요도(0~1)를 매기고
+ * 낮은 중요도일수록 긴 틱 주기를 돌려준다. FTickTaskManager가 제한 가능 틱(CanThrottleTick)에만 적용한다.
+ */
+class FSignificanceManager
+{
+public:
+    // 프레임 시작 시 게임 스레드에서 호출 (뷰 위치 갱신)
+    void BeginFrame(UWorld* World, uint64 InFrameStartCycles);
+    // 이번 프레임 틱에 쓴 시간으로 다음 프레임 주기 배율 조정
+    void EndFrame(double TickMs);
+
+    float ComputeSignificance(AActor* Actor) const;
+    float GetTickIntervalForSignificance(float Significance) const;
+
+    // 워커에서도 호출 가능 (읽기 전용)
+    bool IsOverBudget() const;
+    float GetMaxDeferSeconds() const { return Settings.MaxDeferSeconds; }
+
+    FSignificanceSettings& GetSettings() { return Settings; }
+    const FSignificanceSettings& GetSettings() const { return Settings; }
+    bool IsActive() const { return Settings.bEnabled && bHasView; }
+    float GetBudgetScale() const { return BudgetScale; }
+    double GetLastTickMs() const { return LastTickMs; }
+
+private:
+    FSignificanceSettings Settings;
+
+    bool bHasView = false;
+    FVector ViewLocation;
+    FVector ViewForward;
+    float ViewCosHalfFov = 0.0f;
+
+    uint64 FrameStartCycles = 0;
+    float BudgetScale = 1.0f;           // 예산 초과가 이어지면 최대 4배까지 주기를 늘림
+    double LastTickMs = 0.0;
+};
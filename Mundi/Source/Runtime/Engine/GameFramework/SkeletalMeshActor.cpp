@@ -9,12 +9,19 @@
 ASkeletalMeshActor::ASkeletalMeshActor()
 {
     ObjectName = "Skeletal Mesh Actor";
+    // 배치용 메시는 멀리 있으면 애니메이션 틱 빈도를 낮춰도 됨
+    bAllowTickThrottling = true;
 
     // 스킨드 메시 렌더용 컴포넌트 생성 및 루트로 설정
     // - 프리뷰 장면에서 메시를 표시하는 실제 렌더링 컴포넌트
     SkeletalMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>("SkeletalMeshComponent");
     RootComponent = SkeletalMeshComponent;
 
+    // 애니메이션 평가는 자기 포즈 버퍼만 쓰고 Lua Notify는 게임 스레드로 미뤄지므로 워커에서 틱해도 됨
+    // (게임 스레드 전용 컴포넌트가 붙으면 AActor::CanTickOnAnyThread가 알아서 게임 스레드로 내림)
+    SetAllowTickOnAnyThread(true);
+    SkeletalMeshComponent->SetTickOnAnyThread(true);
+
     // AnimInstance는 애니메이션 탭에서 애니메이션을 선택할 때 생성됨
 }
 
@@ -266,6 +273,11 @@ void ASkeletalMeshActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     if (bInIsLoading)
     {
         SkeletalMeshComponent = Cast<USkeletalMeshComponent>(RootComponent);
+        // 로드로 새로 만든 루트 컴포넌트에도 생성자와 같은 틱 스레드 설정 적용
+        if (SkeletalMeshComponent)
+        {
+            SkeletalMeshComponent->SetTickOnAnyThread(true);
+        }
     }
 }
 
@@ -9,6 +9,7 @@
 ASpotLightActor::ASpotLightActor()
 {
 	ObjectName = "Spot Light Actor";
+	bTickOnlyWithComponents = true;
 	LightComponent = CreateDefaultSubobject<USpotLightComponent>("SpotLightComponent");
 
 	RootComponent = LightComponent;
@@ -16,6 +16,10 @@ AStaticMeshActor::AStaticMeshActor()
     
     // 루트 교체
     RootComponent = StaticMeshComponent;
+
+    // 배치용 정적 메시는 틱 컴포넌트를 붙였을 때만 월드 틱 목록에 오른다
+    bTickOnlyWithComponents = true;
+    bAllowTickThrottling = true;
 }
  
 void AStaticMeshActor::Tick(float DeltaTime)
@@ -0,0 +1,611 @@
+#include "pch.h"
+#include "TickTaskManager.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "World.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 준비된 노드는 묶음 단위로 잡에 넣는다 (노드당 잡 하나는 수천 액터에서 분배 비용이 큼)
+    constexpr int32 TickBatchSize = 16;
+}
+
+const char* FTickTaskManager::GetTickGroupName(ETickingGroup Group)
+{
+    switch (Group)
+    {
+    case ETickingGroup::PrePhysics:     return "TickGroup_PrePhysics";
+    case ETickingGroup::DuringPhysics:  return "TickGroup_DuringPhysics";
+    case ETickingGroup::PostPhysics:    return "TickGroup_PostPhysics";
+    case ETickingGroup::PostUpdateWork: return "TickGroup_PostUpdateWork";
+    default:                            return "TickGroup_Unknown";
+    }
+}
+
+void FTickTaskManager::RunTickGroups(bool bIsPie)
+{
+    const bool bRebuild = bTickListDirty || bIsPie != bLastIsPie;
+    if (bRebuild)
+    {
+        RebuildTickList(bIsPie);
+    }
+
+    Stats.NumParallelTicks = 0;
+    Stats.NumGameThreadTicks = 0;
+    Stats.NumCycleBreaks = 0;
+    Stats.bTickListRebuilt = bRebuild;
+
+    if (Nodes.IsEmpty())
+    {
+        FlushGameThreadTasks();
+        return;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    SignificanceManager.BeginFrame(World, StartCycles);
+    IntervalSkipCount.store(0, std::memory_order_relaxed);
+    BudgetDeferCount.store(0, std::memory_order_relaxed);
+
+    UpdateDeltaSeconds();
+    UpdateSignificance();
+
+    constexpr int32 NumGroups = static_cast<int32>(ETickingGroup::Max);
+    for (int32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+    {
+        if (ParallelRanges[GroupIndex].IsEmpty() && GameThreadRanges[GroupIndex].IsEmpty())
+        {
+            continue;
+        }
+
+        FScopeCycleCounter GroupCounter{ TStatId(GetTickGroupName(static_cast<ETickingGroup>(GroupIndex))) };
+
+        RunParallelPhase(ParallelRanges[GroupIndex]);
+        FlushGameThreadTasks();
+
+        RunSerialPhase(GameThreadRanges[GroupIndex]);
+        FlushGameThreadTasks();
+    }
+
+    SignificanceManager.EndFrame(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+    Stats.NumIntervalSkips = IntervalSkipCount.load(std::memory_order_relaxed);
+    Stats.NumBudgetDeferrals = BudgetDeferCount.load(std::memory_order_relaxed);
+}
+
+void FTickTaskManager::RegisterActor(AActor* Actor)
+{
+    if (!Actor || RegisteredActorIndices.Contains(Actor))
+    {
+        return;
+    }
+
+    RegisteredActorIndices.Add(Actor, RegisteredActors.Num());
+    RegisteredActors.Add(Actor);
+    bTickListDirty = true;
+}
+
+void FTickTaskManager::UnregisterActor(AActor* Actor)
+{
+    const int32* Index = RegisteredActorIndices.Find(Actor);
+    if (!Index)
+    {
+        return;
+    }
+
+    // 순서 유지를 위해 자리만 비워두고 재구성 때 압축
+    RegisteredActors[*Index] = nullptr;
+    RegisteredActorIndices.Remove(Actor);
+    bTickListDirty = true;
+}
+
+void FTickTaskManager::UnregisterAllActors()
+{
+    RegisteredActors.Empty();
+    RegisteredActorIndices.Empty();
+    Nodes.Empty();
+    bTickListDirty = true;
+}
+
+void FTickTaskManager::EnqueueGameThreadTask(std::function<void()> Task)
+{
+    std::lock_guard<std::mutex> Lock(GameThreadTaskLock);
+    GameThreadTasks.Add(std::move(Task));
+}
+
+void FTickTaskManager::FlushGameThreadTasks()
+{
+    TArray<std::function<void()>> Tasks;
+    {
+        std::lock_guard<std::mutex> Lock(GameThreadTaskLock);
+        Tasks.swap(GameThreadTasks);
+    }
+
+    for (std::function<void()>& Task : Tasks)
+    {
+        Task();
+    }
+}
+
+void FTickTaskManager::RebuildTickList(bool bIsPie)
+{
+    bTickListDirty = false;
+    bLastIsPie = bIsPie;
+
+    // 해제된 자리 압축
+    int32 WriteIndex = 0;
+    for (int32 ReadIndex = 0; ReadIndex < RegisteredActors.Num(); ++ReadIndex)
+    {
+        if (AActor* Actor = RegisteredActors[ReadIndex])
+        {
+            RegisteredActors[WriteIndex] = Actor;
+            RegisteredActorIndices.Add(Actor, WriteIndex);
+            ++WriteIndex;
+        }
+    }
+    RegisteredActors.SetNum(WriteIndex);
+
+    Stats.NumPrerequisiteEdges = 0;
+
+    BuildNodes(bIsPie);
+    if (bHasPrerequisites)
+    {
+        ResolvePrerequisites();
+    }
+    SortNodesByGroup();
+
+    if (PendingCapacity < Nodes.Num())
+    {
+        PendingCapacity = Nodes.Num();
+        PendingCounts = std::make_unique<std::atomic<int32>[]>(PendingCapacity);
+    }
+
+    Stats.NumThrottleCandidates = 0;
+    for (const FTickNode& Node : Nodes)
+    {
+        Stats.NumThrottleCandidates += Node.bCanThrottle ? 1u : 0u;
+    }
+    Stats.NumRegisteredActors = static_cast<uint32>(RegisteredActors.Num());
+    Stats.NumTickFunctions = static_cast<uint32>(Nodes.Num());
+}
+
+void FTickTaskManager::BuildNodes(bool bIsPie)
+{
+    Nodes.Empty();
+    bHasPrerequisites = false;
+
+    for (AActor* Actor : RegisteredActors)
+    {
+        // 틱할 일이 없는 액터(틱 컴포넌트 없는 배치용 메시 등)는 목록에서 빠진다
+        if (!Actor->NeedsTickFunction(bIsPie))
+        {
+            continue;
+        }
+
+        const ETickingGroup ActorGroup = Actor->GetTickGroup();
+
+        FTickNode& ActorNode = Nodes.emplace_back();
+        ActorNode.Actor = Actor;
+        ActorNode.Group = ActorGroup;
+        ActorNode.bGameThread = !Actor->CanTickOnAnyThread();
+        ActorNode.bCanThrottle = Actor->CanThrottleTick();
+        bHasPrerequisites |= Actor->HasTickPrerequisites();
+
+        for (UActorComponent* Comp : Actor->GetTickComponents())
+        {
+            bHasPrerequisites |= Comp->HasTickPrerequisites();
+
+            // 액터보다 늦은 그룹의 컴포넌트만 독립 노드가 된다 (on-off 여부는 실행 시점에 확인)
+            if (Comp->GetTickGroup() <= ActorGroup)
+            {
+                continue;
+            }
+
+            FTickNode& CompNode = Nodes.emplace_back();
+            CompNode.Actor = Actor;
+            CompNode.Component = Comp;
+            CompNode.Group = Comp->GetTickGroup();
+            CompNode.bGameThread = !Comp->CanTickOnAnyThread();
+            CompNode.bCanThrottle = Comp->CanThrottleTick();
+        }
+    }
+}
+
+void FTickTaskManager::ResolvePrerequisites()
+{
+    // 선행 대상 포인터는 역참조하지 않고 이번 프레임 노드와의 매칭에만 사용
+    TMap<const AActor*, int32> ActorToNode;
+    TMap<const UActorComponent*, int32> ComponentToNode;
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        if (Nodes[NodeIndex].Component)
+        {
+            ComponentToNode[Nodes[NodeIndex].Component] = NodeIndex;
+        }
+    }
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        const FTickNode& Node = Nodes[NodeIndex];
+        if (Node.Component)
+        {
+            continue;
+        }
+
+        ActorToNode[Node.Actor] = NodeIndex;
+
+        // 독립 노드가 없는 컴포넌트는 소유 액터의 틱과 함께 끝난 것으로 본다
+        for (UActorComponent* Comp : Node.Actor->GetOwnedComponents())
+        {
+            ComponentToNode.insert({ Comp, NodeIndex });
+        }
+    }
+
+    auto AddEdge = [this](int32 NodeIndex, const int32* PrerequisiteIndex)
+    {
+        if (PrerequisiteIndex && *PrerequisiteIndex != NodeIndex)
+        {
+            Nodes[NodeIndex].Prerequisites.AddUnique(*PrerequisiteIndex);
+        }
+    };
+    auto AddEdgesFrom = [&](int32 NodeIndex, const TArray<TWeakObjectPtr<AActor>>& Actors, const TArray<TWeakObjectPtr<UActorComponent>>& Components)
+    {
+        for (const TWeakObjectPtr<AActor>& Prerequisite : Actors)
+        {
+            AddEdge(NodeIndex, ActorToNode.Find(Prerequisite.Get()));
+        }
+        for (const TWeakObjectPtr<UActorComponent>& Prerequisite : Components)
+        {
+            AddEdge(NodeIndex, ComponentToNode.Find(Prerequisite.Get()));
+        }
+    };
+
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        FTickNode& Node = Nodes[NodeIndex];
+        if (Node.Component)
+        {
+            AddEdgesFrom(NodeIndex, Node.Component->GetTickPrerequisiteActors(), Node.Component->GetTickPrerequisiteComponents());
+            continue;
+        }
+
+        AddEdgesFrom(NodeIndex, Node.Actor->GetTickPrerequisiteActors(), Node.Actor->GetTickPrerequisiteComponents());
+
+        // 액터 틱에 포함되는 컴포넌트의 선행 조건은 액터 노드의 선행 조건이 된다
+        for (UActorComponent* Comp : Node.Actor->GetTickComponents())
+        {
+            if (Comp->GetTickGroup() <= Node.Group && Comp->HasTickPrerequisites())
+            {
+                AddEdgesFrom(NodeIndex, Comp->GetTickPrerequisiteActors(), Comp->GetTickPrerequisiteComponents());
+            }
+        }
+    }
+
+    // 그룹/스레드 강등: 선행 노드보다 이른 그룹일 수 없고, 같은 그룹의 게임 스레드 노드를 기다리면 게임 스레드 단계로 내려간다
+    // (둘 다 단조 증가라 반드시 수렴)
+    bool bChanged = true;
+    while (bChanged)
+    {
+        bChanged = false;
+        for (FTickNode& Node : Nodes)
+        {
+            for (int32 PrerequisiteIndex : Node.Prerequisites)
+            {
+                const FTickNode& Prerequisite = Nodes[PrerequisiteIndex];
+                if (Prerequisite.Group > Node.Group)
+                {
+                    Node.Group = Prerequisite.Group;
+                    bChanged = true;
+                }
+                if (Prerequisite.Group == Node.Group && Prerequisite.bGameThread && !Node.bGameThread)
+                {
+                    Node.bGameThread = true;
+                    bChanged = true;
+                }
+            }
+        }
+    }
+
+    // 같은 그룹/같은 단계 안의 간선만 실행 시점에 추적 (이전 그룹/병렬 단계는 이미 끝나 있음)
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        const FTickNode& Node = Nodes[NodeIndex];
+        for (int32 PrerequisiteIndex : Node.Prerequisites)
+        {
+            FTickNode& Prerequisite = Nodes[PrerequisiteIndex];
+            if (Prerequisite.Group == Node.Group && Prerequisite.bGameThread == Node.bGameThread)
+            {
+                Prerequisite.Dependents.Add(NodeIndex);
+            }
+        }
+        Stats.NumPrerequisiteEdges += static_cast<uint32>(Node.Prerequisites.Num());
+    }
+}
+
+void FTickTaskManager::SortNodesByGroup()
+{
+    // (그룹, 단계) 버킷으로 안정 계수 정렬 → 프레임마다 연속 구간만 순회
+    constexpr int32 NumGroups = static_cast<int32>(ETickingGroup::Max);
+    constexpr int32 NumBuckets = NumGroups * 2;
+    auto GetBucket = [](const FTickNode& Node)
+    {
+        return static_cast<int32>(Node.Group) * 2 + (Node.bGameThread ? 1 : 0);
+    };
+
+    int32 BucketStart[NumBuckets + 1] = {};
+    for (const FTickNode& Node : Nodes)
+    {
+        ++BucketStart[GetBucket(Node) + 1];
+    }
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        BucketStart[Bucket + 1] += BucketStart[Bucket];
+    }
+
+    for (int32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+    {
+        ParallelRanges[GroupIndex] = { BucketStart[GroupIndex * 2], BucketStart[GroupIndex * 2 + 1] };
+        GameThreadRanges[GroupIndex] = { BucketStart[GroupIndex * 2 + 1], BucketStart[GroupIndex * 2 + 2] };
+    }
+
+    TArray<int32> NewIndices;
+    NewIndices.SetNum(Nodes.Num());
+    int32 BucketCursor[NumBuckets];
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        BucketCursor[Bucket] = BucketStart[Bucket];
+    }
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        NewIndices[NodeIndex] = BucketCursor[GetBucket(Nodes[NodeIndex])]++;
+    }
+
+    TArray<FTickNode> SortedNodes;
+    SortedNodes.SetNum(Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        FTickNode& Node = Nodes[NodeIndex];
+        for (int32& PrerequisiteIndex : Node.Prerequisites)
+        {
+            PrerequisiteIndex = NewIndices[PrerequisiteIndex];
+        }
+        for (int32& DependentIndex : Node.Dependents)
+        {
+            DependentIndex = NewIndices[DependentIndex];
+        }
+        SortedNodes[NewIndices[NodeIndex]] = std::move(Node);
+    }
+    Nodes = std::move(SortedNodes);
+}
+
+void FTickTaskManager::UpdateDeltaSeconds()
+{
+    const float GameDeltaSeconds = World->GetDeltaTime(EDeltaTime::Game);
+
+    // 개별 시간 배율이 걸린 액터가 없으면 조회 생략
+    if (World->ActorTimingMap.IsEmpty())
+    {
+        for (FTickNode& Node : Nodes)
+        {
+            Node.DeltaSeconds = GameDeltaSeconds;
+        }
+        return;
+    }
+
+    // ActorTimingMap은 게임 스레드 전용이므로 병렬 실행 전에 미리 계산
+    for (FTickNode& Node : Nodes)
+    {
+        Node.DeltaSeconds = GameDeltaSeconds * Node.Actor->GetCustomTimeDillation();
+    }
+}
+
+void FTickTaskManager::UpdateSignificance()
+{
+    const bool bActive = SignificanceManager.IsActive() && Stats.NumThrottleCandidates > 0;
+
+    // 빈도 조절 대상 노드만 거리/가시성으로 주기를 정한다 (나머지는 TickInterval만 적용)
+    for (FTickNode& Node : Nodes)
+    {
+        Node.SignificanceInterval = 0.0f;
+        if (bActive && Node.bCanThrottle)
+        {
+            const float Significance = SignificanceManager.ComputeSignificance(Node.Actor);
+            Node.SignificanceInterval = SignificanceManager.GetTickIntervalForSignificance(Significance);
+        }
+    }
+}
+
+void FTickTaskManager::RunParallelPhase(const FNodeRange& Range)
+{
+    if (Range.IsEmpty())
+    {
+        return;
+    }
+
+    FJobSystem& JobSystem = FJobSystem::Get();
+    if (!JobSystem.IsInitialized() || Range.Num() == 1)
+    {
+        RunSerialPhase(Range);
+        return;
+    }
+
+    Stats.NumParallelTicks += static_cast<uint32>(Range.Num());
+
+    TArray<int32> ReadyNodes;
+    ReadyNodes.Reserve(Range.Num());
+    for (int32 NodeIndex = Range.Begin; NodeIndex < Range.End; ++NodeIndex)
+    {
+        int32 NumPending = 0;
+        for (int32 PrerequisiteIndex : Nodes[NodeIndex].Prerequisites)
+        {
+            const FTickNode& Prerequisite = Nodes[PrerequisiteIndex];
+            if (Prerequisite.Group == Nodes[NodeIndex].Group && !Prerequisite.bGameThread)
+            {
+                ++NumPending;
+            }
+        }
+        PendingCounts[NodeIndex].store(NumPending, std::memory_order_relaxed);
+        if (NumPending == 0)
+        {
+            ReadyNodes.Add(NodeIndex);
+        }
+    }
+
+    NumExecuted.store(0, std::memory_order_relaxed);
+    bInParallelPhase.store(true, std::memory_order_relaxed);
+    FJobCounter Counter;
+    for (int32 Begin = 0; Begin < ReadyNodes.Num(); Begin += TickBatchSize)
+    {
+        const int32 End = std::min(Begin + TickBatchSize, ReadyNodes.Num());
+        JobSystem.Dispatch([this, &ReadyNodes, Begin, End, &Counter]()
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                ExecuteNode(ReadyNodes[Index]);
+                ReleaseDependents(ReadyNodes[Index], &Counter);
+            }
+        }, &Counter);
+    }
+    JobSystem.WaitForCounter(Counter);
+
+    // 순환 선행 조건으로 풀리지 못한 노드는 순서를 무시하고 게임 스레드에서 실행
+    if (NumExecuted.load(std::memory_order_acquire) < Range.Num())
+    {
+        for (int32 NodeIndex = Range.Begin; NodeIndex < Range.End; ++NodeIndex)
+        {
+            if (PendingCounts[NodeIndex].load(std::memory_order_relaxed) > 0)
+            {
+                ExecuteNode(NodeIndex);
+                ++Stats.NumCycleBreaks;
+            }
+        }
+    }
+    bInParallelPhase.store(false, std::memory_order_relaxed);
+}
+
+void FTickTaskManager::ReleaseDependents(int32 NodeIndex, FJobCounter* Counter)
+{
+    for (int32 DependentIndex : Nodes[NodeIndex].Dependents)
+    {
+        if (PendingCounts[DependentIndex].fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            FJobSystem::Get().Dispatch([this, DependentIndex, Counter]()
+            {
+                ExecuteNode(DependentIndex);
+                ReleaseDependents(DependentIndex, Counter);
+            }, Counter);
+        }
+    }
+}
+
+void FTickTaskManager::RunSerialPhase(const FNodeRange& Range)
+{
+    if (Range.IsEmpty())
+    {
+        return;
+    }
+
+    Stats.NumGameThreadTicks += static_cast<uint32>(Range.Num());
+
+    if (!bHasPrerequisites)
+    {
+        for (int32 NodeIndex = Range.Begin; NodeIndex < Range.End; ++NodeIndex)
+        {
+            ExecuteNode(NodeIndex);
+        }
+        return;
+    }
+
+    // 선행 조건 순서를 지키는 안정 위상 정렬 (준비된 노드는 원래 순서대로)
+    std::deque<int32> ReadyNodes;
+    for (int32 NodeIndex = Range.Begin; NodeIndex < Range.End; ++NodeIndex)
+    {
+        const FTickNode& Node = Nodes[NodeIndex];
+        int32 NumPending = 0;
+        for (int32 PrerequisiteIndex : Node.Prerequisites)
+        {
+            const FTickNode& Prerequisite = Nodes[PrerequisiteIndex];
+            if (Prerequisite.Group == Node.Group && Prerequisite.bGameThread == Node.bGameThread)
+            {
+                ++NumPending;
+            }
+        }
+        PendingCounts[NodeIndex].store(NumPending, std::memory_order_relaxed);
+        if (NumPending == 0)
+        {
+            ReadyNodes.push_back(NodeIndex);
+        }
+    }
+
+    while (!ReadyNodes.empty())
+    {
+        const int32 NodeIndex = ReadyNodes.front();
+        ReadyNodes.pop_front();
+        ExecuteNode(NodeIndex);
+
+        for (int32 DependentIndex : Nodes[NodeIndex].Dependents)
+        {
+            if (PendingCounts[DependentIndex].fetch_sub(1, std::memory_order_relaxed) == 1)
+            {
+                ReadyNodes.push_back(DependentIndex);
+            }
+        }
+    }
+
+    // 순환 선행 조건: 남은 노드는 원래 순서대로
+    for (int32 NodeIndex = Range.Begin; NodeIndex < Range.End; ++NodeIndex)
+    {
+        if (PendingCounts[NodeIndex].load(std::memory_order_relaxed) > 0)
+        {
+            ExecuteNode(NodeIndex);
+            ++Stats.NumCycleBreaks;
+        }
+    }
+}
+
+void FTickTaskManager::ExecuteNode(int32 NodeIndex)
+{
+    const FTickNode& Node = Nodes[NodeIndex];
+
+    // 같은 프레임 앞선 틱에서 비활성화됐을 수 있음
+    if (Node.Actor->IsActorActive() && (!Node.Component || Node.Component->IsComponentTickEnabled()))
+    {
+        float Interval = Node.Component ? Node.Component->GetTickInterval() : Node.Actor->GetTickInterval();
+        Interval = Interval > Node.SignificanceInterval ? Interval : Node.SignificanceInterval;
+
+        // 예산 초과: 빈도 조절 가능한 틱은 너무 오래 밀리지 않은 한 다음 프레임으로
+        bool bDeferredByBudget = false;
+        if (Node.bCanThrottle && SignificanceManager.IsOverBudget())
+        {
+            const float MaxDeferSeconds = SignificanceManager.GetMaxDeferSeconds();
+            bDeferredByBudget = Interval < MaxDeferSeconds;
+            Interval = bDeferredByBudget ? MaxDeferSeconds : Interval;
+        }
+
+        float TickDeltaSeconds = 0.0f;
+        const bool bShouldTick = Node.Component
+            ? Node.Component->ConsumeTickTime(Node.DeltaSeconds, Interval, TickDeltaSeconds)
+            : Node.Actor->ConsumeTickTime(Node.DeltaSeconds, Interval, TickDeltaSeconds);
+
+        if (bShouldTick)
+        {
+            if (Node.Component)
+            {
+                Node.Component->TickComponent(TickDeltaSeconds);
+            }
+            else
+            {
+                Node.Actor->Tick(TickDeltaSeconds);
+            }
+        }
+        else if (bDeferredByBudget)
+        {
+            BudgetDeferCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            IntervalSkipCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    NumExecuted.fetch_add(1, std::memory_order_relaxed);
+}
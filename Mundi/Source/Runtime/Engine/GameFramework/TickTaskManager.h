@@ -0,0 +1,129 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include "Enums.h"
+#include "SignificanceManager.h"
+
+class UWorld;
+class AActor;
+class UActorComponent;
+
+/** 한 프레임 틱 통계 (그룹 합계) */
+struct FTickStats
+{
+    uint32 NumParallelTicks = 0;     // 워커에서 돈 틱 수
+    uint32 NumGameThreadTicks = 0;   // 게임 스레드 단계에서 돈 틱 수
+    uint32 NumPrerequisiteEdges = 0;
+    uint32 NumCycleBreaks = 0;       // 순환 선행 조건 때문에 순서를 무시하고 실행한 틱 수
+    uint32 NumRegisteredActors = 0;  // 틱 목록에 등록된 액터 수
+    uint32 NumTickFunctions = 0;     // 이번 프레임 틱 노드 수 (액터 + 분리된 컴포넌트)
+    bool bTickListRebuilt = false;   // 이번 프레임에 틱 목록을 다시 만들었는지
+    uint32 NumThrottleCandidates = 0; // 중요도 빈도 조절 대상 노드 수
+    uint32 NumIntervalSkips = 0;     // 틱 주기/중요도 때문에 건너뛴 틱 수
+    uint32 NumBudgetDeferrals = 0;   // ms 예산 초과로 다음 프레임으로 미룬 틱 수
+};
+
+/**
+ * @brief 월드의 액터/컴포넌트 틱 스케줄러
+ * 틱 그룹 순서대로 실행하며, 각 그룹은
+ *   1) 병렬 단계: CanTickOnAnyThread인 틱을 선행 조건 DAG에 따라 잡 시스템에서 실행 (게임 스레드도 도움)
+ *   2) 게임 스레드 단계: 나머지 틱을 선행 조건 순서로 직렬 실행
+ *   3) 병렬 단계에서 EnqueueGameThreadTask로 미뤄둔 작업(스폰/파괴 등) 처리
+ * 로 나뉜다. 선행 조건이 더 늦은 그룹에 있으면 뒤쪽 그룹으로, 같은 그룹의 게임 스레드 틱이면 게임 스레드 단계로 내려간다.
+ *
+ * 틱 노드는 매 프레임 레벨 전체를 훑지 않고, 월드가 등록한 액터로부터 (그룹, 단계) 순으로 연속 배치해 캐시한다.
+ * 등록/해제나 틱 설정(그룹, 스레드, 선행 조건, 컴포넌트 구성) 변경 시 MarkTickListDirty로 다음 프레임에 다시 만든다.
+ * 액터/컴포넌트의 활성 on-off는 실행 직전에 확인하므로 목록을 건드리지 않는다.
+ *
+ * 실행 직전에 TickInterval과 중요도 주기 중 큰 값을 기준으로 누적 델타를 모아 틱 여부를 정한다.
+ * 빈도 조절 가능한 틱은 ms 예산을 넘으면 다음 프레임으로 미뤄진다 (누적 델타는 유지).
+ */
+class FTickTaskManager
+{
+public:
+    explicit FTickTaskManager(UWorld* InWorld) : World(InWorld) {}
+
+    void RunTickGroups(bool bIsPie);
+
+    // 레벨에 들어오거나 나가는 액터 (게임 스레드 전용)
+    void RegisterActor(AActor* Actor);
+    void UnregisterActor(AActor* Actor);
+    void UnregisterAllActors();
+    void MarkTickListDirty() { bTickListDirty = true; }
+
+    // 워커에서 호출 가능. 현재 그룹이 끝난 뒤 게임 스레드에서 실행된다
+    void EnqueueGameThreadTask(std::function<void()> Task);
+    void FlushGameThreadTasks();
+    // 병렬 단계 실행 중인지 (워커뿐 아니라 잡을 돕는 게임 스레드도 포함). Lua처럼 게임 스레드 전용 호출을 미룰지 판단할 때 쓴다
+    bool IsInParallelPhase() const { return bInParallelPhase.load(std::memory_order_relaxed); }
+
+    const FTickStats& GetStats() const { return Stats; }
+    FSignificanceManager& GetSignificanceManager() { return SignificanceManager; }
+
+    static const char* GetTickGroupName(ETickingGroup Group);
+
+private:
+    struct FTickNode
+    {
+        AActor* Actor = nullptr;
+        UActorComponent* Component = nullptr;   // nullptr이면 액터 틱 (함께 틱하는 컴포넌트 포함)
+        float DeltaSeconds = 0.0f;
+        ETickingGroup Group = ETickingGroup::PrePhysics;
+        bool bGameThread = true;
+        bool bCanThrottle = false;             // 중요도 빈도 조절/예산 대상
+        float SignificanceInterval = 0.0f;     // 이번 프레임 중요도 기준 최소 틱 주기
+        TArray<int32> Prerequisites;
+        TArray<int32> Dependents;              // 같은 그룹/같은 단계의 후속 노드만
+    };
+
+    // 노드 구간 [Begin, End)
+    struct FNodeRange
+    {
+        int32 Begin = 0;
+        int32 End = 0;
+        bool IsEmpty() const { return Begin >= End; }
+        int32 Num() const { return End - Begin; }
+    };
+
+    void RebuildTickList(bool bIsPie);
+    void BuildNodes(bool bIsPie);
+    void ResolvePrerequisites();
+    void SortNodesByGroup();
+    void UpdateDeltaSeconds();
+    void UpdateSignificance();
+    void RunParallelPhase(const FNodeRange& Range);
+    void RunSerialPhase(const FNodeRange& Range);
+    void ExecuteNode(int32 NodeIndex);
+    void ReleaseDependents(int32 NodeIndex, class FJobCounter* Counter);
+
+private:
+    UWorld* World = nullptr;
+
+    // 등록된 액터 (해제된 자리는 nullptr로 두었다가 재구성 때 압축해 레벨 순서를 유지)
+    TArray<AActor*> RegisteredActors;
+    TMap<AActor*, int32> RegisteredActorIndices;
+    bool bTickListDirty = true;
+    bool bLastIsPie = false;
+
+    // (그룹, 단계) 순으로 정렬된 틱 노드와 각 구간
+    TArray<FTickNode> Nodes;
+    FNodeRange ParallelRanges[static_cast<int32>(ETickingGroup::Max)];
+    FNodeRange GameThreadRanges[static_cast<int32>(ETickingGroup::Max)];
+    bool bHasPrerequisites = false;
+
+    // 병렬 단계용 남은 선행 조건 수 (노드 인덱스와 동일)
+    std::unique_ptr<std::atomic<int32>[]> PendingCounts;
+    int32 PendingCapacity = 0;
+    std::atomic<int32> NumExecuted{ 0 };
+    std::atomic<bool> bInParallelPhase{ false };
+
+    std::mutex GameThreadTaskLock;
+    TArray<std::function<void()>> GameThreadTasks;
+
+    FSignificanceManager SignificanceManager;
+    std::atomic<uint32> IntervalSkipCount{ 0 };
+    std::atomic<uint32> BudgetDeferCount{ 0 };
+
+    FTickStats Stats;
+};
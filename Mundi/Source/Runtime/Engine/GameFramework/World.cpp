@@ -28,6 +28,8 @@
 #include "Level.h"
 #include "LightManager.h"
 #include "LuaManager.h"
+#include "PlatformTime.h"
+#include "TickTaskManager.h"
 #include "SkeletalMeshComponent.h"
 #include "FAudioDevice.h"
 #include "ResourceManager.h"
@@ -39,6 +41,7 @@
 #include "Hash.h"
 #include"Character.h"
 #include "LuaBindHelpers.h"
+#include "InlineArray.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -50,6 +53,7 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	TickTaskManager = std::make_unique<FTickTaskManager>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -223,7 +227,7 @@ void UWorld::Tick(float DeltaSeconds)
 	// Actor 별로 Dilation의 Duration을 처리하는 부분
 	if (!ActorTimingMap.IsEmpty())
 	{
-		TArray<TWeakObjectPtr<AActor>> ToRemove;
+		TInlineArray<TWeakObjectPtr<AActor>, 8> ToRemove;
 
 		for (auto& Pair : ActorTimingMap)
 		{
@@ -254,26 +258,15 @@ void UWorld::Tick(float DeltaSeconds)
     // Skip partition update for preview worlds (no spatial partitioning needed)
     if (Partition)
     {
+        TIME_PROFILE(WorldTick_Partition)
         Partition->Update(DeltaSeconds, /*budget*/256);
     }
 
 	if (Level)
 	{
-		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
-		TArray<AActor*> LevelActors = Level->GetActors();
-		for (AActor* Actor : LevelActors)
-		{
-			if (Actor && Actor->IsActorActive())
-			{
-				if (Actor->CanEverTick())
-				{
-					if (Actor->CanTickInEditor() || bPie)
-					{
-						Actor->Tick(GetDeltaTime(EDeltaTime::Game) * Actor->GetCustomTimeDillation());
-					}
-				}
-			}
-		}
+		TIME_PROFILE(WorldTick_Actors)
+		// 등록된 틱 목록을 그룹 순서대로 병렬 단계 → 게임 스레드 단계 실행 (Tick 중 추가된 actor는 다음 프레임부터)
+		TickTaskManager->RunTickGroups(bPie);
     }
 
     for (AActor* EditorActor : EditorActors)
@@ -287,11 +280,31 @@ void UWorld::Tick(float DeltaSeconds)
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
+		TIME_PROFILE(WorldTick_LuaCoroutine)
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
 	// 지연 삭제 처리
-	ProcessPendingKillActors();
+	{
+		TIME_PROFILE(WorldTick_PendingKill)
+		ProcessPendingKillActors();
+	}
+
+	// SoA 트랜스폼 저장소를 확정하고, 이번 틱에 미뤄둔 자식 트랜스폼 알림을 일괄 처리
+	{
+		TIME_PROFILE(WorldTick_TransformUpdate)
+		USceneComponent::FlushPendingTransformUpdates();
+	}
+}
+
+void UWorld::EnqueueGameThreadTask(std::function<void()> Task)
+{
+	TickTaskManager->EnqueueGameThreadTask(std::move(Task));
+}
+
+bool UWorld::IsTickingInParallel() const
+{
+	return TickTaskManager && TickTaskManager->IsInParallelPhase();
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -435,6 +448,9 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 선택/UI 해제
 	if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
 
+	// 틱 목록에서 제외 (다음 프레임 재구성)
+	TickTaskManager->UnregisterActor(Actor);
+
 	// 컴포넌트 정리 (등록 해제 → 파괴)
 	Actor->DestroyAllComponents();
 
@@ -529,6 +545,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
         }
         Level->Clear();
     }
+    TickTaskManager->UnregisterAllActors();
     // Clear spatial indices (skip if partition is null for preview worlds)
     if (Partition)
     {
@@ -551,6 +568,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 			{
 				Actor->SetWorld(this);
 				Actor->RegisterAllComponents(this);
+				TickTaskManager->RegisterActor(Actor);
 }
         }
     }
@@ -580,6 +598,8 @@ void UWorld::AddActorToLevel(AActor* Actor)
 		Actor->SetWorld(this);
 
 		Actor->RegisterAllComponents(this);
+
+		TickTaskManager->RegisterActor(Actor);
 	}
 }
 
@@ -12,6 +12,7 @@ class UUIManager;
 class UInputManager;
 class USelectionManager;
 class FLuaManager;
+class FTickTaskManager;
 class AActor;
 class URenderer;
 class ACameraActor;
@@ -124,6 +125,11 @@ public:
 
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
+    // 병렬 틱 중 워커에서 할 수 없는 작업(스폰/파괴/Lua 호출 등)을 현재 틱 그룹이 끝난 뒤 게임 스레드에서 실행
+    void EnqueueGameThreadTask(std::function<void()> Task);
+    // 병렬 틱 단계 중인지 (true면 게임 스레드 전용 작업은 EnqueueGameThreadTask로 미룰 것)
+    bool IsTickingInParallel() const;
+    FTickTaskManager* GetTickTaskManager() const { return TickTaskManager.get(); }
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
@@ -167,6 +173,9 @@ private:
 
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
+
+    /** === 틱 스케줄러 ===*/
+    std::unique_ptr<FTickTaskManager> TickTaskManager;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
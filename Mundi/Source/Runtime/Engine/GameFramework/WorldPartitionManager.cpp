@@ -5,10 +5,14 @@
 #include "World.h"
 #include "Octree.h"
 #include "BVHierarchy.h"
+#include "DynamicSpatialHash.h"
 #include "StaticMeshActor.h"
 #include "StaticMeshComponent.h"
 #include "Frustum.h"
+#include "OBB.h"
+#include "BoundingSphere.h"
 #include "Gizmo/GizmoActor.h"
+#include "Picking.h" // FRay, FHitResult
 
 IMPLEMENT_CLASS(UWorldPartitionManager)
 
@@ -21,6 +25,7 @@ UWorldPartitionManager::UWorldPartitionManager()
 	//BVH = new FBVHierachy(FBound(), 0, 5, 1); 
 	BVH = new FBVHierarchy(FAABB(), 0, 8, 1); 
 	//BVH = new FBVHierachy(FBound(), 0, 10, 3);
+	DynamicHash = new FDynamicSpatialHash();
 }
 
 UWorldPartitionManager::~UWorldPartitionManager()
@@ -35,15 +40,23 @@ UWorldPartitionManager::~UWorldPartitionManager()
 		delete BVH;
 		BVH = nullptr;
 	}
+	if (DynamicHash)
+	{
+		delete DynamicHash;
+		DynamicHash = nullptr;
+	}
 }
 
 void UWorldPartitionManager::Clear()
 {
 	//ClearSceneOctree();
 	ClearBVHierarchy();
+	if (DynamicHash) DynamicHash->Clear();
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
+	MovedComponentSet.Empty();
+	Placements.Empty();
 }
 
 // 새로 만들어진 StaticMeshComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
@@ -73,10 +86,18 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
+				MovedComponentSet.Remove(Smc);
 			}
 		}
 	}
 
+	// 일괄 등록은 모두 정적(BVH)으로 시작한다
+	for (UPrimitiveComponent* Smc : StaticMeshComponents)
+	{
+		if (DynamicHash) DynamicHash->Remove(Smc);
+		Placements.Add(Smc, FPlacement());
+	}
+
 	if (BVH) BVH->BulkUpdate(StaticMeshComponents);
 }
 
@@ -85,8 +106,11 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 	if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
 	{
 		if (BVH) BVH->Remove(Smc);
+		if (DynamicHash) DynamicHash->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
+		MovedComponentSet.Remove(Smc);
+		Placements.Remove(Smc);
 	}
 }
 
@@ -123,9 +147,19 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 		return;
 	}
 
-	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
+	// Add: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
-	if (ComponentDirtySet.insert(Smc).second)
+	std::lock_guard<std::mutex> Lock(DirtyLock);
+
+	// 이미 배치된 컴포넌트의 이동은 budget 큐를 거치지 않고 다음 Update에서 전부 처리
+	// (Placements는 Update/Register 쪽 게임 스레드에서만 바뀌고, 병렬 틱 중에는 읽기만 한다)
+	if (Placements.Contains(Smc))
+	{
+		MovedComponentSet.Add(Smc);
+		return;
+	}
+
+	if (ComponentDirtySet.Add(Smc))
 	{
 		ComponentDirtyQueue.push(Smc);
 	}
@@ -133,7 +167,13 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 
 void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 {
-	// 프레임 히칭 방지를 위해 컴포넌트 카운트 제한
+	++FrameNumber;
+	ElapsedTime += DeltaTime;
+
+	UpdateMovedComponents();
+	DemoteIdleComponents();
+
+	// 신규 등록만 프레임 히칭 방지를 위해 컴포넌트 카운트 제한
 	uint32 processed = 0;
 	while (processed < BudgetCount)
 	{
@@ -151,6 +191,10 @@ void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 
 		if (!Component) continue;
 		if (BVH) BVH->Update(Component);
+		if (!Placements.Contains(Component))
+		{
+			Placements.Add(Component, FPlacement());
+		}
 
 		++processed;
 	}
@@ -161,6 +205,64 @@ void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 	}
 }
 
+void UWorldPartitionManager::UpdateMovedComponents()
+{
+	if (MovedComponentSet.Num() == 0) return;
+
+	const TArray<UPrimitiveComponent*> MovedComponents = MovedComponentSet.Array();
+	MovedComponentSet.Reset();
+
+	for (UPrimitiveComponent* Component : MovedComponents)
+	{
+		FPlacement* Placement = Placements.Find(Component);
+		if (!Placement) continue;
+
+		if (Placement->bDynamic)
+		{
+			if (DynamicHash) DynamicHash->Update(Component, ElapsedTime);
+			continue;
+		}
+
+		Placement->MoveStreak = (Placement->LastMoveFrame + 1 == FrameNumber) ? Placement->MoveStreak + 1 : 1;
+		Placement->LastMoveFrame = FrameNumber;
+
+		if (DynamicHash && Placement->MoveStreak >= PromoteMoveFrames)
+		{
+			// 계속 움직이는 컴포넌트 -> 해시로 승격 (BVH에서는 슬롯만 비우고 refit, 재구축 없음)
+			if (BVH) BVH->Remove(Component);
+			DynamicHash->Update(Component, ElapsedTime);
+			Placement->bDynamic = true;
+			++NumPromotions;
+		}
+		else if (BVH)
+		{
+			// 가끔 움직이는 컴포넌트는 BVH에 남겨 refit
+			BVH->Update(Component);
+		}
+	}
+}
+
+void UWorldPartitionManager::DemoteIdleComponents()
+{
+	if (!DynamicHash || DynamicHash->Num() == 0) return;
+
+	TArray<UPrimitiveComponent*> IdleComponents;
+	DynamicHash->GatherIdle(ElapsedTime - DemoteIdleSeconds, IdleComponents);
+
+	for (UPrimitiveComponent* Component : IdleComponents)
+	{
+		DynamicHash->Remove(Component);
+		// 가까운 빈 슬롯이 있으면 그 리프에 다시 들어가고, 없으면 트리 밖 목록에 둔다 (전체 재구축은 SAH 비용이 넘칠 때만)
+		if (BVH) BVH->Update(Component);
+
+		if (FPlacement* Placement = Placements.Find(Component))
+		{
+			*Placement = FPlacement();
+		}
+		++NumDemotions;
+	}
+}
+
 //void UWorldPartitionManager::RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates)
 //{
 //    if (SceneOctree)
@@ -180,6 +282,48 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
 	{
 		BVH->QueryRayClosest(InRay, OutActor, OutBestT);
 	}
+	if (DynamicHash)
+	{
+		// BVH 결과보다 가까운 이동 컴포넌트가 있으면 덮어씀
+		DynamicHash->QueryRayClosest(InRay, OutActor, OutBestT);
+	}
+}
+
+bool UWorldPartitionManager::RayQueryClosest(const FRay& InRay, OUT FHitResult& OutHit, float MaxDistance) const
+{
+	bool bHit = false;
+	if (BVH && BVH->QueryRayClosest(InRay, OutHit, MaxDistance))
+	{
+		MaxDistance = OutHit.Distance;
+		bHit = true;
+	}
+	// BVH 결과보다 가까운 이동 컴포넌트가 있으면 덮어씀
+	if (DynamicHash && DynamicHash->QueryRayClosest(InRay, OutHit, MaxDistance))
+	{
+		bHit = true;
+	}
+	return bHit;
+}
+
+bool UWorldPartitionManager::RayQueryAny(const FRay& InRay, float MaxDistance) const
+{
+	return (BVH && BVH->QueryRayAny(InRay, MaxDistance))
+		|| (DynamicHash && DynamicHash->QueryRayAny(InRay, MaxDistance));
+}
+
+void UWorldPartitionManager::RayQueryAll(const FRay& InRay, OUT TArray<FHitResult>& OutHits, float MaxDistance) const
+{
+	OutHits.Empty();
+	if (BVH)
+	{
+		BVH->QueryRayAll(InRay, OutHits, MaxDistance);
+	}
+	if (DynamicHash)
+	{
+		DynamicHash->QueryRayAll(InRay, OutHits, MaxDistance);
+	}
+	std::sort(OutHits.begin(), OutHits.end(),
+		[](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
 }
 
 void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
@@ -188,6 +332,40 @@ void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
 	{
 		BVH->QueryFrustum(InFrustum);
 	}
+	if (DynamicHash)
+	{
+		DynamicHash->QueryFrustum(InFrustum);
+	}
+}
+
+template<typename BoundType>
+static TArray<UPrimitiveComponent*> QueryBothIntersected(const FBVHierarchy* BVH, const FDynamicSpatialHash* DynamicHash, const BoundType& InBound)
+{
+	TArray<UPrimitiveComponent*> Result;
+	if (BVH)
+	{
+		Result = BVH->QueryIntersectedComponents(InBound);
+	}
+	if (DynamicHash)
+	{
+		Result.Append(DynamicHash->QueryIntersectedComponents(InBound));
+	}
+	return Result;
+}
+
+TArray<UPrimitiveComponent*> UWorldPartitionManager::QueryIntersectedComponents(const FAABB& InBound) const
+{
+	return QueryBothIntersected(BVH, DynamicHash, InBound);
+}
+
+TArray<UPrimitiveComponent*> UWorldPartitionManager::QueryIntersectedComponents(const FOBB& InBound) const
+{
+	return QueryBothIntersected(BVH, DynamicHash, InBound);
+}
+
+TArray<UPrimitiveComponent*> UWorldPartitionManager::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+{
+	return QueryBothIntersected(BVH, DynamicHash, InBound);
 }
 
 void UWorldPartitionManager::ClearSceneOctree()
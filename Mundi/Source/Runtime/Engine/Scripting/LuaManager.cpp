@@ -8,15 +8,72 @@
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
 #include "SkeletalMeshComponent.h"
+#include "World.h"
 #include "Source/Runtime/AssetManagement/ResourceManager.h"
 #include "Source/Runtime/Engine/Audio/Sound.h"
 #include "Source/Runtime/Engine/GameFramework/FAudioDevice.h"
 #include <tuple>
 #include <xaudio2.h>
 
+namespace
+{
+    // Lua 힙을 EMemoryTag::Lua로 계정하는 lua_Alloc (Lua가 이전 크기를 넘겨주므로 헤더가 필요 없다)
+    void* LuaAllocate(void* /*UserData*/, void* Ptr, size_t OldSize, size_t NewSize)
+    {
+        // Ptr이 null이면 OldSize는 크기가 아니라 객체 종류 코드
+        const size_t TrackedOldSize = Ptr ? OldSize : 0;
+
+        if (NewSize == 0)
+        {
+            if (Ptr)
+            {
+                std::free(Ptr);
+                FMemoryManager::TrackFree(EMemoryTag::Lua, TrackedOldSize);
+            }
+            return nullptr;
+        }
+
+        void* NewPtr = std::realloc(Ptr, NewSize);
+        if (!NewPtr)
+        {
+            // 실패 시 원래 블록은 그대로 유효
+            return nullptr;
+        }
+
+        if (Ptr)
+        {
+            FMemoryManager::TrackFree(EMemoryTag::Lua, TrackedOldSize);
+        }
+        FMemoryManager::TrackAllocation(EMemoryTag::Lua, NewSize);
+        return NewPtr;
+    }
+
+    // 병렬 틱 단계(애니메이션 틱이 워커에서 돌 때)에 불린 Notify는 Lua 상태를 건드리지 않고
+    // 현재 틱 그룹이 끝난 뒤 게임 스레드에서 실행한다. 큐 순서대로 실행되므로 컴포넌트별 Begin/Tick/End 순서는 유지된다
+    template<typename NotifyCallFunc>
+    bool DeferNotifyIfTickingInParallel(USkeletalMeshComponent* MeshComp, NotifyCallFunc&& NotifyCall)
+    {
+        AActor* Owner = MeshComp->GetOwner();
+        UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+        if (!World || !World->IsTickingInParallel())
+        {
+            return false;
+        }
+
+        World->EnqueueGameThreadTask([WeakMeshComp = TWeakObjectPtr<USkeletalMeshComponent>(MeshComp), Call = std::forward<NotifyCallFunc>(NotifyCall)]()
+        {
+            if (USkeletalMeshComponent* Comp = WeakMeshComp.Get())
+            {
+                Call(Comp);
+            }
+        });
+        return true;
+    }
+}
+
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    Lua = new sol::state(sol::default_at_panic, &LuaAllocate);
 
     // Open essential standard libraries for gameplay scripts
     Lua->open_libraries(
@@ -670,6 +727,10 @@ bool FLuaManager::ExecuteNotify(const FString& NotifyClassName, const FString& P
     {
         return false;
     }
+    if (DeferNotifyIfTickingInParallel(MeshComp, [this, NotifyClassName, PropertyData, TriggerTime, Duration](USkeletalMeshComponent* Comp) { ExecuteNotify(NotifyClassName, PropertyData, Comp, TriggerTime, Duration); }))
+    {
+        return true;
+    }
 
     // AnimNotify 테이블에서 Notify 클래스 찾기
     sol::optional<sol::table> AnimNotifyTable = (*Lua)["AnimNotify"];
@@ -783,6 +844,10 @@ bool FLuaManager::ExecuteNotifyStateBegin(const FString& NotifyClassName, const
     {
         return false;
     }
+    if (DeferNotifyIfTickingInParallel(MeshComp, [this, NotifyClassName, PropertyData, TriggerTime](USkeletalMeshComponent* Comp) { ExecuteNotifyStateBegin(NotifyClassName, PropertyData, Comp, TriggerTime); }))
+    {
+        return true;
+    }
 
     FString NotifyPath = "Data/Scripts/NotifyState/" + NotifyClassName + ".lua";
 
@@ -866,6 +931,10 @@ bool FLuaManager::ExecuteNotifyStateTick(const FString& NotifyClassName, const F
     {
         return false;
     }
+    if (DeferNotifyIfTickingInParallel(MeshComp, [this, NotifyClassName, PropertyData, CurrentTime, DeltaTime](USkeletalMeshComponent* Comp) { ExecuteNotifyStateTick(NotifyClassName, PropertyData, Comp, CurrentTime, DeltaTime); }))
+    {
+        return true;
+    }
 
     // 캐시에서 인스턴스 찾기
     FNotifyStateKey CacheKey;
@@ -917,6 +986,10 @@ bool FLuaManager::ExecuteNotifyStateEnd(const FString& NotifyClassName, const FS
     {
         return false;
     }
+    if (DeferNotifyIfTickingInParallel(MeshComp, [this, NotifyClassName, PropertyData, EndTime](USkeletalMeshComponent* Comp) { ExecuteNotifyStateEnd(NotifyClassName, PropertyData, Comp, EndTime); }))
+    {
+        return true;
+    }
 
     // 캐시에서 인스턴스 찾기
     FNotifyStateKey CacheKey;
@@ -5,6 +5,8 @@
 #include <functional>
 #include <queue>
 #include "BVHierarchy.h"
+#include "InlineArray.h"
+#include "JobSystem.h"
 #include "Actor.h"
 #include "Collision.h"
 #include "Vector.h"
@@ -45,6 +47,23 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    // 마지막 전체 재구축 대비 SAH 비용이 이 배율을 넘으면 전체 재구축
+    constexpr float FullRebuildCostRatio = 1.5f;
+    // 노드 표면적이 (재)구축 시점 대비 이 배율을 넘으면 그 서브트리만 재정렬
+    constexpr float SubtreeInflationLimit = 2.0f;
+
+    inline float GetSurfaceArea(const FAABB& Box)
+    {
+        const FVector Size = Box.Max - Box.Min;
+        return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+    }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -62,11 +81,18 @@ FBVHierarchy::~FBVHierarchy()
 
 void FBVHierarchy::Clear()
 {
-    // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    // NOTE: TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화 (TFlatMap::Empty는 버킷까지 해제)
+    StaticMeshComponentBounds.Empty();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    ComponentLeaves.Empty();
+    PendingRefitLeaves = TArray<int32>();
+    OverflowComponents = TArray<UPrimitiveComponent*>();
+    bLayoutChanged = false;
     Bounds = FAABB();
+    SumInternalArea = 0.0;
+    SumLeafArea = 0.0;
+    Stats = FStats();
     bPendingRebuild = false;
 }
 
@@ -101,8 +127,32 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
+    // 재구축 대기 중이면 바운드만 기록 (다음 FlushRebuild에서 트리에 들어간다)
+    if (bPendingRebuild)
+    {
+        StaticMeshComponentBounds.Add(InComponent, WorldBounds);
+        return;
+    }
+
+    // 이미 트리에 있는 컴포넌트가 움직인 경우: 캐시 바운드만 바꾸고 리프를 refit 대기열에 넣는다
+    // (트리 밖 목록의 컴포넌트는 질의가 캐시 바운드를 직접 보므로 바운드만 바꾸면 된다)
+    if (FAABB* Cached = StaticMeshComponentBounds.Find(InComponent))
+    {
+        if (IsSameBounds(*Cached, WorldBounds))
+        {
+            return;
+        }
+        *Cached = WorldBounds;
+
+        if (const int32* LeafIdx = ComponentLeaves.Find(InComponent))
+        {
+            QueueLeafRefit(*LeafIdx);
+        }
+        return;
+    }
+
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
-    bPendingRebuild = true;
+    InsertComponent(InComponent, WorldBounds);
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -112,15 +162,163 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
-    if (StaticMeshComponentBounds.Find(InComponent))
+    if (!StaticMeshComponentBounds.Remove(InComponent))
+    {
+        return;
+    }
+
+    // 재구축 대기 중이면 맵에서 빠진 것으로 충분 (남은 옛 트리 질의도 맵에 없는 컴포넌트는 건너뛴다)
+    if (bPendingRebuild)
+    {
+        return;
+    }
+
+    if (const int32* LeafIdx = ComponentLeaves.Find(InComponent))
+    {
+        RemoveFromLeaf(InComponent, *LeafIdx);
+    }
+    else
+    {
+        auto It = std::find(OverflowComponents.begin(), OverflowComponents.end(), InComponent);
+        if (It != OverflowComponents.end())
+        {
+            *It = OverflowComponents.back();
+            OverflowComponents.pop_back();
+            bLayoutChanged = true;
+        }
+    }
+}
+
+void FBVHierarchy::InsertComponent(UPrimitiveComponent* InComponent, const FAABB& InBounds)
+{
+    // 아직 트리가 없으면 처음 한 번은 지어야 한다
+    if (Nodes.empty())
     {
-        StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
+        return;
+    }
+
+    bLayoutChanged = true;
+    if (Nodes[0].NumFree == 0)
+    {
+        OverflowComponents.Add(InComponent);
+        return;
+    }
+
+    // 빈 슬롯이 있는 리프 중 경로 표면적 증가 합이 가장 작은 곳을 찾는다 (branch and bound)
+    // 노드까지의 증가 합은 그 아래 어떤 리프의 비용보다도 작거나 같으므로, 가장 싼 후보부터 꺼내 처음 나온 리프가 최선
+    struct FInsertCandidate
+    {
+        int32 Idx;
+        double Cost;
+        bool operator<(const FInsertCandidate& Other) const { return Cost > Other.Cost; } // min-heap
+    };
+
+    // 경로 증가 합이 트리 밖 목록에 두는 비용(루트 넓이 하나)을 넘는 후보는 버린다
+    const double RootArea = GetSurfaceArea(Nodes[0].Bounds);
+    const auto GetGrowth = [&InBounds](const FAABB& NodeBounds)
+    {
+        return static_cast<double>(GetSurfaceArea(FAABB::Union(NodeBounds, InBounds))) - GetSurfaceArea(NodeBounds);
+    };
+
+    std::priority_queue<FInsertCandidate> Heap;
+    Heap.push({ 0, GetGrowth(Nodes[0].Bounds) });
+
+    int32 NodeIdx = -1;
+    while (!Heap.empty())
+    {
+        const FInsertCandidate Entry = Heap.top();
+        Heap.pop();
+        if (Entry.Cost > RootArea)
+        {
+            break;
+        }
+
+        const FLBVHNode& Node = Nodes[Entry.Idx];
+        if (Node.IsLeaf())
+        {
+            NodeIdx = Entry.Idx;
+            break;
+        }
+        for (int32 ChildIdx : { Node.Left, Node.Right })
+        {
+            if (Nodes[ChildIdx].NumFree > 0)
+            {
+                Heap.push({ ChildIdx, Entry.Cost + GetGrowth(Nodes[ChildIdx].Bounds) });
+            }
+        }
+    }
+
+    if (NodeIdx < 0)
+    {
+        OverflowComponents.Add(InComponent);
+        return;
+    }
+
+    const FLBVHNode& Leaf = Nodes[NodeIdx];
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        if (!StaticMeshComponentArray[i])
+        {
+            StaticMeshComponentArray[i] = InComponent;
+            break;
+        }
+    }
+    ComponentLeaves.Add(InComponent, NodeIdx);
+    AddFreeSlots(NodeIdx, -1);
+    QueueLeafRefit(NodeIdx);
+}
+
+void FBVHierarchy::RemoveFromLeaf(UPrimitiveComponent* InComponent, int32 LeafIdx)
+{
+    // 슬롯만 비우고 리프는 그대로 둔다. 빈 리프의 바운드는 refit에서 제자리의 점으로 줄어든다
+    const FLBVHNode& Leaf = Nodes[LeafIdx];
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        if (StaticMeshComponentArray[i] == InComponent)
+        {
+            StaticMeshComponentArray[i] = nullptr;
+            break;
+        }
+    }
+    ComponentLeaves.Remove(InComponent);
+    AddFreeSlots(LeafIdx, 1);
+    QueueLeafRefit(LeafIdx);
+    bLayoutChanged = true;
+}
+
+void FBVHierarchy::AddFreeSlots(int32 LeafIdx, int32 Delta)
+{
+    for (int32 NodeIdx = LeafIdx; NodeIdx >= 0; NodeIdx = Nodes[NodeIdx].Parent)
+    {
+        Nodes[NodeIdx].NumFree += Delta;
+    }
+}
+
+void FBVHierarchy::QueueLeafRefit(int32 LeafIdx)
+{
+    FLBVHNode& Leaf = Nodes[LeafIdx];
+    if (!Leaf.bRefitQueued)
+    {
+        Leaf.bRefitQueued = true;
+        PendingRefitLeaves.Add(LeafIdx);
     }
 }
 
 void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
 {
+    // 트리 밖 컴포넌트는 루트 바운드와 상관없이 하나씩 검사
+    for (UPrimitiveComponent* Component : OverflowComponents)
+    {
+        if (IsAABBVisible(InFrustum, StaticMeshComponentBounds.FindRef(Component)))
+        {
+            if (AActor* Owner = Component->GetOwner())
+            {
+                Owner->SetCulled(false);
+            }
+        }
+    }
+
     if (Nodes.empty()) return;
     //프러스텀 외부에 바운드 존재
     if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
@@ -130,7 +328,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
         for (UPrimitiveComponent* Component : StaticMeshComponentArray)
         {
             if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+            if (!StaticMeshComponentBounds.Contains(Component))
                 continue;
             if (AActor* Owner = Component->GetOwner())
             {
@@ -140,7 +338,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
         return;
     }
     //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
+    TInlineArray<int32, 64> IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -153,7 +351,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
             for (int32 i = 0; i < node.Count; ++i)
             {
                 UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                if (!Component || !StaticMeshComponentBounds.Contains(Component))
                     continue;
                 const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
                 const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
@@ -186,9 +384,9 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
         const FVector Max = N.Bounds.Max;
         const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
 
-        TArray<FVector> Start;
-        TArray<FVector> End;
-        TArray<FVector4> Color;
+        TInlineArray<FVector, 12> Start;
+        TInlineArray<FVector, 12> End;
+        TInlineArray<FVector4, 12> Color;
 
         const FVector v0(Min.X, Min.Y, Min.Z);
         const FVector v1(Max.X, Min.Y, Min.Z);
@@ -214,7 +412,7 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
         Start.Add(v2); End.Add(v6); Color.Add(LineColor);
         Start.Add(v3); End.Add(v7); Color.Add(LineColor);
 
-        Renderer->AddLines(Start, End, Color);
+        Renderer->AddLines(Start.GetData(), End.GetData(), Color.GetData(), Start.Num());
     }
 }
 
@@ -225,7 +423,7 @@ int FBVHierarchy::TotalNodeCount() const
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return StaticMeshComponentBounds.Num();
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
@@ -237,14 +435,15 @@ void FBVHierarchy::DebugDump() const
 {
     UE_LOG("===== BVHierachy (LBVH) DUMP BEGIN =====\r\n");
     char buf[256];
-    std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size());
+    std::snprintf(buf, sizeof(buf), "nodes=%zu, slots=%zu, free=%d, overflow=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size(),
+        Nodes.empty() ? 0 : Nodes[0].NumFree, OverflowComponents.size());
     UE_LOG(buf);
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const auto& n = Nodes[i];
         std::snprintf(buf, sizeof(buf),
-            "[%zu] L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
-            i, n.Left, n.Right, n.First, n.Count,
+            "[%zu] L=%d R=%d F=%d C=%d Free=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
+            i, n.Left, n.Right, n.First, n.Count, n.NumFree,
             n.Bounds.Min.X, n.Bounds.Min.Y, n.Bounds.Min.Z,
             n.Bounds.Max.X, n.Bounds.Max.Y, n.Bounds.Max.Z);
         UE_LOG(buf);
@@ -267,77 +466,366 @@ namespace
     {
         return (ExpandBits(x) << 2) | (ExpandBits(y) << 1) | ExpandBits(z);
     }
+
+    // 씬 바운드 안에서 중심점을 축마다 10비트로 양자화한 30비트 모튼 코드
+    inline uint32 ComputeMortonCode(const FVector& Center, const FVector& Min, const FVector& Extent)
+    {
+        const auto Normalize = [](float Value, float MinValue, float ExtHalf)
+            {
+                if (ExtHalf > 0.0f)
+                {
+                    return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
+                }
+                return 0.5f;
+            };
+
+        const float Nx = Normalize(Center.X, Min.X, Extent.X);
+        const float Ny = Normalize(Center.Y, Min.Y, Extent.Y);
+        const float Nz = Normalize(Center.Z, Min.Z, Extent.Z);
+
+        const uint32 Ix = static_cast<uint32>(Nx * 1023.0f);
+        const uint32 Iy = static_cast<uint32>(Ny * 1023.0f);
+        const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
+
+        return Morton3D(Ix, Iy, Iz);
+    }
+
+    // 이보다 적으면 작업 분배 비용이 더 커서 직렬로 짓는다
+    constexpr int32 ParallelBuildThreshold = 4096;
+    // 병렬 구축 시 스레드당 블록/서브트리 작업 수 (불균형 흡수용)
+    constexpr int32 TasksPerThread = 4;
+
+    // 30비트 모튼 코드를 10비트씩 3패스로 정렬하는 LSD 기수 정렬 (안정 정렬)
+    // 패스마다 블록별 히스토그램 -> (버킷, 블록) 순 누적 -> 블록별 분산을 병렬로 돌린다
+    void RadixSortMortonCodes(TArray<uint32>& Codes, TArray<int32>& Indices, int32 NumBlocks)
+    {
+        constexpr int32 RadixBits = 10;
+        constexpr int32 NumBuckets = 1 << RadixBits;
+        constexpr uint32 RadixMask = NumBuckets - 1;
+        constexpr int32 NumPasses = 3;
+
+        const int32 N = Codes.Num();
+        const int32 BlockSize = (N + NumBlocks - 1) / NumBlocks;
+
+        TArray<uint32> TempCodes;
+        TArray<int32> TempIndices;
+        TempCodes.SetNum(N);
+        TempIndices.SetNum(N);
+        TArray<int32> Histograms;
+        Histograms.SetNum(NumBlocks * NumBuckets);
+
+        for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+        {
+            const int32 Shift = Pass * RadixBits;
+
+            ParallelFor(NumBlocks, [&](int32 Block)
+            {
+                int32* Histogram = &Histograms[Block * NumBuckets];
+                std::fill(Histogram, Histogram + NumBuckets, 0);
+                const int32 End = std::min(N, (Block + 1) * BlockSize);
+                for (int32 i = Block * BlockSize; i < End; ++i)
+                {
+                    ++Histogram[(Codes[i] >> Shift) & RadixMask];
+                }
+            });
+
+            // 모든 코드가 같은 버킷이면 이 자릿수는 순서를 바꾸지 않는다
+            bool bSingleBucket = false;
+            int32 Offset = 0;
+            for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+            {
+                const int32 BucketStart = Offset;
+                for (int32 Block = 0; Block < NumBlocks; ++Block)
+                {
+                    int32& Count = Histograms[Block * NumBuckets + Bucket];
+                    const int32 BlockCount = Count;
+                    Count = Offset;
+                    Offset += BlockCount;
+                }
+                bSingleBucket |= (Offset - BucketStart) == N;
+            }
+            if (bSingleBucket)
+            {
+                continue;
+            }
+
+            ParallelFor(NumBlocks, [&](int32 Block)
+            {
+                int32* Histogram = &Histograms[Block * NumBuckets];
+                const int32 End = std::min(N, (Block + 1) * BlockSize);
+                for (int32 i = Block * BlockSize; i < End; ++i)
+                {
+                    const int32 Dst = Histogram[(Codes[i] >> Shift) & RadixMask]++;
+                    TempCodes[Dst] = Codes[i];
+                    TempIndices[Dst] = Indices[i];
+                }
+            });
+
+            std::swap(Codes, TempCodes);
+            std::swap(Indices, TempIndices);
+        }
+    }
+
+    // 개수로만 반씩 나누는 트리의 노드 수. 깊이마다 범위 크기가 floor/ceil 두 가지뿐이라 메모하면 O(log N)
+    int32 CountSubtreeNodes(int32 Num, int32 InMaxObjects, TInlineArray<std::pair<int32, int32>, 64>& Memo)
+    {
+        if (Num <= InMaxObjects)
+        {
+            return 1;
+        }
+        for (const std::pair<int32, int32>& Entry : Memo)
+        {
+            if (Entry.first == Num)
+            {
+                return Entry.second;
+            }
+        }
+        const int32 Result = 1 + CountSubtreeNodes(Num / 2, InMaxObjects, Memo) + CountSubtreeNodes(Num - Num / 2, InMaxObjects, Memo);
+        Memo.Add({ Num, Result });
+        return Result;
+    }
 }
 
 void FBVHierarchy::BuildLBVH()
 {
-    StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
-    const int N = StaticMeshComponentArray.Num();
-    Nodes = TArray<FLBVHNode>();
+    // 재구축마다 버킷을 다시 잡지 않도록 용량은 유지 (Clear에서만 해제)
+    ComponentLeaves.Reset();
+    PendingRefitLeaves.clear();
+    OverflowComponents.clear();
+    bLayoutChanged = false;
+
+    ++Stats.NumFullRebuilds;
+    Stats.LastUpdate = EUpdateType::FullRebuild;
+
+    // 맵을 한 번만 돌며 키와 바운드를 같이 모은다 (이후 구축은 해시 조회 없이 배열만 사용)
+    const int32 N = StaticMeshComponentBounds.Num();
+    TArray<UPrimitiveComponent*> Components;
+    TArray<FAABB> PrimitiveBounds;
+    Components.Reserve(N);
+    PrimitiveBounds.Reserve(N);
+    for (const auto& Pair : StaticMeshComponentBounds)
+    {
+        Components.Add(Pair.first);
+        PrimitiveBounds.Add(Pair.second);
+    }
+
+    TArray<int32> Order;
+    BuildHierarchy(PrimitiveBounds, MaxObjects, true, Bounds, Order, Nodes);
+
+    StaticMeshComponentArray.SetNum(N);
+    for (int32 i = 0; i < N; ++i)
+    {
+        StaticMeshComponentArray[i] = Components[Order[i]];
+    }
+
+    ComponentLeaves.Reserve(N);
+    for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); ++NodeIdx)
+    {
+        const FLBVHNode& Node = Nodes[NodeIdx];
+        for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+        {
+            ComponentLeaves.Add(StaticMeshComponentArray[i], NodeIdx);
+        }
+    }
+    ResetSAHCost();
+}
+
+int32 FBVHierarchy::BuildFromBounds(const TArray<FAABB>& PrimitiveBounds, int32 InMaxObjects, bool bParallel)
+{
+    FAABB SceneBounds;
+    TArray<int32> Order;
+    TArray<FLBVHNode> BuiltNodes;
+    BuildHierarchy(PrimitiveBounds, InMaxObjects, bParallel, SceneBounds, Order, BuiltNodes);
+    return BuiltNodes.Num();
+}
 
+void FBVHierarchy::BuildHierarchy(const TArray<FAABB>& PrimitiveBounds, int32 InMaxObjects, bool bParallel,
+    FAABB& OutSceneBounds, TArray<int32>& OutOrder, TArray<FLBVHNode>& OutNodes)
+{
+    const int32 N = PrimitiveBounds.Num();
+    OutNodes = TArray<FLBVHNode>();
+    OutOrder.SetNum(N);
     if (N == 0)
     {
-        Bounds = FAABB();
+        OutSceneBounds = FAABB();
         return;
     }
 
-    bool bHasBounds = false;
-    for (const auto& Pair : StaticMeshComponentBounds)
+    // 블록 하나면 ParallelFor가 호출 스레드에서 그대로 돈다
+    const FJobSystem& JobSystem = FJobSystem::Get();
+    const int32 NumThreads = JobSystem.IsInitialized() ? static_cast<int32>(JobSystem.GetNumWorkers()) + 1 : 1;
+    bParallel = bParallel && NumThreads > 1 && N >= ParallelBuildThreshold;
+    const int32 NumBlocks = bParallel ? std::min(NumThreads * TasksPerThread, N / (ParallelBuildThreshold / TasksPerThread)) : 1;
+    const int32 BlockSize = (N + NumBlocks - 1) / NumBlocks;
+
+    // 1. 씬 바운드: 블록별 합집합 후 직렬로 합친다
+    TArray<FAABB> BlockBounds;
+    BlockBounds.SetNum(NumBlocks);
+    ParallelFor(NumBlocks, [&](int32 Block)
     {
-        const FAABB& Bound = Pair.second;
-        if (!bHasBounds)
+        const int32 Begin = Block * BlockSize;
+        const int32 End = std::min(N, Begin + BlockSize);
+        FAABB Accumulated = PrimitiveBounds[Begin];
+        for (int32 i = Begin + 1; i < End; ++i)
         {
-            Bounds = Bound;
-            bHasBounds = true;
+            Accumulated = FAABB::Union(Accumulated, PrimitiveBounds[i]);
         }
-        else
+        BlockBounds[Block] = Accumulated;
+    });
+    OutSceneBounds = BlockBounds[0];
+    for (int32 Block = 1; Block < NumBlocks; ++Block)
+    {
+        OutSceneBounds = FAABB::Union(OutSceneBounds, BlockBounds[Block]);
+    }
+
+    // 2. 모튼 코드
+    const FVector Min = OutSceneBounds.Min;
+    const FVector Extent = OutSceneBounds.GetHalfExtent();
+    TArray<uint32> Codes;
+    Codes.SetNum(N);
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        const int32 End = std::min(N, (Block + 1) * BlockSize);
+        for (int32 i = Block * BlockSize; i < End; ++i)
         {
-            Bounds = FAABB::Union(Bounds, Bound);
+            Codes[i] = ComputeMortonCode(PrimitiveBounds[i].GetCenter(), Min, Extent);
+            OutOrder[i] = i;
         }
+    });
+
+    // 3. 정렬
+    if (bParallel)
+    {
+        RadixSortMortonCodes(Codes, OutOrder, NumBlocks);
     }
+    else
+    {
+        std::sort(OutOrder.begin(), OutOrder.end(),
+            [&Codes](int32 LHS, int32 RHS)
+            {
+                return Codes[LHS] < Codes[RHS];
+            });
+    }
+
+    TArray<FAABB> SortedBounds;
+    SortedBounds.SetNum(N);
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        const int32 End = std::min(N, (Block + 1) * BlockSize);
+        for (int32 i = Block * BlockSize; i < End; ++i)
+        {
+            SortedBounds[i] = PrimitiveBounds[OutOrder[i]];
+        }
+    });
+
+    // 4. 노드: 위쪽 몇 단계만 직렬로 펼쳐 노드 인덱스를 정하고, 나머지 서브트리는 작업 하나씩 맡는다
+    TInlineArray<std::pair<int32, int32>, 64> NodeCountMemo;
+    OutNodes.SetNum(CountSubtreeNodes(N, InMaxObjects, NodeCountMemo));
 
-    if (!bHasBounds)
+    if (!bParallel)
     {
-        Bounds = FAABB();
+        BuildSubtree(SortedBounds, InMaxObjects, 0, N, 0, OutNodes);
         return;
     }
 
-    TArray<uint32> Codes;
-    Codes.resize(N);
-    const FVector Min = Bounds.Min;
-    const FVector Extent = Bounds.GetHalfExtent();
-
-    for (int i = 0; i < N; ++i)
+    struct FSubtreeTask
     {
-        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-        const FVector Center = Bound ? Bound->GetCenter() : Component->GetWorldAABB().GetCenter();
+        int32 Start;
+        int32 End;
+        int32 NodeIdx;
+    };
+    TArray<FSubtreeTask> Tasks;
+    TInlineArray<int32, 64> TopNodes;
+    const int32 TaskSize = std::max(InMaxObjects, N / (NumThreads * TasksPerThread));
 
-        const auto Normalize = [](float Value, float MinValue, float ExtHalf)
-            {
-                if (ExtHalf > 0.0f)
-                {
-                    return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
-                }
-                return 0.5f;
-            };
+    std::function<void(int32, int32, int32)> ExpandTop = [&](int32 Start, int32 End, int32 NodeIdx)
+    {
+        if (End - Start <= TaskSize)
+        {
+            Tasks.Add({ Start, End, NodeIdx });
+            return;
+        }
+        const int32 Mid = Start + (End - Start) / 2;
+        FLBVHNode& Node = OutNodes[NodeIdx];
+        Node.Left = NodeIdx + 1;
+        Node.Right = Node.Left + CountSubtreeNodes(Mid - Start, InMaxObjects, NodeCountMemo);
+        OutNodes[Node.Left].Parent = NodeIdx;
+        OutNodes[Node.Right].Parent = NodeIdx;
+        TopNodes.Add(NodeIdx);
+        ExpandTop(Start, Mid, Node.Left);
+        ExpandTop(Mid, End, Node.Right);
+    };
+    ExpandTop(0, N, 0);
 
-        const float Nx = Normalize(Center.X, Min.X, Extent.X);
-        const float Ny = Normalize(Center.Y, Min.Y, Extent.Y);
-        const float Nz = Normalize(Center.Z, Min.Z, Extent.Z);
+    ParallelFor(Tasks.Num(), [&](int32 TaskIndex)
+    {
+        const FSubtreeTask& Task = Tasks[TaskIndex];
+        BuildSubtree(SortedBounds, InMaxObjects, Task.Start, Task.End, Task.NodeIdx, OutNodes);
+    });
 
-        const uint32 Ix = static_cast<uint32>(Nx * 1023.0f);
-        const uint32 Iy = static_cast<uint32>(Ny * 1023.0f);
-        const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
+    // 위쪽 노드 바운드: 전위 순서의 역순이면 자식이 항상 먼저 끝나 있다
+    for (int32 i = TopNodes.Num() - 1; i >= 0; --i)
+    {
+        FLBVHNode& Node = OutNodes[TopNodes[i]];
+        Node.Bounds = FAABB::Union(OutNodes[Node.Left].Bounds, OutNodes[Node.Right].Bounds);
+        Node.BuildArea = GetSurfaceArea(Node.Bounds);
+    }
+}
 
-        Codes[i] = Morton3D(Ix, Iy, Iz);
+int32 FBVHierarchy::BuildSubtree(const TArray<FAABB>& SortedBounds, int32 InMaxObjects, int32 Start, int32 End, int32 NodeIdx,
+    TArray<FLBVHNode>& OutNodes)
+{
+    FLBVHNode& Node = OutNodes[NodeIdx];
+    if (End - Start <= InMaxObjects)
+    {
+        Node.First = Start;
+        Node.Count = End - Start;
+        FAABB Accumulated = SortedBounds[Start];
+        for (int32 i = Start + 1; i < End; ++i)
+        {
+            Accumulated = FAABB::Union(Accumulated, SortedBounds[i]);
+        }
+        Node.Bounds = Accumulated;
+        Node.BuildArea = GetSurfaceArea(Node.Bounds);
+        return NodeIdx + 1;
     }
 
+    // 분할 위치가 개수로만 정해지므로 같은 범위를 다시 정렬해도 트리 모양은 그대로다 (RebuildSubtree 전제)
+    // 전위 순서: 왼쪽 자식은 바로 다음, 오른쪽 자식은 왼쪽 서브트리가 끝난 다음
+    const int32 Mid = Start + (End - Start) / 2;
+    const int32 Left = NodeIdx + 1;
+    const int32 Right = BuildSubtree(SortedBounds, InMaxObjects, Start, Mid, Left, OutNodes);
+    const int32 Next = BuildSubtree(SortedBounds, InMaxObjects, Mid, End, Right, OutNodes);
+
+    Node.Left = Left;
+    Node.Right = Right;
+    Node.Bounds = FAABB::Union(OutNodes[Left].Bounds, OutNodes[Right].Bounds);
+    Node.BuildArea = GetSurfaceArea(Node.Bounds);
+    OutNodes[Left].Parent = NodeIdx;
+    OutNodes[Right].Parent = NodeIdx;
+    return Next;
+}
+
+void FBVHierarchy::SortRangeByMortonCode(int32 Start, int32 End)
+{
+    // 양자화 기준은 현재 루트 바운드 (부분 재구축도 같은 기준으로 정렬)
+    const FVector Min = Bounds.Min;
+    const FVector Extent = Bounds.GetHalfExtent();
+
     TArray<std::pair<UPrimitiveComponent*, uint32>> ComponentCodePairs;
-    ComponentCodePairs.resize(N);
-    for (int i = 0; i < N; ++i)
+    ComponentCodePairs.resize(End - Start);
+    for (int32 i = Start; i < End; ++i)
     {
-        ComponentCodePairs[i] = { StaticMeshComponentArray[i], Codes[i] };
+        // 빈 슬롯은 범위 끝으로 모은다
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        if (!Component)
+        {
+            ComponentCodePairs[i - Start] = { nullptr, std::numeric_limits<uint32>::max() };
+            continue;
+        }
+        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
+        const FVector Center = Bound ? Bound->GetCenter() : Component->GetWorldAABB().GetCenter();
+        ComponentCodePairs[i - Start] = { Component, ComputeMortonCode(Center, Min, Extent) };
     }
 
     std::sort(ComponentCodePairs.begin(), ComponentCodePairs.end(),
@@ -346,74 +834,278 @@ void FBVHierarchy::BuildLBVH()
             return LHS.second < RHS.second;
         });
 
-    for (int i = 0; i < N; ++i)
+    for (int32 i = Start; i < End; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        StaticMeshComponentArray[i] = ComponentCodePairs[i - Start].first;
     }
+}
+
+FAABB FBVHierarchy::ComputeLeafBounds(const FLBVHNode& Leaf) const
+{
+    bool bInitialized = false;
+    FAABB Accumulated;
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        if (!Component)
+        {
+            continue;
+        }
 
-    Nodes.reserve(std::max(1, 2 * N));
-    Nodes.clear();
-    BuildRange(0, N);
+        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
+        const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
+        if (!bInitialized)
+        {
+            Accumulated = LocalBound;
+            bInitialized = true;
+        }
+        else
+        {
+            Accumulated = FAABB::Union(Accumulated, LocalBound);
+        }
+    }
+    if (bInitialized)
+    {
+        return Accumulated;
+    }
+    // 전부 비었으면 원래 자리의 점 (질의에 거의 걸리지 않고, 다시 채워질 때 가까운 컴포넌트가 들어오도록)
+    const FVector Center = Leaf.Bounds.GetCenter();
+    return FAABB(Center, Center);
+}
+
+void FBVHierarchy::SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds)
+{
+    FLBVHNode& Node = Nodes[NodeIdx];
+    const double AreaDelta = static_cast<double>(GetSurfaceArea(NewBounds)) - GetSurfaceArea(Node.Bounds);
+    if (Node.IsLeaf())
+    {
+        SumLeafArea += AreaDelta * Node.Count;
+    }
+    else
+    {
+        SumInternalArea += AreaDelta;
+    }
+    Node.Bounds = NewBounds;
+}
+
+void FBVHierarchy::ResetSAHCost()
+{
+    // 누적 오차가 쌓이지 않도록 (재)구축 때마다 처음부터 다시 합산
+    SumInternalArea = 0.0;
+    SumLeafArea = 0.0;
+    for (const FLBVHNode& Node : Nodes)
+    {
+        const double Area = GetSurfaceArea(Node.Bounds);
+        if (Node.IsLeaf())
+        {
+            SumLeafArea += Area * Node.Count;
+        }
+        else
+        {
+            SumInternalArea += Area;
+        }
+    }
+    Stats.SAHCost = GetSAHCost();
+    Stats.BuildSAHCost = Stats.SAHCost;
+}
+
+float FBVHierarchy::GetSAHCost() const
+{
+    if (Nodes.empty())
+    {
+        return 0.0f;
+    }
+    // 트리 밖 컴포넌트는 루트에 닿는 모든 질의가 검사하므로 루트 넓이의 리프 하나와 같다
+    const double RootArea = GetSurfaceArea(Nodes[0].Bounds);
+    const double TreeCost = RootArea > 0.0 ? (SumInternalArea + SumLeafArea) / RootArea : 0.0;
+    return static_cast<float>(TreeCost + OverflowComponents.Num());
 }
 
-int FBVHierarchy::BuildRange(int s, int e)
+void FBVHierarchy::Refit()
 {
-    int nodeIdx = static_cast<int>(Nodes.size());
-    Nodes.push_back(FLBVHNode{});
-    FLBVHNode& node = Nodes[nodeIdx];
+    TInlineArray<int32, 16> RebuildCandidates;
 
-    int count = e - s;
-    if (count <= MaxObjects)
+    for (int32 LeafIdx : PendingRefitLeaves)
     {
-        node.First = s;
-        node.Count = count;
-        bool bInitialized = false;
-        FAABB Accumulated;
-        for (int i = s; i < e; ++i)
+        FLBVHNode& Leaf = Nodes[LeafIdx];
+        Leaf.bRefitQueued = false;
+
+        const FAABB LeafBounds = ComputeLeafBounds(Leaf);
+        if (IsSameBounds(LeafBounds, Leaf.Bounds))
         {
-            UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
+            continue;
+        }
+        SetNodeBounds(LeafIdx, LeafBounds);
+        ++Stats.LastRefitLeaves;
+
+        // 부모로 올라가며 합집합 갱신, 바운드가 그대로인 노드에서 멈춘다
+        int32 Candidate = -1;
+        for (int32 NodeIdx = Leaf.Parent; NodeIdx >= 0; NodeIdx = Nodes[NodeIdx].Parent)
+        {
+            const FLBVHNode& Node = Nodes[NodeIdx];
+            const FAABB NodeBounds = FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds);
+            if (IsSameBounds(NodeBounds, Node.Bounds))
             {
-                continue;
+                break;
             }
+            SetNodeBounds(NodeIdx, NodeBounds);
+            ++Stats.LastRefitNodes;
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
-            if (!bInitialized)
+            // 경로에서 가장 위쪽의 부푼 노드를 부분 재구축 후보로
+            if (GetSurfaceArea(NodeBounds) > Node.BuildArea * SubtreeInflationLimit)
             {
-                Accumulated = LocalBound;
-                bInitialized = true;
+                Candidate = NodeIdx;
+            }
+        }
+
+        if (Candidate >= 0 && std::find(RebuildCandidates.begin(), RebuildCandidates.end(), Candidate) == RebuildCandidates.end())
+        {
+            RebuildCandidates.Add(Candidate);
+        }
+    }
+    PendingRefitLeaves.clear();
+
+    if (Stats.LastRefitLeaves == 0 && !bLayoutChanged)
+    {
+        return;
+    }
+    bLayoutChanged = false;
+
+    Bounds = Nodes[0].Bounds;
+    Stats.SAHCost = GetSAHCost();
+
+    // 트리 전체 품질이 나빠졌거나 루트까지 부풀었으면 처음부터 다시 짓는다
+    // 빈 슬롯이 절반을 넘어도 다시 지어 배열을 채운다 (추가/제거가 아무리 많아도 전체 재구축은 이 두 조건에서만)
+    const bool bRootInflated = std::find(RebuildCandidates.begin(), RebuildCandidates.end(), 0) != RebuildCandidates.end();
+    const bool bMostlyFree = Nodes[0].NumFree * 2 > StaticMeshComponentArray.Num();
+    if (bRootInflated || bMostlyFree || Stats.SAHCost > Stats.BuildSAHCost * FullRebuildCostRatio)
+    {
+        BuildLBVH();
+        return;
+    }
+
+    if (RebuildCandidates.Num() == 0)
+    {
+        ++Stats.NumRefits;
+        Stats.LastUpdate = EUpdateType::Refit;
+        return;
+    }
+
+    // 후보끼리 조상/자손이면 위쪽 하나만 재구축
+    for (int32 Candidate : RebuildCandidates)
+    {
+        bool bCoveredByAncestor = false;
+        for (int32 NodeIdx = Nodes[Candidate].Parent; NodeIdx >= 0 && !bCoveredByAncestor; NodeIdx = Nodes[NodeIdx].Parent)
+        {
+            bCoveredByAncestor = std::find(RebuildCandidates.begin(), RebuildCandidates.end(), NodeIdx) != RebuildCandidates.end();
+        }
+        if (!bCoveredByAncestor)
+        {
+            RebuildSubtree(Candidate);
+        }
+    }
+    Stats.SAHCost = GetSAHCost();
+    ++Stats.NumPartialRebuilds;
+    Stats.LastUpdate = EUpdateType::PartialRebuild;
+}
+
+void FBVHierarchy::RebuildSubtree(int32 NodeIdx)
+{
+    // 서브트리의 컴포넌트 범위 = 가장 왼쪽 리프 시작 ~ 가장 오른쪽 리프 끝
+    int32 LeftMost = NodeIdx;
+    while (!Nodes[LeftMost].IsLeaf())
+    {
+        LeftMost = Nodes[LeftMost].Left;
+    }
+    int32 RightMost = NodeIdx;
+    while (!Nodes[RightMost].IsLeaf())
+    {
+        RightMost = Nodes[RightMost].Right;
+    }
+
+    SortRangeByMortonCode(Nodes[LeftMost].First, Nodes[RightMost].First + Nodes[RightMost].Count);
+    RefitSubtree(NodeIdx);
+    RefitAncestors(NodeIdx);
+}
+
+void FBVHierarchy::RefitSubtree(int32 NodeIdx)
+{
+    // 재정렬로 빈 슬롯이 리프 사이를 옮겨가므로 개수도 다시 센다 (서브트리 전체 개수는 그대로라 조상은 안 바뀜)
+    FLBVHNode& Node = Nodes[NodeIdx];
+    if (Node.IsLeaf())
+    {
+        Node.NumFree = 0;
+        for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+        {
+            if (UPrimitiveComponent* Component = StaticMeshComponentArray[i])
+            {
+                ComponentLeaves.Add(Component, NodeIdx);
             }
             else
             {
-                Accumulated = FAABB::Union(Accumulated, LocalBound);
+                ++Node.NumFree;
             }
         }
-        node.Bounds = bInitialized ? Accumulated : Bounds;
-        return nodeIdx;
+        SetNodeBounds(NodeIdx, ComputeLeafBounds(Node));
+    }
+    else
+    {
+        RefitSubtree(Node.Left);
+        RefitSubtree(Node.Right);
+        Node.NumFree = Nodes[Node.Left].NumFree + Nodes[Node.Right].NumFree;
+        SetNodeBounds(NodeIdx, FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds));
     }
+    Node.BuildArea = GetSurfaceArea(Node.Bounds);
+}
 
-    int mid = (s + e) / 2;
-    int L = BuildRange(s, mid);
-    int R = BuildRange(mid, e);
-    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
-    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
-    return nodeIdx;
+void FBVHierarchy::RefitAncestors(int32 NodeIdx)
+{
+    for (int32 ParentIdx = Nodes[NodeIdx].Parent; ParentIdx >= 0; ParentIdx = Nodes[ParentIdx].Parent)
+    {
+        const FLBVHNode& Parent = Nodes[ParentIdx];
+        const FAABB ParentBounds = FAABB::Union(Nodes[Parent.Left].Bounds, Nodes[Parent.Right].Bounds);
+        if (IsSameBounds(ParentBounds, Parent.Bounds))
+        {
+            break;
+        }
+        SetNodeBounds(ParentIdx, ParentBounds);
+    }
+    Bounds = Nodes[0].Bounds;
 }
 
-void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+template<typename ComponentFunc>
+void FBVHierarchy::TraverseRay(const FRay& Ray, const float& MaxDistance, ComponentFunc OnComponent) const
 {
-    OutActor = nullptr;
-    // Respect caller-provided initial cap (e.g., far plane) if valid
-    if (!(std::isfinite(OutBestT) && OutBestT > 0.0f))
+    // 바운드가 레이에 걸리는 컴포넌트를 OnComponent로 넘긴다. true면 순회를 끝낸다
+    const auto VisitComponent = [&](UPrimitiveComponent* InComponent)
     {
-        OutBestT = std::numeric_limits<float>::infinity();
+        UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(InComponent);
+        if (!Component) return false;
+        AActor* Owner = Component->GetOwner();
+        if (!Owner) return false;
+        if (Owner->GetActorHiddenInEditor()) return false;
+
+        const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+        const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
+
+        float tmin, tmax;
+        if (!RayAABB_IntersectT(Ray, Box, tmin, tmax) || tmax < 0.0f || tmin > MaxDistance)
+            return false;
+
+        return OnComponent(Component);
+    };
+
+    // 트리 밖 컴포넌트 먼저 (가장 가까운 교차를 찾을 때 MaxDistance를 미리 줄여 둔다)
+    for (UPrimitiveComponent* Component : OverflowComponents)
+    {
+        if (VisitComponent(Component))
+            return;
     }
 
     if (Nodes.empty()) return;
 
     float tminRoot, tmaxRoot;
-    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot) || tmaxRoot < 0.0f) return;
 
     struct HeapItem
     {
@@ -425,14 +1117,13 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     std::priority_queue<HeapItem> heap;
     heap.push({ 0, tminRoot });
 
-    const float Epsilon = 1e-3f;
-    bool isPick = false;
     while (!heap.empty())
     {
         HeapItem entry = heap.top();
         heap.pop();
 
-        if (OutActor && entry.TMin > OutBestT + Epsilon)
+        // 가까운 노드부터 꺼내므로 이후 노드도 전부 MaxDistance 밖이다
+        if (entry.TMin > MaxDistance)
             break;
 
         const FLBVHNode& node = Nodes[entry.Idx];
@@ -440,67 +1131,96 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         {
             for (int i = 0; i < node.Count; ++i)
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component) continue;
-                AActor* Owner = Component->GetOwner();
-                if (!Owner) continue;
-                if (Owner->GetActorHiddenInEditor()) continue;
-
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-
-                float tmin, tmax;
-                if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
-                    continue;
-                if (OutActor && tmin > OutBestT + Epsilon)
-                    continue;
-
-                float hitDistance;
-                if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
-                {
-                    if (hitDistance < OutBestT)
-                    {
-                        OutBestT = hitDistance;
-                        OutActor = Owner;
-                        isPick = true;
-                    }
-                }
+                if (VisitComponent(StaticMeshComponentArray[node.First + i]))
+                    return;
             }
             continue;
         }
-        if (isPick == true)
-        {
-            break;
-        }
+
         // Internal node: push children if intersected and promising
-        if (node.Left >= 0)
+        for (int32 ChildIdx : { node.Left, node.Right })
         {
-            float tminL, tmaxL;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL))
+            if (ChildIdx < 0) continue;
+            float tmin, tmax;
+            if (RayAABB_IntersectT(Ray, Nodes[ChildIdx].Bounds, tmin, tmax) && tmax >= 0.0f && tmin <= MaxDistance)
             {
-                if (!OutActor || tminL <= OutBestT + Epsilon)
-                    heap.push({ node.Left, tminL });
+                heap.push({ ChildIdx, tmin });
             }
         }
-        if (node.Right >= 0)
+    }
+}
+
+void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+{
+    OutActor = nullptr;
+    // Respect caller-provided initial cap (e.g., far plane) if valid
+    if (!(std::isfinite(OutBestT) && OutBestT > 0.0f))
+    {
+        OutBestT = std::numeric_limits<float>::infinity();
+    }
+
+    FHitResult Hit;
+    if (QueryRayClosest(Ray, Hit, OutBestT))
+    {
+        OutActor = Hit.Actor;
+        OutBestT = Hit.Distance;
+    }
+}
+
+bool FBVHierarchy::QueryRayClosest(const FRay& Ray, FHitResult& OutHit, float MaxDistance) const
+{
+    float BestT = MaxDistance;
+    bool bHit = false;
+    TraverseRay(Ray, BestT, [&](UStaticMeshComponent* Component)
+    {
+        if (CPickingSystem::RaycastComponent(Component, Ray, BestT, OutHit))
         {
-            float tminR, tmaxR;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR))
-            {
-                if (!OutActor || tminR <= OutBestT + Epsilon)
-                    heap.push({ node.Right, tminR });
-            }
+            BestT = OutHit.Distance;
+            bHit = true;
         }
-    }
+        return false;
+    });
+    return bHit;
+}
+
+bool FBVHierarchy::QueryRayAny(const FRay& Ray, float MaxDistance) const
+{
+    bool bHit = false;
+    TraverseRay(Ray, MaxDistance, [&](UStaticMeshComponent* Component)
+    {
+        bHit = CPickingSystem::RaycastComponentAny(Component, Ray, MaxDistance);
+        return bHit;
+    });
+    return bHit;
+}
+
+void FBVHierarchy::QueryRayAll(const FRay& Ray, TArray<FHitResult>& OutHits, float MaxDistance) const
+{
+    TraverseRay(Ray, MaxDistance, [&](UStaticMeshComponent* Component)
+    {
+        CPickingSystem::RaycastComponentAll(Component, Ray, MaxDistance, OutHits);
+        return false;
+    });
 }
 
 void FBVHierarchy::FlushRebuild()
 {
+    Stats.LastUpdate = EUpdateType::None;
+    Stats.LastRefitLeaves = 0;
+    Stats.LastRefitNodes = 0;
+
     if (bPendingRebuild)
     {
         BuildLBVH();
         bPendingRebuild = false;
     }
+    else if (!PendingRefitLeaves.empty() || bLayoutChanged)
+    {
+        Refit();
+    }
+
+    Stats.NumFreeSlots = Nodes.empty() ? 0 : static_cast<uint32>(Nodes[0].NumFree);
+    Stats.NumOverflow = static_cast<uint32>(OverflowComponents.Num());
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -510,9 +1230,16 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
     ComponentIntersectFunc ComponentIntersects) const
 {
     TSet<UPrimitiveComponent*> IntersectedComponents;
+    for (UPrimitiveComponent* Component : OverflowComponents)
+    {
+        if (ComponentIntersects(StaticMeshComponentBounds.FindRef(Component), InBound))
+        {
+            IntersectedComponents.insert(Component);
+        }
+    }
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
+        return IntersectedComponents.Array();
+    TInlineArray<int32, 64> IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -527,7 +1254,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                 for (int32 i = 0; i < Node.Count; ++i)
                 {
                     UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
-                    if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                    if (!Component || !StaticMeshComponentBounds.Contains(Component))
                         continue;
                     const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
                     const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
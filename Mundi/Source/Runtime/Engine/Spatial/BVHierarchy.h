@@ -1,8 +1,11 @@
 ﻿#pragma once
+#include "FlatHashMap.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
+struct FHitResult;
 class UPrimitiveComponent;
+class UStaticMeshComponent;
 class AActor;
 struct FOBB;
 struct FBoundingSphere;
@@ -12,6 +15,35 @@ struct FBoundingSphere;
  */
 class FBVHierarchy
 {
+public:
+    // 한 프레임(FlushRebuild)에서 일어난 갱신 종류
+    enum class EUpdateType : uint8
+    {
+        None,
+        Refit,          // 바뀐 리프만 바운드 갱신 후 부모로 전파
+        PartialRebuild, // 부풀어 오른 서브트리만 모튼 코드로 재정렬
+        FullRebuild,    // BuildLBVH 전체 재구축
+    };
+
+    struct FStats
+    {
+        uint32 NumFullRebuilds = 0;
+        uint32 NumPartialRebuilds = 0;
+        uint32 NumRefits = 0;
+
+        EUpdateType LastUpdate = EUpdateType::None;
+        uint32 LastRefitLeaves = 0;
+        uint32 LastRefitNodes = 0;
+
+        // 재구축 없이 빠지고 들어온 컴포넌트
+        uint32 NumFreeSlots = 0;    // 제거되어 비어 있는 리프 슬롯
+        uint32 NumOverflow = 0;     // 가까운 빈 슬롯을 못 찾아 트리 밖에 둔 컴포넌트
+
+        // SAH 비용 = (내부 노드 표면적 합 + 리프 표면적 x 개수 합) / 루트 표면적 + 트리 밖 컴포넌트 수
+        float SAHCost = 0.0f;
+        float BuildSAHCost = 0.0f; // 마지막 전체 재구축 직후 비용
+    };
+
     /**
      * *주의사항*
      * AActor 기반에서 UPrimitiveComponent 기반으로 변경을 거친 BVH입니다.
@@ -33,6 +65,10 @@ public:
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+    // 컴포넌트 단위 레이 질의 (MaxDistance 이상 떨어진 교차는 무시)
+    bool QueryRayClosest(const FRay& Ray, OUT FHitResult& OutHit, float MaxDistance) const;
+    bool QueryRayAny(const FRay& Ray, float MaxDistance) const;     // 처음 맞은 삼각형에서 멈춤
+    void QueryRayAll(const FRay& Ray, OUT TArray<FHitResult>& OutHits, float MaxDistance) const; // 정렬 없이 뒤에 붙인다
     void QueryFrustum(const FFrustum& InFrustum);
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
@@ -46,6 +82,13 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    const FStats& GetStats() const { return Stats; }
+
+    /**
+     * 컴포넌트 없이 바운드 배열만으로 트리를 지어 노드 수를 돌려준다 (BENCH BVH용)
+     * bParallel이 false면 예전과 같은 직렬 경로(std::sort)로 짓는다.
+     */
+    static int32 BuildFromBounds(const TArray<FAABB>& PrimitiveBounds, int32 InMaxObjects, bool bParallel);
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -59,28 +102,73 @@ private:
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
+        int32 Parent = -1;
+        float BuildArea = 0.0f;     // (재)구축 시점의 표면적, 서브트리가 얼마나 부풀었는지 비교용
+        int32 NumFree = 0;          // 서브트리 안의 빈 슬롯 수 (삽입 시 빈 슬롯이 있는 쪽으로만 내려간다)
+        bool bRefitQueued = false;
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
 
+    // 재구축 없는 추가/제거: 제거는 슬롯을 비우고, 추가는 빈 슬롯을 채우거나 트리 밖 목록에 둔다
+    void InsertComponent(UPrimitiveComponent* InComponent, const FAABB& InBounds);
+    void RemoveFromLeaf(UPrimitiveComponent* InComponent, int32 LeafIdx);
+    void AddFreeSlots(int32 LeafIdx, int32 Delta);
+    void QueueLeafRefit(int32 LeafIdx);
+
+    // Refit
+    void Refit();
+    void RebuildSubtree(int32 NodeIdx);
+    void SortRangeByMortonCode(int32 Start, int32 End);
+    FAABB ComputeLeafBounds(const FLBVHNode& Leaf) const;
+    void SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds);
+    void RefitSubtree(int32 NodeIdx);
+    void RefitAncestors(int32 NodeIdx);
+    void ResetSAHCost();
+    float GetSAHCost() const;
+
 private:
+    // 레이가 지나는 컴포넌트를 가까운 노드부터 방문. OnComponent가 true를 돌려주면 즉시 끝낸다.
+    // MaxDistance는 참조라서 OnComponent가 줄이면 그보다 먼 노드는 버린다
+    template<typename ComponentFunc>
+    void TraverseRay(const FRay& Ray, const float& MaxDistance, ComponentFunc OnComponent) const;
+
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
     TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
         , ComponentIntersectFunc ComponentIntersects) const;
 
-    int BuildRange(int s, int e);
+    // 바운드 배열 -> 모튼 코드 정렬 순서(OutOrder[i] = 원래 인덱스) + 노드
+    // 분할은 개수로만 반씩 나누므로 노드 인덱스를 미리 계산해 서브트리를 따로따로 지을 수 있다
+    static void BuildHierarchy(const TArray<FAABB>& PrimitiveBounds, int32 InMaxObjects, bool bParallel,
+        FAABB& OutSceneBounds, TArray<int32>& OutOrder, TArray<FLBVHNode>& OutNodes);
+    static int32 BuildSubtree(const TArray<FAABB>& SortedBounds, int32 InMaxObjects, int32 Start, int32 End, int32 NodeIdx,
+        TArray<FLBVHNode>& OutNodes);
 
     int Depth;
     int MaxDepth;
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
+    // 이미 트리에 있는 컴포넌트 -> 리프 노드 (움직인 컴포넌트는 재구축 없이 이 리프만 refit)
+    TFlatMap<UPrimitiveComponent*, int32> ComponentLeaves;
+    TArray<int32> PendingRefitLeaves;
+
+    // 쓸 만한 빈 슬롯이 없을 때 추가된 컴포넌트. 질의마다 선형으로 검사하고, SAH 비용에 한 개당 1씩 더해져 결국 전체 재구축을 부른다
+    TArray<UPrimitiveComponent*> OverflowComponents;
+    bool bLayoutChanged = false;    // 리프 바운드 변화 없이 슬롯/트리 밖 목록만 바뀐 경우에도 품질을 다시 본다
+
+    // SAH 비용 누적값 (노드 바운드가 바뀔 때마다 차이만 반영)
+    double SumInternalArea = 0.0;
+    double SumLeafArea = 0.0;
+
+    FStats Stats;
+
     bool bPendingRebuild = false;
 };
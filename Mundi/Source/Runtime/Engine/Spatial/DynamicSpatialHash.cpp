@@ -0,0 +1,345 @@
+#include "pch.h"
+#include <algorithm>
+#include <cmath>
+#include "DynamicSpatialHash.h"
+#include "Actor.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "Collision.h"
+#include "OBB.h"
+#include "BoundingSphere.h"
+#include "Frustum.h"
+#include "Picking.h" // FRay
+
+namespace
+{
+    // 셀 좌표는 축마다 21비트 (부호 포함) -> 셀 4m 기준 ±4000km
+    constexpr int32 CellCoordBits = 21;
+    constexpr int32 CellCoordLimit = (1 << (CellCoordBits - 1)) - 1;
+    constexpr uint64 CellCoordMask = (1ull << CellCoordBits) - 1;
+
+    inline int32 ToCellCoord(float Value, float InvCellSize)
+    {
+        const float Scaled = std::floor(Value * InvCellSize);
+        // NaN/무한대/아주 먼 좌표는 가장자리 셀로 모은다
+        if (!(Scaled > -static_cast<float>(CellCoordLimit))) return -CellCoordLimit;
+        if (!(Scaled < static_cast<float>(CellCoordLimit))) return CellCoordLimit;
+        return static_cast<int32>(Scaled);
+    }
+
+    inline uint64 PackCellKey(int32 X, int32 Y, int32 Z)
+    {
+        return (static_cast<uint64>(X) & CellCoordMask)
+            | ((static_cast<uint64>(Y) & CellCoordMask) << CellCoordBits)
+            | ((static_cast<uint64>(Z) & CellCoordMask) << (CellCoordBits * 2));
+    }
+}
+
+FDynamicSpatialHash::FDynamicSpatialHash(float InCellSize)
+    : CellSize(InCellSize > 0.0f ? InCellSize : 4.0f)
+    , InvCellSize(1.0f / CellSize)
+{
+}
+
+void FDynamicSpatialHash::Clear()
+{
+    Entries.Empty();
+    EntryIndices.Empty();
+    Cells.Empty();
+    LooseMargin = 0.0f;
+}
+
+uint64 FDynamicSpatialHash::ComputeCellKey(const FAABB& InBounds) const
+{
+    const FVector HalfExtent = InBounds.GetHalfExtent();
+    if (std::max({ HalfExtent.X, HalfExtent.Y, HalfExtent.Z }) > CellSize)
+    {
+        return OversizedCellKey;
+    }
+
+    const FVector Center = InBounds.GetCenter();
+    return PackCellKey(
+        ToCellCoord(Center.X, InvCellSize),
+        ToCellCoord(Center.Y, InvCellSize),
+        ToCellCoord(Center.Z, InvCellSize));
+}
+
+void FDynamicSpatialHash::LinkToCell(int32 EntryIdx, uint64 Key)
+{
+    TArray<int32>& Slots = Cells.FindOrAdd(Key);
+    FEntry& Entry = Entries[EntryIdx];
+    Entry.CellKey = Key;
+    Entry.SlotInCell = static_cast<int32>(Slots.size());
+    Slots.Add(EntryIdx);
+}
+
+void FDynamicSpatialHash::UnlinkFromCell(int32 EntryIdx)
+{
+    const FEntry& Entry = Entries[EntryIdx];
+    TArray<int32>* Slots = Cells.Find(Entry.CellKey);
+    if (!Slots) return;
+
+    // 셀 안에서 swap-remove: 옮겨진 항목의 슬롯 위치를 고쳐 준다
+    const int32 LastEntryIdx = Slots->back();
+    (*Slots)[Entry.SlotInCell] = LastEntryIdx;
+    Entries[LastEntryIdx].SlotInCell = Entry.SlotInCell;
+    Slots->pop_back();
+
+    if (Slots->empty())
+    {
+        Cells.Remove(Entry.CellKey);
+    }
+}
+
+void FDynamicSpatialHash::Update(UPrimitiveComponent* InComponent, double InTime)
+{
+    if (!InComponent) return;
+
+    const FAABB NewBounds = InComponent->GetWorldAABB();
+    const uint64 NewKey = ComputeCellKey(NewBounds);
+    if (NewKey != OversizedCellKey)
+    {
+        const FVector HalfExtent = NewBounds.GetHalfExtent();
+        LooseMargin = std::max({ LooseMargin, HalfExtent.X, HalfExtent.Y, HalfExtent.Z });
+    }
+
+    if (const int32* Found = EntryIndices.Find(InComponent))
+    {
+        const int32 EntryIdx = *Found;
+        if (Entries[EntryIdx].CellKey != NewKey)
+        {
+            UnlinkFromCell(EntryIdx);
+            LinkToCell(EntryIdx, NewKey);
+        }
+        Entries[EntryIdx].Bounds = NewBounds;
+        Entries[EntryIdx].LastUpdateTime = InTime;
+        return;
+    }
+
+    const int32 EntryIdx = static_cast<int32>(Entries.size());
+    FEntry& Entry = Entries.emplace_back();
+    Entry.Component = InComponent;
+    Entry.Bounds = NewBounds;
+    Entry.LastUpdateTime = InTime;
+    EntryIndices.Add(InComponent, EntryIdx);
+    LinkToCell(EntryIdx, NewKey);
+}
+
+void FDynamicSpatialHash::Remove(UPrimitiveComponent* InComponent)
+{
+    const int32* Found = EntryIndices.Find(InComponent);
+    if (!Found) return;
+
+    const int32 EntryIdx = *Found;
+    UnlinkFromCell(EntryIdx);
+    EntryIndices.Remove(InComponent);
+
+    // 엔트리 배열도 swap-remove: 마지막 엔트리를 빈자리로 옮기고 셀/맵의 인덱스를 고친다
+    const int32 LastEntryIdx = static_cast<int32>(Entries.size()) - 1;
+    if (EntryIdx != LastEntryIdx)
+    {
+        FEntry& Moved = Entries[LastEntryIdx];
+        if (TArray<int32>* Slots = Cells.Find(Moved.CellKey))
+        {
+            (*Slots)[Moved.SlotInCell] = EntryIdx;
+        }
+        EntryIndices.Add(Moved.Component, EntryIdx);
+        Entries[EntryIdx] = Moved;
+    }
+    Entries.pop_back();
+}
+
+void FDynamicSpatialHash::GatherIdle(double OlderThan, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    for (const FEntry& Entry : Entries)
+    {
+        if (Entry.LastUpdateTime < OlderThan)
+        {
+            OutComponents.Add(Entry.Component);
+        }
+    }
+}
+
+// 움직이는 컴포넌트는 소수라서 셀을 따라 걷지 않고 전부 검사한다
+template<typename ComponentFunc>
+void FDynamicSpatialHash::TraverseRay(const FRay& Ray, const float& MaxDistance, ComponentFunc OnComponent) const
+{
+    for (const FEntry& Entry : Entries)
+    {
+        UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(Entry.Component);
+        if (!Component) continue;
+        AActor* Owner = Component->GetOwner();
+        if (!Owner) continue;
+        if (Owner->GetActorHiddenInEditor()) continue;
+
+        FAABB Box = Entry.Bounds;
+        float EnterT, ExitT;
+        if (!Box.IntersectsRay(Ray, EnterT, ExitT) || ExitT < 0.0f || EnterT > MaxDistance)
+            continue;
+
+        if (OnComponent(Component))
+            return;
+    }
+}
+
+void FDynamicSpatialHash::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+{
+    if (!(std::isfinite(OutBestT) && OutBestT > 0.0f))
+    {
+        OutBestT = std::numeric_limits<float>::infinity();
+    }
+
+    FHitResult Hit;
+    if (QueryRayClosest(Ray, Hit, OutBestT))
+    {
+        OutActor = Hit.Actor;
+        OutBestT = Hit.Distance;
+    }
+}
+
+bool FDynamicSpatialHash::QueryRayClosest(const FRay& Ray, OUT FHitResult& OutHit, float MaxDistance) const
+{
+    float BestT = MaxDistance;
+    bool bHit = false;
+    TraverseRay(Ray, BestT, [&](UStaticMeshComponent* Component)
+    {
+        if (CPickingSystem::RaycastComponent(Component, Ray, BestT, OutHit))
+        {
+            BestT = OutHit.Distance;
+            bHit = true;
+        }
+        return false;
+    });
+    return bHit;
+}
+
+bool FDynamicSpatialHash::QueryRayAny(const FRay& Ray, float MaxDistance) const
+{
+    bool bHit = false;
+    TraverseRay(Ray, MaxDistance, [&](UStaticMeshComponent* Component)
+    {
+        bHit = CPickingSystem::RaycastComponentAny(Component, Ray, MaxDistance);
+        return bHit;
+    });
+    return bHit;
+}
+
+void FDynamicSpatialHash::QueryRayAll(const FRay& Ray, OUT TArray<FHitResult>& OutHits, float MaxDistance) const
+{
+    TraverseRay(Ray, MaxDistance, [&](UStaticMeshComponent* Component)
+    {
+        CPickingSystem::RaycastComponentAll(Component, Ray, MaxDistance, OutHits);
+        return false;
+    });
+}
+
+void FDynamicSpatialHash::QueryFrustum(const FFrustum& InFrustum) const
+{
+    for (const FEntry& Entry : Entries)
+    {
+        if (IsAABBVisible(InFrustum, Entry.Bounds))
+        {
+            if (AActor* Owner = Entry.Component->GetOwner())
+            {
+                Owner->SetCulled(false);
+            }
+        }
+    }
+}
+
+template<typename BoundType, typename ComponentIntersectFunc>
+TArray<UPrimitiveComponent*> FDynamicSpatialHash::QueryIntersectedComponentsGeneric(
+    const BoundType& InBound,
+    const FAABB& QueryBounds,
+    ComponentIntersectFunc ComponentIntersects) const
+{
+    TArray<UPrimitiveComponent*> IntersectedComponents;
+    if (Entries.empty())
+        return IntersectedComponents;
+
+    auto VisitEntry = [&](int32 EntryIdx)
+    {
+        const FEntry& Entry = Entries[EntryIdx];
+        if (ComponentIntersects(Entry.Bounds, InBound))
+        {
+            IntersectedComponents.Add(Entry.Component);
+        }
+    };
+
+    // 중심 셀에만 들어가 있으므로 질의 영역을 최대 반 크기만큼 넓혀야 걸치는 컴포넌트를 놓치지 않는다
+    int32 Lo[3], Hi[3];
+    uint64 NumRangeCells = 1;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Lo[Axis] = ToCellCoord(QueryBounds.Min[Axis] - LooseMargin, InvCellSize);
+        Hi[Axis] = ToCellCoord(QueryBounds.Max[Axis] + LooseMargin, InvCellSize);
+        if (Hi[Axis] < Lo[Axis])
+            return IntersectedComponents;
+        NumRangeCells *= static_cast<uint64>(Hi[Axis] - Lo[Axis] + 1);
+        NumRangeCells = std::min<uint64>(NumRangeCells, 1ull << 40);
+    }
+
+    // 훑을 셀이 엔트리보다 많으면 엔트리를 직접 도는 편이 싸다
+    if (NumRangeCells > Entries.size())
+    {
+        for (int32 EntryIdx = 0; EntryIdx < static_cast<int32>(Entries.size()); ++EntryIdx)
+        {
+            VisitEntry(EntryIdx);
+        }
+        return IntersectedComponents;
+    }
+
+    if (const TArray<int32>* Oversized = Cells.Find(OversizedCellKey))
+    {
+        for (int32 EntryIdx : *Oversized)
+        {
+            VisitEntry(EntryIdx);
+        }
+    }
+
+    for (int32 Z = Lo[2]; Z <= Hi[2]; ++Z)
+    {
+        for (int32 Y = Lo[1]; Y <= Hi[1]; ++Y)
+        {
+            for (int32 X = Lo[0]; X <= Hi[0]; ++X)
+            {
+                if (const TArray<int32>* Slots = Cells.Find(PackCellKey(X, Y, Z)))
+                {
+                    for (int32 EntryIdx : *Slots)
+                    {
+                        VisitEntry(EntryIdx);
+                    }
+                }
+            }
+        }
+    }
+    return IntersectedComponents;
+}
+
+TArray<UPrimitiveComponent*> FDynamicSpatialHash::QueryIntersectedComponents(const FAABB& InBound) const
+{
+    return QueryIntersectedComponentsGeneric(
+        InBound,
+        InBound,
+        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); }
+    );
+}
+
+TArray<UPrimitiveComponent*> FDynamicSpatialHash::QueryIntersectedComponents(const FOBB& InBound) const
+{
+    return QueryIntersectedComponentsGeneric(
+        InBound,
+        FAABB(InBound.GetCorners()),
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); }
+    );
+}
+
+TArray<UPrimitiveComponent*> FDynamicSpatialHash::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+{
+    const FVector RadiusExtent(InBound.Radius, InBound.Radius, InBound.Radius);
+    return QueryIntersectedComponentsGeneric(
+        InBound,
+        FAABB(InBound.Center - RadiusExtent, InBound.Center + RadiusExtent),
+        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
+    );
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "FlatHashMap.h"
+
+struct FFrustum;
+struct FRay;
+struct FHitResult;
+class UPrimitiveComponent;
+class UStaticMeshComponent;
+class AActor;
+struct FOBB;
+struct FBoundingSphere;
+
+/**
+ * @brief 움직이는 컴포넌트용 브로드 페이즈 (느슨한 균일 격자를 해시로 저장)
+ * 컴포넌트는 바운드 중심이 속한 셀 하나에만 들어가므로 이동 갱신은 O(1)이다 (셀이 바뀌면 빼고 넣기만 함).
+ * 질의는 영역을 지금까지 들어온 컴포넌트의 최대 반 크기(LooseMargin)만큼 넓혀 셀을 훑는다.
+ * 반 크기가 셀보다 큰 컴포넌트는 따로 모아 두고 질의마다 전부 검사한다.
+ *
+ * 정적인 대부분은 FBVHierarchy에 두고, 계속 움직이는 소수만 여기에 둔다 (UWorldPartitionManager 참고).
+ */
+class FDynamicSpatialHash
+{
+public:
+    explicit FDynamicSpatialHash(float InCellSize = 4.0f);
+
+    void Clear();
+
+    // 없으면 추가, 있으면 바운드/셀 갱신. InTime은 마지막으로 움직인 시각 (GatherIdle용)
+    void Update(UPrimitiveComponent* InComponent, double InTime);
+    void Remove(UPrimitiveComponent* InComponent);
+    bool Contains(UPrimitiveComponent* InComponent) const { return EntryIndices.Contains(InComponent); }
+
+    // 마지막 갱신이 OlderThan보다 이전인 컴포넌트 수집
+    void GatherIdle(double OlderThan, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+    // OutActor/OutBestT를 이미 찾은 결과로 보고 더 가까운 것이 있을 때만 덮어쓴다
+    void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+    // 컴포넌트 단위 레이 질의 (FBVHierarchy와 같은 규칙)
+    bool QueryRayClosest(const FRay& Ray, OUT FHitResult& OutHit, float MaxDistance) const;
+    bool QueryRayAny(const FRay& Ray, float MaxDistance) const;
+    void QueryRayAll(const FRay& Ray, OUT TArray<FHitResult>& OutHits, float MaxDistance) const;
+    void QueryFrustum(const FFrustum& InFrustum) const;
+    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
+    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
+    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+
+    // Debug/Stats
+    int32 Num() const { return static_cast<int32>(Entries.size()); }
+    int32 GetNumCells() const { return static_cast<int32>(Cells.Num()); }
+    float GetCellSize() const { return CellSize; }
+
+private:
+    struct FEntry
+    {
+        UPrimitiveComponent* Component = nullptr;
+        FAABB Bounds;
+        uint64 CellKey = 0;
+        int32 SlotInCell = -1;      // Cells[CellKey] 안에서의 위치
+        double LastUpdateTime = 0.0;
+    };
+
+    // 셀보다 큰 컴포넌트를 모아 두는 가상의 셀 (좌표 키는 63비트 안에 들어가므로 겹치지 않음)
+    static constexpr uint64 OversizedCellKey = ~0ull;
+
+    uint64 ComputeCellKey(const FAABB& InBounds) const;
+    void LinkToCell(int32 EntryIdx, uint64 Key);
+    void UnlinkFromCell(int32 EntryIdx);
+
+    // 바운드가 레이에 걸리는 컴포넌트 방문 (OnComponent가 true면 끝냄, MaxDistance는 참조라 줄어들 수 있음)
+    template<typename ComponentFunc>
+    void TraverseRay(const FRay& Ray, const float& MaxDistance, ComponentFunc OnComponent) const;
+
+    template<typename BoundType, typename ComponentIntersectFunc>
+    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound, const FAABB& QueryBounds,
+        ComponentIntersectFunc ComponentIntersects) const;
+
+    float CellSize;
+    float InvCellSize;
+    float LooseMargin = 0.0f;   // 격자에 든 컴포넌트의 최대 반 크기 (Clear 전까지 줄어들지 않음)
+
+    TArray<FEntry> Entries;
+    TFlatMap<UPrimitiveComponent*, int32> EntryIndices;
+    TFlatMap<uint64, TArray<int32>> Cells;
+};
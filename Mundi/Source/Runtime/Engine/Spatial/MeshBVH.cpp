@@ -1,333 +1,634 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "InlineArray.h"
+#include "VectorRegister.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+	inline float GetSurfaceArea(const FVector& Min, const FVector& Max)
+	{
+		const FVector Size = Max - Min;
+		return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+	inline void GrowMinMax(FVector& InOutMin, FVector& InOutMax, const FVector& OtherMin, const FVector& OtherMax)
+	{
+		InOutMin = FVector(std::min(InOutMin.X, OtherMin.X), std::min(InOutMin.Y, OtherMin.Y), std::min(InOutMin.Z, OtherMin.Z));
+		InOutMax = FVector(std::max(InOutMax.X, OtherMax.X), std::max(InOutMax.Y, OtherMax.Y), std::max(InOutMax.Z, OtherMax.Z));
+	}
+
+	inline FAABB ToBounds(const VectorRegister4f& Min, const VectorRegister4f& Max)
+	{
+		FAABB Bounds;
+		VectorStoreFloat3(Min, &Bounds.Min.X);
+		VectorStoreFloat3(Max, &Bounds.Max.X);
+		return Bounds;
+	}
+
+	inline float GetSurfaceArea(const VectorRegister4f& Min, const VectorRegister4f& Max)
+	{
+		alignas(16) float Size[4];
+		VectorStoreAligned(VectorSubtract(Max, Min), Size);
+		return 2.0f * (Size[0] * Size[1] + Size[1] * Size[2] + Size[2] * Size[0]);
+	}
+
+	// 내부 노드 하나를 거치는 비용 (삼각형 검사 1 기준)
+	constexpr float TraversalCost = 1.0f;
+
+	/**
+	 * Watertight 레이-삼각형 교차 (Woop, Benthin, Wald 2013)
+	 * 레이 방향의 가장 큰 축을 z로 두고 전단 변환한 2D 공간에서 모서리 함수를 계산하므로
+	 * 인접 삼각형이 공유하는 모서리/정점에 맞은 레이가 틈으로 빠지지 않는다.
+	 */
+	struct FWatertightRay
+	{
+		FVector Origin;
+		int32 Kx, Ky, Kz;
+		float Sx, Sy, Sz;
+	};
+
+	inline FWatertightRay MakeWatertightRay(const FRay& Ray)
+	{
+		FWatertightRay Result;
+		Result.Origin = Ray.Origin;
+
+		const FVector& Dir = Ray.Direction;
+		Result.Kz = 0;
+		if (std::fabs(Dir.Y) > std::fabs(Dir[Result.Kz])) Result.Kz = 1;
+		if (std::fabs(Dir.Z) > std::fabs(Dir[Result.Kz])) Result.Kz = 2;
+		Result.Kx = (Result.Kz + 1) % 3;
+		Result.Ky = (Result.Kx + 1) % 3;
+		// 감기 순서 유지
+		if (Dir[Result.Kz] < 0.0f) std::swap(Result.Kx, Result.Ky);
+
+		Result.Sx = Dir[Result.Kx] / Dir[Result.Kz];
+		Result.Sy = Dir[Result.Ky] / Dir[Result.Kz];
+		Result.Sz = 1.0f / Dir[Result.Kz];
+		return Result;
+	}
+
+	// 양면 검사. MaxT보다 가까운 교차만 인정하며, 무게중심 좌표는 (V1 가중치, V2 가중치)
+	inline bool IntersectTriangleWatertight(const FWatertightRay& Ray, const FMeshBVHTriangle& Tri, float MaxT,
+		float& OutT, float& OutU, float& OutV)
+	{
+		const FVector A = Tri.V0 - Ray.Origin;
+		const FVector B = Tri.V1 - Ray.Origin;
+		const FVector C = Tri.V2 - Ray.Origin;
+
+		const float Ax = A[Ray.Kx] - Ray.Sx * A[Ray.Kz];
+		const float Ay = A[Ray.Ky] - Ray.Sy * A[Ray.Kz];
+		const float Bx = B[Ray.Kx] - Ray.Sx * B[Ray.Kz];
+		const float By = B[Ray.Ky] - Ray.Sy * B[Ray.Kz];
+		const float Cx = C[Ray.Kx] - Ray.Sx * C[Ray.Kz];
+		const float Cy = C[Ray.Ky] - Ray.Sy * C[Ray.Kz];
+
+		float U = Cx * By - Cy * Bx;
+		float V = Ax * Cy - Ay * Cx;
+		float W = Bx * Ay - By * Ax;
+
+		// 모서리 위라서 float로 부호가 애매하면 double로 다시 계산
+		if (U == 0.0f || V == 0.0f || W == 0.0f)
+		{
+			U = static_cast<float>(static_cast<double>(Cx) * By - static_cast<double>(Cy) * Bx);
+			V = static_cast<float>(static_cast<double>(Ax) * Cy - static_cast<double>(Ay) * Cx);
+			W = static_cast<float>(static_cast<double>(Bx) * Ay - static_cast<double>(By) * Ax);
+		}
+
+		if ((U < 0.0f || V < 0.0f || W < 0.0f) && (U > 0.0f || V > 0.0f || W > 0.0f))
+			return false;
+
+		const float Det = U + V + W;
+		if (Det == 0.0f)
+			return false;
+
+		const float Az = Ray.Sz * A[Ray.Kz];
+		const float Bz = Ray.Sz * B[Ray.Kz];
+		const float Cz = Ray.Sz * C[Ray.Kz];
+		const float T = U * Az + V * Bz + W * Cz;
+
+		// 나눗셈 전에 Det 부호에 맞춰 범위 검사 (IntersectRayTriangleMT와 같은 최소 거리)
+		const float AbsDet = std::fabs(Det);
+		const float SignedT = Det < 0.0f ? -T : T;
+		if (SignedT <= KINDA_SMALL_NUMBER * AbsDet || SignedT >= MaxT * AbsDet)
+			return false;
+
+		const float InvDet = 1.0f / Det;
+		OutT = T * InvDet;
+		OutU = V * InvDet;
+		OutV = W * InvDet;
+		return true;
+	}
+}
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
 	TriIndices.Empty();
 	Nodes.Empty();
+	Triangles.Empty();
 	uint32 TriCount = Indices.Num() / 3;
 	if (TriCount == 0) return;
 
-	TriIndices.Reserve(TriCount);
+	// 삼각형별 AABB와 중심을 한 번만 계산해 두고 분할 때 재사용
+	BuildPrimitives.SetNum(TriCount);
 	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	{
+		const FVector& A = Vertices[Indices[3 * t + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * t + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * t + 2]].pos;
+		FBuildPrimitive& Primitive = BuildPrimitives[t];
+		Primitive.Min[0] = std::min({ A.X, B.X, C.X });
+		Primitive.Min[1] = std::min({ A.Y, B.Y, C.Y });
+		Primitive.Min[2] = std::min({ A.Z, B.Z, C.Z });
+		Primitive.Min[3] = 0.0f;
+		Primitive.Max[0] = std::max({ A.X, B.X, C.X });
+		Primitive.Max[1] = std::max({ A.Y, B.Y, C.Y });
+		Primitive.Max[2] = std::max({ A.Z, B.Z, C.Z });
+		Primitive.Max[3] = 0.0f;
+		Primitive.Center = FVector(
+			(Primitive.Min[0] + Primitive.Max[0]) * 0.5f,
+			(Primitive.Min[1] + Primitive.Max[1]) * 0.5f,
+			(Primitive.Min[2] + Primitive.Max[2]) * 0.5f);
+		Primitive.TriangleID = t;
+	}
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	TArray<FMeshBVHNode> BinaryNodes;
+	BinaryNodes.Reserve(2 * TriCount);
+	BuildRecursive(0, TriCount, BinaryNodes);
+
+	// 리프 순서대로 정점을 복사해 트래버설 중 인덱스 버퍼 간접 참조를 없앤다
+	TriIndices.SetNum(TriCount);
+	Triangles.SetNum(TriCount);
+	for (uint32 i = 0; i < TriCount; ++i)
+	{
+		const uint32 TriangleID = BuildPrimitives[i].TriangleID;
+		TriIndices[i] = TriangleID;
+		Triangles[i].V0 = Vertices[Indices[3 * TriangleID + 0]].pos;
+		Triangles[i].V1 = Vertices[Indices[3 * TriangleID + 1]].pos;
+		Triangles[i].V2 = Vertices[Indices[3 * TriangleID + 2]].pos;
+	}
+
+	Nodes.Reserve(BinaryNodes.Num() / 2 + 1);
+	CollapseNode(BinaryNodes, 0);
+
+	BuildPrimitives.Empty();
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+// 노드를 가까운 순서로 방문한다.
+// 노드마다 자식 4개의 slab 검사를 레지스터 연산으로 한 번에 하고, InOutMaxT보다 먼 자식은 버린다.
+template<typename HitFunc>
+void FMeshBVH::TraverseRay(const FRay& InLocalRay, float& InOutMaxT, HitFunc OnHit) const
 {
 	if (Nodes.Num() == 0)
 	{
-		return false;
+		return;
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	const FWatertightRay TriangleRay = MakeWatertightRay(InLocalRay);
+
+	// 방향 성분이 0이면 0 * inf = NaN이 나올 수 있어 아주 작은 값으로 바꾼다
+	float InvDir[3];
+	bool bNegative[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
 	{
-		return false;
+		float Dir = InLocalRay.Direction[Axis];
+		if (std::fabs(Dir) < 1e-20f)
+		{
+			Dir = std::copysign(1e-20f, Dir);
+		}
+		InvDir[Axis] = 1.0f / Dir;
+		bNegative[Axis] = InvDir[Axis] < 0.0f;
 	}
 
-	struct FHeapItem
+	const VectorRegister4f OriginX = VectorSetFloat1(InLocalRay.Origin.X);
+	const VectorRegister4f OriginY = VectorSetFloat1(InLocalRay.Origin.Y);
+	const VectorRegister4f OriginZ = VectorSetFloat1(InLocalRay.Origin.Z);
+	const VectorRegister4f InvDirX = VectorSetFloat1(InvDir[0]);
+	const VectorRegister4f InvDirY = VectorSetFloat1(InvDir[1]);
+	const VectorRegister4f InvDirZ = VectorSetFloat1(InvDir[2]);
+	const VectorRegister4f Zero = VectorZero();
+
+	struct FTraversalEntry
 	{
-		int NodeIndex;
+		int32 NodeIndex;
 		float EntryDistance;
-
-		bool operator>(const FHeapItem& Other) const
-		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
-		}
 	};
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	TInlineArray<FTraversalEntry, 64> Stack;
+	Stack.push_back({ 0, 0.0f });
 
-	while (!Heap.empty())
+	while (!Stack.empty())
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
-
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+		const FTraversalEntry Current = Stack.back();
+		Stack.pop_back();
+		if (Current.EntryDistance > InOutMaxT)
+			continue;
+
+		const FMeshBVHNode4& Node = Nodes[Current.NodeIndex];
+
+		// 음의 방향 축은 Max 면이 가까운 면이다 (빈 슬롯은 이 선택 덕분에 항상 TNear = +inf)
+		const VectorRegister4f NearX = VectorLoad(bNegative[0] ? Node.MaxX : Node.MinX);
+		const VectorRegister4f NearY = VectorLoad(bNegative[1] ? Node.MaxY : Node.MinY);
+		const VectorRegister4f NearZ = VectorLoad(bNegative[2] ? Node.MaxZ : Node.MinZ);
+		const VectorRegister4f FarX = VectorLoad(bNegative[0] ? Node.MinX : Node.MaxX);
+		const VectorRegister4f FarY = VectorLoad(bNegative[1] ? Node.MinY : Node.MaxY);
+		const VectorRegister4f FarZ = VectorLoad(bNegative[2] ? Node.MinZ : Node.MaxZ);
+
+		const VectorRegister4f TNear = VectorMax(
+			VectorMax(VectorMultiply(VectorSubtract(NearX, OriginX), InvDirX), VectorMultiply(VectorSubtract(NearY, OriginY), InvDirY)),
+			VectorMax(VectorMultiply(VectorSubtract(NearZ, OriginZ), InvDirZ), Zero));
+		const VectorRegister4f TFar = VectorMin(
+			VectorMin(VectorMultiply(VectorSubtract(FarX, OriginX), InvDirX), VectorMultiply(VectorSubtract(FarY, OriginY), InvDirY)),
+			VectorMin(VectorMultiply(VectorSubtract(FarZ, OriginZ), InvDirZ), VectorSetFloat1(InOutMaxT)));
+
+		const int HitMask = VectorMaskLessEqual(TNear, TFar);
+		if (HitMask == 0)
+			continue;
+
+		alignas(16) float EntryDistances[4];
+		VectorStoreAligned(TNear, EntryDistances);
+
+		// 리프는 바로 검사하고, 내부 노드는 먼 것부터 스택에 쌓아 가까운 것을 먼저 꺼낸다
+		FTraversalEntry Children[4];
+		int32 NumChildren = 0;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
-			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
-
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+			if ((HitMask & (1 << Slot)) == 0)
+				continue;
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+			if (Node.Count[Slot] > 0)
+			{
+				const int32 First = Node.Child[Slot];
+				const int32 Last = First + Node.Count[Slot];
+				for (int32 TriIdx = First; TriIdx < Last; ++TriIdx)
 				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					float HitT, HitU, HitV;
+					if (IntersectTriangleWatertight(TriangleRay, Triangles[TriIdx], InOutMaxT, HitT, HitU, HitV)
+						&& OnHit(TriIdx, HitT, HitU, HitV))
+					{
+						return;
+					}
 				}
+				continue;
 			}
+
+			// 삽입 정렬 (EntryDistance 내림차순)
+			int32 InsertAt = NumChildren++;
+			while (InsertAt > 0 && Children[InsertAt - 1].EntryDistance < EntryDistances[Slot])
+			{
+				Children[InsertAt] = Children[InsertAt - 1];
+				--InsertAt;
+			}
+			Children[InsertAt] = { Node.Child[Slot], EntryDistances[Slot] };
 		}
-		else
+
+		for (int32 i = 0; i < NumChildren; ++i)
 		{
-			if (Node.Left >= 0)
+			if (Children[i].EntryDistance <= InOutMaxT)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
-			}
-			if (Node.Right >= 0)
-			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Right, ChildEntry });
-				}
+				Stack.push_back(Children[i]);
 			}
 		}
 	}
-
-	return false;
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
 {
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
+	float BestT = std::numeric_limits<float>::infinity();
+	bool bHit = false;
+	TraverseRay(InLocalRay, BestT, [&](int32, float T, float, float)
+	{
+		BestT = T;
+		bHit = true;
+		return false;
+	});
+
+	if (bHit)
+	{
+		OutHitDistance = BestT;
+	}
+	return bHit;
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, FMeshBVHHit& OutHit, float MaxDistance) const
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
+	int32 BestTriIdx = -1;
+	float BestT = MaxDistance, BestU = 0.0f, BestV = 0.0f;
+	TraverseRay(InLocalRay, BestT, [&](int32 LeafTriIdx, float T, float U, float V)
+	{
+		BestTriIdx = LeafTriIdx;
+		BestT = T;
+		BestU = U;
+		BestV = V;
+		return false;
+	});
 
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	if (BestTriIdx < 0)
+	{
+		return false;
+	}
+	OutHit = MakeHit(InLocalRay, BestTriIdx, BestT, BestU, BestV);
+	return true;
+}
 
-	// 중심점(무게중심) 계산
+bool FMeshBVH::IntersectRayAny(const FRay& InLocalRay, float MaxDistance) const
+{
+	bool bHit = false;
+	TraverseRay(InLocalRay, MaxDistance, [&](int32, float, float, float)
+	{
+		bHit = true;
+		return true;
+	});
+	return bHit;
+}
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+int32 FMeshBVH::IntersectRayAll(const FRay& InLocalRay, TArray<FMeshBVHHit>& OutHits, float MaxDistance) const
+{
+	const int32 FirstNew = OutHits.Num();
+	TraverseRay(InLocalRay, MaxDistance, [&](int32 LeafTriIdx, float T, float U, float V)
+	{
+		OutHits.Add(MakeHit(InLocalRay, LeafTriIdx, T, U, V));
+		return false;
+	});
 
-	return TriangleCenter;
+	std::sort(OutHits.begin() + FirstNew, OutHits.end(),
+		[](const FMeshBVHHit& A, const FMeshBVHHit& B) { return A.Distance < B.Distance; });
+	return OutHits.Num() - FirstNew;
+}
+
+FMeshBVHHit FMeshBVH::MakeHit(const FRay& InLocalRay, int32 LeafTriIdx, float T, float U, float V) const
+{
+	const FMeshBVHTriangle& Tri = Triangles[LeafTriIdx];
+
+	FMeshBVHHit Hit;
+	Hit.Distance = T;
+	Hit.TriangleIndex = static_cast<int32>(TriIndices[LeafTriIdx]);
+	Hit.U = U;
+	Hit.V = V;
+	// 아주 작은 삼각형도 노멀이 0이 되지 않도록 GetNormalized의 하한 없이 정규화
+	const FVector Normal = FVector::Cross(Tri.V1 - Tri.V0, Tri.V2 - Tri.V0);
+	const float Length = Normal.Size();
+	Hit.Normal = Length > 0.0f ? Normal / Length : FVector(0.0f, 0.0f, 0.0f);
+	if (FVector::Dot(Hit.Normal, InLocalRay.Direction) > 0.0f)
+	{
+		Hit.Normal = -Hit.Normal;
+	}
+	return Hit;
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 여러 삼각형을 한 번에 감싸는 AABB를 계산
+FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count) const
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
+	VectorRegister4f Min = VectorLoad(BuildPrimitives[Start].Min);
+	VectorRegister4f Max = VectorLoad(BuildPrimitives[Start].Max);
 	for (uint32 i = 1; i < Count; i++)
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		const FBuildPrimitive& Primitive = BuildPrimitives[Start + i];
+		Min = VectorMin(Min, VectorLoad(Primitive.Min));
+		Max = VectorMax(Max, VectorLoad(Primitive.Max));
 	}
-	return Bounds;
+	return ToBounds(Min, Max);
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+// BVH 트리 -> 재귀 구축 (binned SAH)
+// 삼각형 중심의 범위를 축마다 NumBins개 구간으로 나눠, 구간 경계 중 SAH 비용이 가장 낮은 곳에서 자른다.
+int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, TArray<FMeshBVHNode>& OutBinaryNodes)
 {
 	FMeshBVHNode Node;
 	Node.Start = Start;
 	Node.Count = Count;
+	Node.Bounds = ComputeBounds(Start, Count);
 
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
-
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
+	int NodeIndex = OutBinaryNodes.Num();
+	OutBinaryNodes.Add(Node);
 
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
+	if (Count <= 1)
 	{
 		return NodeIndex;
 	}
 
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
+	// 삼각형 중심들의 범위
+	FVector CenterMin = BuildPrimitives[Start].Center;
+	FVector CenterMax = CenterMin;
+	for (uint32 i = 1; i < Count; ++i)
+	{
+		const FVector& Center = BuildPrimitives[Start + i].Center;
+		GrowMinMax(CenterMin, CenterMax, Center, Center);
+	}
 
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
+	struct FBin
+	{
+		VectorRegister4f Min, Max;
+		uint32 Count;
+	};
 
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
+	float BestCost = FLT_MAX;
+	int32 BestAxis = -1;
+	int32 BestSplit = 0; // 구간 [0, BestSplit)이 왼쪽
+	float BinScale[3] = { 0.0f, 0.0f, 0.0f };
+	bool bAxisValid[3] = { false, false, false };
+	// 아래쪽 작은 노드가 대부분이라 구간 수를 삼각형 수에 맞춰 줄인다
+	const int32 BinCount = std::min(NumBins, std::max(4, static_cast<int32>(Count)));
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Extent = CenterMax[Axis] - CenterMin[Axis];
+		bAxisValid[Axis] = Extent > 1e-12f;
+		BinScale[Axis] = bAxisValid[Axis] ? BinCount / Extent : 0.0f;
+	}
+	if (!bAxisValid[0] && !bAxisValid[1] && !bAxisValid[2] && Count <= MaxLeafSize)
+	{
+		return NodeIndex;
+	}
 
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
+	// 세 축의 구간을 삼각형 한 번 훑으면서 같이 채운다
+	// 빈 범위 (어떤 범위와 합쳐도 그 범위가 됨)
+	const VectorRegister4f EmptyMin = VectorSetFloat1(FLT_MAX);
+	const VectorRegister4f EmptyMax = VectorSetFloat1(-FLT_MAX);
+	FBin Bins[3][NumBins];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		for (int32 BinIdx = 0; BinIdx < BinCount; ++BinIdx)
 		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
+			Bins[Axis][BinIdx].Min = EmptyMin;
+			Bins[Axis][BinIdx].Max = EmptyMax;
+			Bins[Axis][BinIdx].Count = 0;
+		}
+	}
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		const FBuildPrimitive& Primitive = BuildPrimitives[Start + i];
+		const VectorRegister4f PrimitiveMin = VectorLoad(Primitive.Min);
+		const VectorRegister4f PrimitiveMax = VectorLoad(Primitive.Max);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			FBin& Bin = Bins[Axis][std::min(BinCount - 1, static_cast<int32>((Primitive.Center[Axis] - CenterMin[Axis]) * BinScale[Axis]))];
+			Bin.Min = VectorMin(Bin.Min, PrimitiveMin);
+			Bin.Max = VectorMax(Bin.Max, PrimitiveMax);
+			++Bin.Count;
+		}
+	}
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (!bAxisValid[Axis])
+			continue;
+
+		// 오른쪽부터 누적한 면적/개수를 저장해 두고 왼쪽에서 쓸어 가며 비용 계산
+		float RightArea[NumBins];
+		uint32 RightCount[NumBins];
+		VectorRegister4f AccumMin = EmptyMin;
+		VectorRegister4f AccumMax = EmptyMax;
+		uint32 AccumCount = 0;
+		for (int32 BinIdx = BinCount - 1; BinIdx > 0; --BinIdx)
+		{
+			AccumMin = VectorMin(AccumMin, Bins[Axis][BinIdx].Min);
+			AccumMax = VectorMax(AccumMax, Bins[Axis][BinIdx].Max);
+			AccumCount += Bins[Axis][BinIdx].Count;
+			RightArea[BinIdx] = AccumCount > 0 ? GetSurfaceArea(AccumMin, AccumMax) : 0.0f;
+			RightCount[BinIdx] = AccumCount;
+		}
 
-			switch (Axis)
+		AccumMin = EmptyMin;
+		AccumMax = EmptyMax;
+		AccumCount = 0;
+		for (int32 Split = 1; Split < BinCount; ++Split)
+		{
+			AccumMin = VectorMin(AccumMin, Bins[Axis][Split - 1].Min);
+			AccumMax = VectorMax(AccumMax, Bins[Axis][Split - 1].Max);
+			AccumCount += Bins[Axis][Split - 1].Count;
+			if (AccumCount == 0 || RightCount[Split] == 0)
+				continue;
+
+			const float Cost = GetSurfaceArea(AccumMin, AccumMax) * AccumCount + RightArea[Split] * RightCount[Split];
+			if (Cost < BestCost)
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				BestCost = Cost;
+				BestAxis = Axis;
+				BestSplit = Split;
 			}
-		});
+		}
+	}
+
+	uint32 Mid = Start + Count / 2;
+	if (BestAxis < 0)
+	{
+		// 중심이 전부 한 점에 모임: 작으면 리프, 크면 개수로 반 나눔
+		if (Count <= MaxLeafSize)
+		{
+			return NodeIndex;
+		}
+	}
+	else
+	{
+		// 비용은 모두 노드 표면적을 곱한 값 (SAH: Ct + (AL*NL + AR*NR) / A  vs  N)
+		const float NodeArea = GetSurfaceArea(Node.Bounds.Min, Node.Bounds.Max);
+		const float SplitCost = TraversalCost * NodeArea + BestCost;
+		const float LeafCost = static_cast<float>(Count) * NodeArea;
+		if (Count <= MaxLeafSize && LeafCost <= SplitCost)
+		{
+			return NodeIndex;
+		}
+
+		const float MinCenter = CenterMin[BestAxis];
+		const float Scale = BinScale[BestAxis];
+		auto Pivot = std::partition(BuildPrimitives.begin() + Start, BuildPrimitives.begin() + Start + Count,
+			[&](const FBuildPrimitive& Primitive)
+			{
+				const int32 BinIdx = std::min(BinCount - 1, static_cast<int32>((Primitive.Center[BestAxis] - MinCenter) * Scale));
+				return BinIdx < BestSplit;
+			});
+		Mid = static_cast<uint32>(Pivot - BuildPrimitives.begin());
+	}
 
-	// -------------------------------
 	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+	OutBinaryNodes[NodeIndex].Count = 0;
+	const int Left = BuildRecursive(Start, Mid - Start, OutBinaryNodes);
+	const int Right = BuildRecursive(Mid, Start + Count - Mid, OutBinaryNodes);
+	OutBinaryNodes[NodeIndex].Left = Left;
+	OutBinaryNodes[NodeIndex].Right = Right;
+
+	return NodeIndex;
+}
+
+// 이진 노드를 표면적이 큰 내부 자식부터 펼쳐 자식 최대 4개짜리 노드로 만든다
+int32 FMeshBVH::CollapseNode(const TArray<FMeshBVHNode>& BinaryNodes, int32 BinaryIdx)
+{
+	int32 ChildBinary[4];
+	int32 NumChildren = 0;
+
+	const FMeshBVHNode& Root = BinaryNodes[BinaryIdx];
+	if (Root.IsLeaf())
+	{
+		ChildBinary[NumChildren++] = BinaryIdx;
+	}
+	else
+	{
+		ChildBinary[NumChildren++] = Root.Left;
+		ChildBinary[NumChildren++] = Root.Right;
+	}
+
+	while (NumChildren < 4)
+	{
+		int32 OpenSlot = -1;
+		float LargestArea = -1.0f;
+		for (int32 Slot = 0; Slot < NumChildren; ++Slot)
+		{
+			const FMeshBVHNode& Child = BinaryNodes[ChildBinary[Slot]];
+			if (Child.IsLeaf())
+				continue;
+			const float Area = GetSurfaceArea(Child.Bounds.Min, Child.Bounds.Max);
+			if (Area > LargestArea)
+			{
+				LargestArea = Area;
+				OpenSlot = Slot;
+			}
+		}
+		if (OpenSlot < 0)
+			break;
+
+		const FMeshBVHNode& Opened = BinaryNodes[ChildBinary[OpenSlot]];
+		ChildBinary[OpenSlot] = Opened.Left;
+		ChildBinary[NumChildren++] = Opened.Right;
+	}
+
+	const int32 NodeIndex = Nodes.Num();
+	FMeshBVHNode4 Node4;
+	for (int32 Slot = 0; Slot < 4; ++Slot)
+	{
+		Node4.MinX[Slot] = Node4.MinY[Slot] = Node4.MinZ[Slot] = std::numeric_limits<float>::infinity();
+		Node4.MaxX[Slot] = Node4.MaxY[Slot] = Node4.MaxZ[Slot] = -std::numeric_limits<float>::infinity();
+		Node4.Child[Slot] = 0;
+		Node4.Count[Slot] = 0;
+	}
+	Nodes.Add(Node4);
+
+	for (int32 Slot = 0; Slot < NumChildren; ++Slot)
+	{
+		const FMeshBVHNode& Child = BinaryNodes[ChildBinary[Slot]];
+		int32 ChildIndex = 0;
+		int32 ChildCount = 0;
+		if (Child.IsLeaf())
+		{
+			ChildIndex = static_cast<int32>(Child.Start);
+			ChildCount = static_cast<int32>(Child.Count);
+		}
+		else
+		{
+			ChildIndex = CollapseNode(BinaryNodes, ChildBinary[Slot]);
+		}
+
+		FMeshBVHNode4& Target = Nodes[NodeIndex];
+		Target.MinX[Slot] = Child.Bounds.Min.X;
+		Target.MinY[Slot] = Child.Bounds.Min.Y;
+		Target.MinZ[Slot] = Child.Bounds.Min.Z;
+		Target.MaxX[Slot] = Child.Bounds.Max.X;
+		Target.MaxY[Slot] = Child.Bounds.Max.Y;
+		Target.MaxZ[Slot] = Child.Bounds.Max.Z;
+		Target.Child[Slot] = ChildIndex;
+		Target.Count[Slot] = ChildCount;
+	}
 
 	return NodeIndex;
 }
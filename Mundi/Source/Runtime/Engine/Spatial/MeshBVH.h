@@ -1,47 +1,99 @@
 ﻿#pragma once
 #include "AABB.h"
 
+// 구축용 이진 노드 (Build가 끝나면 FMeshBVHNode4로 접힌다)
 struct FMeshBVHNode
 {
 	FAABB Bounds;     // 이 노드가 감싸는 AABB
 	int Left = -1;     // 왼쪽 자식 인덱스
 	int Right = -1;    // 오른쪽 자식 인덱스
 	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수
 
 	bool IsLeaf() const { return Count > 0; }
 };
 
-struct FStackItem
+// 자식 4개를 한 번에 검사하는 노드. 자식 AABB는 축별 SoA로 저장해 레지스터 하나에 바로 올린다
+struct alignas(16) FMeshBVHNode4
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float MinX[4], MinY[4], MinZ[4];
+	float MaxX[4], MaxY[4], MaxZ[4];	// 빈 슬롯은 Min=+inf, Max=-inf 라서 어떤 레이와도 맞지 않는다
+	int32 Child[4];						// 내부 노드면 Nodes 인덱스, 리프면 Triangles 시작 위치
+	int32 Count[4];						// 리프 삼각형 개수 (0이면 내부 노드)
 };
+
+// 리프 순서로 재배치한 삼각형 정점 (트래버설 중 인덱스 버퍼를 거치지 않기 위함)
+struct FMeshBVHTriangle
+{
+	FVector V0, V1, V2;
+};
+
+// 메시 로컬 공간 교차 결과
+struct FMeshBVHHit
+{
+	float Distance = 0.0f;		// InLocalRay.Direction 길이 기준 t
+	int32 TriangleIndex = -1;	// Build에 넘긴 인덱스 버퍼 기준 삼각형 번호 (Indices[3 * TriangleIndex]부터 3개)
+	float U = 0.0f;				// 무게중심 좌표: V1 가중치
+	float V = 0.0f;				// 무게중심 좌표: V2 가중치 (V0 가중치는 1 - U - V)
+	FVector Normal;				// 레이를 마주보는 면 노멀 (단위 벡터)
+};
+
+/**
+ * @brief 스태틱 메시 삼각형용 BVH (피킹)
+ * binned SAH로 이진 트리를 지은 뒤 4-wide BVH로 접는다.
+ * 트래버설은 레이 하나로 자식 AABB 4개를 레지스터 연산 한 번에 검사하고, 삼각형은 watertight 방식으로 검사한다.
+ */
 class FMeshBVH
 {
 public:
 
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 가장 가까운 교차 거리 (InLocalRay.Direction 길이 기준 t)
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
+	// 가장 가까운 교차 (삼각형 번호/무게중심/노멀 포함). MaxDistance 이상 떨어진 교차는 무시
+	bool IntersectRay(const FRay& InLocalRay, FMeshBVHHit& OutHit, float MaxDistance = std::numeric_limits<float>::infinity()) const;
+	// MaxDistance 안에 교차가 하나라도 있는지. 처음 맞은 삼각형에서 멈춘다 (시야/가림 검사용)
+	bool IntersectRayAny(const FRay& InLocalRay, float MaxDistance = std::numeric_limits<float>::infinity()) const;
+	// MaxDistance 안의 모든 교차를 가까운 순서로 OutHits 뒤에 붙이고 붙인 개수를 돌려준다
+	int32 IntersectRayAll(const FRay& InLocalRay, TArray<FMeshBVHHit>& OutHits, float MaxDistance = std::numeric_limits<float>::infinity()) const;
 
+	// Debug/Stats
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	int32 GetNumTriangles() const { return Triangles.Num(); }
 
 private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 이진 트리 구축 (binned SAH)
+	int BuildRecursive(uint32 Start, uint32 Count, TArray<FMeshBVHNode>& OutBinaryNodes);
+	FAABB ComputeBounds(uint32 Start, uint32 Count) const;
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 이진 트리 -> 4-wide 트리
+	int32 CollapseNode(const TArray<FMeshBVHNode>& BinaryNodes, int32 BinaryIdx);
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	// 질의 공통 트래버설. 교차마다 OnHit(리프 순서 삼각형 위치, t, u, v)를 부르고, true를 돌려주면 즉시 끝낸다.
+	// OnHit이 InOutMaxT를 줄이면 그보다 먼 노드/삼각형은 건너뛴다
+	template<typename HitFunc>
+	void TraverseRay(const FRay& InLocalRay, float& InOutMaxT, HitFunc OnHit) const;
+	FMeshBVHHit MakeHit(const FRay& InLocalRay, int32 LeafTriIdx, float T, float U, float V) const;
 
 private:
 
-	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
+	TArray<FMeshBVHNode4> Nodes;
+	TArray<FMeshBVHTriangle> Triangles;
+	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다.
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
 
+	// 구축 중에만 쓰는 삼각형별 AABB/중심. 인덱스 대신 이 배열 자체를 분할해 메모리를 순서대로 읽는다
+	struct FBuildPrimitive
+	{
+		float Min[4];		// W 성분은 쓰지 않음 (레지스터 한 번에 올리기 위한 자리)
+		float Max[4];
+		FVector Center;
+		uint32 TriangleID;
+	};
+	TArray<FBuildPrimitive> BuildPrimitives;
+
+	static constexpr uint32 MaxLeafSize = 8;
+	static constexpr int32 NumBins = 16;
+};
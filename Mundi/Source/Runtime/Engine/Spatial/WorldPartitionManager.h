@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "Object.h"
 #include "Vector.h"
+#include "FlatHashMap.h"
+#include <mutex>
 
 class UPrimitiveComponent;
 class AStaticMeshActor;
@@ -8,11 +10,22 @@ class UStaticMeshComponent;
 
 class FOctree;
 class FBVHierarchy;
+class FDynamicSpatialHash;
 
 struct FRay;
+struct FHitResult;
 struct FAABB;
 struct FFrustum;
+struct FOBB;
+struct FBoundingSphere;
 
+/**
+ * 브로드 페이즈는 두 구조로 나뉜다.
+ * - 정적: FBVHierarchy. 새로 등록된 컴포넌트는 틱 budget만큼씩 들어가고, 가끔 움직이면 refit으로 갱신한다.
+ * - 이동: FDynamicSpatialHash. 연속 PromoteMoveFrames 프레임 움직인 컴포넌트를 BVH에서 빼서 옮기고,
+ *   이후 이동은 budget 없이 매 프레임 O(1)로 갱신한다. DemoteIdleSeconds 동안 멈춰 있으면 BVH로 되돌린다.
+ * 질의는 두 구조의 결과를 합친다 (컴포넌트는 항상 둘 중 한 곳에만 있음).
+ */
 class UWorldPartitionManager : public UObject
 {
 public:
@@ -37,12 +50,27 @@ public:
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
+	// 컴포넌트 단위 레이 질의 (삼각형/무게중심/노멀/섹션 포함). MaxDistance 이상 떨어진 교차는 무시
+	bool RayQueryClosest(const FRay& InRay, OUT FHitResult& OutHit, float MaxDistance = std::numeric_limits<float>::infinity()) const;
+	// 시야/가림 검사용: 교차가 하나라도 있으면 바로 true (가장 가까운 교차를 찾지 않음)
+	bool RayQueryAny(const FRay& InRay, float MaxDistance = std::numeric_limits<float>::infinity()) const;
+	// 모든 교차를 가까운 순서로 OutHits에 채운다
+	void RayQueryAll(const FRay& InRay, OUT TArray<FHitResult>& OutHits, float MaxDistance = std::numeric_limits<float>::infinity()) const;
 	void FrustumQuery(FFrustum InFrustum);
+	TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
+	TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
+	TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
 	/** BVH 게터 */
 	FBVHierarchy* GetBVH() const { return BVH; }
+	/** 이동 컴포넌트 해시 게터 */
+	FDynamicSpatialHash* GetDynamicHash() const { return DynamicHash; }
+
+	// Debug/Stats
+	uint32 GetNumPromotions() const { return NumPromotions; }
+	uint32 GetNumDemotions() const { return NumDemotions; }
 
 private:
 
@@ -53,9 +81,35 @@ private:
 	//재시작시 필요 
 	void ClearSceneOctree();
 	void ClearBVHierarchy();
+
+	// 이동 컴포넌트 처리 (budget 없음)
+	void UpdateMovedComponents();
+	void DemoteIdleComponents();
+
+	// 이미 브로드 페이즈에 들어간 컴포넌트의 배치 상태
+	struct FPlacement
+	{
+		bool bDynamic = false;      // true면 DynamicHash, false면 BVH
+		uint32 LastMoveFrame = 0;
+		uint32 MoveStreak = 0;      // 연속으로 움직인 프레임 수
+	};
+
+	// 연속으로 이만큼 움직이면 이동 컴포넌트로 승격
+	static constexpr uint32 PromoteMoveFrames = 3;
+	// 이동 컴포넌트가 이만큼 멈춰 있으면 BVH로 복귀 (잠깐 멈췄다 다시 움직이는 컴포넌트가 오가지 않도록 넉넉하게)
+	static constexpr double DemoteIdleSeconds = 5.0;
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
-	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> MovedComponentSet;     // 이미 배치된 컴포넌트 중 이번 프레임에 움직인 것
+	TFlatMap<UPrimitiveComponent*, FPlacement> Placements;
+	std::mutex DirtyLock;                             // 병렬 틱(워커 스레드)에서 MarkDirty 동시 호출 보호
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	FDynamicSpatialHash* DynamicHash = nullptr;
+
+	uint32 FrameNumber = 0;
+	double ElapsedTime = 0.0;
+	uint32 NumPromotions = 0;
+	uint32 NumDemotions = 0;
 };
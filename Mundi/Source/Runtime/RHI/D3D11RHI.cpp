@@ -20,6 +20,14 @@ void D3D11RHI::Initialize(HWND hWindow)
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+void D3D11RHI::InitializeNull()
+{
+    // GPU가 없는 빌드 머신용: Device/DeviceContext는 nullptr로 남겨두고
+    // 리소스 매니저에는 CPU 데이터만 로드하도록 알린다
+    bNullDevice = true;
+    UResourceManager::GetInstance().Initialize(nullptr, nullptr);
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
@@ -29,6 +37,12 @@ void D3D11RHI::Release()
     // Direct2D 오버레이를 먼저 정리하여 D3D 리소스에 대한 참조를 제거
     UStatsOverlayD2D::Get().Shutdown();
 
+    // Null 디바이스는 생성한 D3D 객체가 없으므로 해제할 것도 없음
+    if (bNullDevice)
+    {
+        return;
+    }
+
     if (DeviceContext)
     {
         // 파이프라인에서 바인딩된 상태/리소스를 명시적으로 해제
@@ -71,9 +71,14 @@ public:
 
 public:
 	void Initialize(HWND hWindow);
+	// 헤드리스 모드: 디바이스/스왑체인 없이 리소스 매니저만 CPU 데이터 전용으로 초기화
+	void InitializeNull();
 
 	void Release();
 
+	// 헤드리스(Null 디바이스) 모드 여부
+	bool IsNullDevice() const { return bNullDevice; }
+
 
 public:
 	// clear
@@ -312,6 +317,7 @@ private:
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
 	bool bReleased = false; // Prevent double Release() calls
+	bool bNullDevice = false; // InitializeNull()로 초기화된 경우 GPU 리소스가 하나도 없음
 };
 
 
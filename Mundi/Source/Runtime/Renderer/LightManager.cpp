@@ -535,7 +535,7 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 }
 
 // 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+void FLightManager::AllocateAtlasRegions2D(TFrameArray<FShadowRenderRequest>& InOutRequests2D)
 {
 	// 요청 정렬 (가장 큰 것부터)
 	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
@@ -575,7 +575,7 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 	}
 }
 
-void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
+void FLightManager::AllocateAtlasCubeSlices(TFrameArray<FShadowRenderRequest>& InOutRequestsCube)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
 	if (CubeArrayCount == 0)
@@ -89,6 +89,11 @@ void URenderer::EndFrame()
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// 틱 밖(에디터 조작 등)에서 바뀐 트랜스폼과 미뤄진 자식 알림을 렌더 전에 마무리합니다.
+	USceneComponent::FlushPendingTransformUpdates();
+
+	FScopedMemoryTag MemoryTag(EMemoryTag::Rendering);
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
 
@@ -248,10 +253,17 @@ void URenderer::AddLines(const TArray<FVector>& StartPoints, const TArray<FVecto
 	if (StartPoints.size() != EndPoints.size() || StartPoints.size() != Colors.size())
 		return;
 
+	AddLines(StartPoints.data(), EndPoints.data(), Colors.data(), static_cast<int32>(StartPoints.size()));
+}
+
+void URenderer::AddLines(const FVector* StartPoints, const FVector* EndPoints, const FVector4* Colors, int32 LineCount)
+{
+	if (!bLineBatchActive || !LineBatchData || LineCount <= 0) return;
+
 	uint32 startIndex = static_cast<uint32>(LineBatchData->Vertices.size());
 
 	// Reserve space for efficiency
-	size_t lineCount = StartPoints.size();
+	size_t lineCount = static_cast<size_t>(LineCount);
 	LineBatchData->Vertices.reserve(LineBatchData->Vertices.size() + lineCount * 2);
 	LineBatchData->Color.reserve(LineBatchData->Color.size() + lineCount * 2);
 	LineBatchData->Indices.reserve(LineBatchData->Indices.size() + lineCount * 2);
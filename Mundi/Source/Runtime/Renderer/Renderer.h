@@ -41,6 +41,7 @@ public:
 	void AddLines(const TArray<FVector>& Lines, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLinesRange(const TArray<FVector>& Lines,int startIdx, int Count, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
 	void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors);
+	void AddLines(const FVector* StartPoints, const FVector* EndPoints, const FVector4* Colors, int32 LineCount);
 	void EndLineBatch(const FMatrix& ModelMatrix);
 	void EndLineBatchAlwaysOnTop(const FMatrix& ModelMatrix);
 	void ClearLineBatch();
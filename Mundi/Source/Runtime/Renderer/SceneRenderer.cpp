@@ -250,7 +250,7 @@ void FSceneRenderer::RenderShadowMaps()
 	GPU_EVENT_TIMER(RHIDevice->GetDeviceContext(), "ShadowMaps", OwnerRenderer->GetGPUTimer());
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TFrameArray<FMeshBatchElement> ShadowMeshBatches;
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
@@ -293,8 +293,8 @@ void FSceneRenderer::RenderShadowMaps()
 	);
 
 	// 1.2. 2D 섀도우 요청 수집
-	TArray<FShadowRenderRequest> Requests2D;
-	TArray<FShadowRenderRequest> RequestsCube;
+	TFrameArray<FShadowRenderRequest> Requests2D;
+	TFrameArray<FShadowRenderRequest> RequestsCube;
 	for (UDirectionalLightComponent* Light : LightManager->GetDirectionalLightList())
 	{
 		Light->GetShadowRenderRequests(View, Requests2D);
@@ -465,7 +465,7 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -955,10 +955,6 @@ void FSceneRenderer::RenderDecalPass()
 	if (!Partition)
 		return;
 
-	const FBVHierarchy* BVH = Partition->GetBVH();
-	if (!BVH)
-		return;
-
 	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
 	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
 
@@ -987,11 +983,11 @@ void FSceneRenderer::RenderDecalPass()
 		}
 
 		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		TFrameArray<UPrimitiveComponent*> TargetPrimitives;
 
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
+		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리 (정적 BVH + 이동 컴포넌트 해시)
 		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = Partition->QueryIntersectedComponents(DecalOBB);
 
 		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
@@ -1333,7 +1329,7 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
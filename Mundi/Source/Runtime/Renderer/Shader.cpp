@@ -112,7 +112,12 @@ FString UShader::GenerateMacrosToString(const TArray<FShaderMacro>& InMacros)
  */
 void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros)
 {
-	assert(InDevice);
+	// 헤드리스 모드: 경로만 기억하고 컴파일은 하지 않는다
+	if (!InDevice)
+	{
+		FilePath = InShaderPath;
+		return;
+	}
 
 	// 1. 최초 로드 시에만 파일 경로 및 타임스탬프 처리
 	if (FilePath.empty())
@@ -149,6 +154,10 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros)
 {
 	ID3D11Device* InDevice = GEngine.GetRHIDevice()->GetDevice();
+	if (!InDevice)
+	{
+		return nullptr; // 헤드리스 모드
+	}
 
 	// 이 UShader 객체가 어떤 파일인지 알아야 컴파일 가능
 	if (FilePath.empty())
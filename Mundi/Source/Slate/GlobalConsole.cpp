@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
@@ -46,6 +47,10 @@ void UGlobalConsole::Log(const char* fmt, ...)
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
 #ifdef _EDITOR
+    // 병렬 틱(애니메이션 등)에서도 로그를 남기므로 콘솔 항목 추가를 직렬화
+    static std::recursive_mutex LogLock;
+    std::lock_guard<std::recursive_mutex> Lock(LogLock);
+
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
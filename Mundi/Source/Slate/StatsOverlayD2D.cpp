@@ -6,8 +6,15 @@
 #include "StatsOverlayD2D.h"
 #include "UIManager.h"
 #include "MemoryManager.h"
+#include "FrameArena.h"
+#include "ObjectPool.h"
 #include "Picking.h"
 #include "PlatformTime.h"
+#include "JobSystem.h"
+#include "TickTaskManager.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "DynamicSpatialHash.h"
 #include "DecalStatManager.h"
 #include "GPUProfiler.h"
 #include "TileCullingStats.h"
@@ -169,7 +176,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowGPU && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowGPU && !bShowSkinning && !bShowJobs && !bShowBVH) || !SwapChain)
 	{
 		return;
 	}
@@ -241,15 +248,25 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
-
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
-
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
+
+		// 오브젝트 풀 점유율 = 살아있는 객체 슬롯 / 확보한 슬랩
+		const FObjectPool::FStats PoolStats = FObjectPool::GetStats();
+		const double PoolOccupancy = (PoolStats.ReservedBytes > 0)
+			? 100.0 * static_cast<double>(PoolStats.UsedBytes) / static_cast<double>(PoolStats.ReservedBytes) : 0.0;
+
+		wchar_t Buf[320];
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu\nHeap Allocs/Frame: %llu\nFrame Arena: %.1f KB (Peak %.1f KB)\nObject Pool: %.1f / %.1f MB (%.0f%%, %u objs)",
+			Mb, static_cast<unsigned long long>(FMemoryManager::GetTotalAllocationCount()),
+			static_cast<unsigned long long>(FMemoryManager::GetLastFrameHeapAllocations()),
+			FFrameArena::GetLastFrameBytes() / 1024.0, FFrameArena::GetHighWaterMark() / 1024.0,
+			PoolStats.UsedBytes / (1024.0 * 1024.0), PoolStats.ReservedBytes / (1024.0 * 1024.0), PoolOccupancy, PoolStats.NumLive);
+
+		const float MemoryPanelHeight = 112.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -388,7 +405,7 @@ void UStatsOverlayD2D::Draw()
 	{
 		const ESkinningMode SkinningMode = GWorld->GetRenderSettings().GetSkinningMode();
 
-		const FTimeProfile& CpuProfile = FScopeCycleCounter::GetTimeProfile("SKINNING_CPU_TASK");
+		const FTimeProfile CpuProfile = FScopeCycleCounter::GetTimeProfile("SKINNING_CPU_TASK");
 		double CpuSkinningTime = CpuProfile.Milliseconds;
 
 		double GpuSkinningTime = GPUTimer->GetTime("SKINNING_GPU_TASK");
@@ -418,6 +435,95 @@ void UStatsOverlayD2D::Draw()
 		NextY += SkinningPanelHeight + Space;
 	}
 
+	if (bShowJobs)
+	{
+		const FJobSystem& JobSystem = FJobSystem::Get();
+		const TArray<FJobWorkerStats>& WorkerStats = JobSystem.GetLastFrameStats();
+		const double FrameMs = UUIManager::GetInstance().GetDeltaTime() * 1000.0;
+
+		wchar_t Buf[2048];
+		int32 Len = swprintf_s(Buf, L"[Job System]\nWorkers: %u", JobSystem.GetNumWorkers());
+
+		// 워커별 바쁜 시간 / 프레임 시간 = 사용률 (마지막 슬롯은 게임 스레드가 도운 몫)
+		const int32 NumSlots = JobSystem.IsInitialized() ? WorkerStats.Num() : 0;
+		for (int32 Slot = 0; Slot < NumSlots && Len > 0 && Len < 1900; ++Slot)
+		{
+			const FJobWorkerStats& Stat = WorkerStats[Slot];
+			const double Utilization = FrameMs > 0.0 ? (Stat.BusyMs / FrameMs) * 100.0 : 0.0;
+
+			wchar_t Label[16];
+			if (Slot == NumSlots - 1)
+			{
+				swprintf_s(Label, L"Main");
+			}
+			else
+			{
+				swprintf_s(Label, L"W%02d", Slot);
+			}
+
+			Len += swprintf_s(Buf + Len, _countof(Buf) - Len, L"\n  %s: %.2f ms (%.0f%%) Jobs %u Steal %u",
+				Label, Stat.BusyMs, Utilization, Stat.JobCount, Stat.StealCount);
+		}
+
+		// 월드 틱 목록: 등록 액터 중 실제 틱 노드만 순회
+		float TickLines = 0.0f;
+		if (GWorld && GWorld->GetTickTaskManager() && Len > 0 && Len < 1900)
+		{
+			const FTickStats& TickStats = GWorld->GetTickTaskManager()->GetStats();
+			Len += swprintf_s(Buf + Len, _countof(Buf) - Len, L"\nTicks: %u / %u actors%s\n  Parallel %u  Game %u  Edges %u  Cycles %u",
+				TickStats.NumTickFunctions, TickStats.NumRegisteredActors, TickStats.bTickListRebuilt ? L" (rebuilt)" : L"",
+				TickStats.NumParallelTicks, TickStats.NumGameThreadTicks, TickStats.NumPrerequisiteEdges, TickStats.NumCycleBreaks);
+
+			// 중요도 빈도 조절: 건너뛴 틱 / 예산 때문에 미룬 틱
+			const FSignificanceManager& Significance = GWorld->GetTickTaskManager()->GetSignificanceManager();
+			Len += swprintf_s(Buf + Len, _countof(Buf) - Len, L"\n  Throttle %u  Skip %u  Defer %u  %.2f/%.2f ms x%.2f",
+				TickStats.NumThrottleCandidates, TickStats.NumIntervalSkips, TickStats.NumBudgetDeferrals,
+				Significance.GetLastTickMs(), Significance.GetSettings().TickBudgetMs, Significance.GetBudgetScale());
+			TickLines = 3.0f;
+		}
+
+		const float JobPanelHeight = 40.0f + 18.0f * (static_cast<float>(NumSlots) + TickLines);
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 60.0f, NextY + JobPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+
+		NextY += JobPanelHeight + Space;
+	}
+
+	if (bShowBVH && GWorld && GWorld->GetPartitionManager() && GWorld->GetPartitionManager()->GetBVH())
+	{
+		const UWorldPartitionManager* Partition = GWorld->GetPartitionManager();
+		const FBVHierarchy* BVH = Partition->GetBVH();
+		const FDynamicSpatialHash* DynamicHash = Partition->GetDynamicHash();
+		const FBVHierarchy::FStats& BVHStats = BVH->GetStats();
+
+		const wchar_t* LastUpdate = L"Idle";
+		switch (BVHStats.LastUpdate)
+		{
+		case FBVHierarchy::EUpdateType::Refit:          LastUpdate = L"Refit"; break;
+		case FBVHierarchy::EUpdateType::PartialRebuild: LastUpdate = L"Partial Rebuild"; break;
+		case FBVHierarchy::EUpdateType::FullRebuild:    LastUpdate = L"Full Rebuild"; break;
+		default: break;
+		}
+
+		// SAH 비용이 구축 직후 대비 얼마나 나빠졌는지 (1.5배를 넘으면 전체 재구축)
+		const float CostRatio = BVHStats.BuildSAHCost > 0.0f ? BVHStats.SAHCost / BVHStats.BuildSAHCost : 1.0f;
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[BVH]\nNodes: %d  Components: %d\nLast: %s (%u leaves, %u nodes)\nRebuilds: %u full / %u partial\nRefits: %u\nSAH: %.1f (build %.1f, x%.2f)\nMovers: %d in %d cells (+%u / -%u)",
+			BVH->TotalNodeCount(), BVH->TotalActorCount(), LastUpdate,
+			BVHStats.LastRefitLeaves, BVHStats.LastRefitNodes,
+			BVHStats.NumFullRebuilds, BVHStats.NumPartialRebuilds, BVHStats.NumRefits,
+			BVHStats.SAHCost, BVHStats.BuildSAHCost, CostRatio,
+			DynamicHash ? DynamicHash->Num() : 0, DynamicHash ? DynamicHash->GetNumCells() : 0,
+			Partition->GetNumPromotions(), Partition->GetNumDemotions());
+
+		const float BVHPanelHeight = 150.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + BVHPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushSkyBlue);
+
+		NextY += BVHPanelHeight + Space;
+	}
+
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
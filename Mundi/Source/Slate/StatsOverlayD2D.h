@@ -22,6 +22,8 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowGPU(bool b) { bShowGPU = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
+    void SetShowJobs(bool b) { bShowJobs = b; }
+    void SetShowBVH(bool b) { bShowBVH = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -31,6 +33,8 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleGPU() { bShowGPU = !bShowGPU; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
+    void ToggleJobs() { bShowJobs = !bShowJobs; }
+    void ToggleBVH() { bShowBVH = !bShowBVH; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -40,6 +44,8 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsGPUVisible() const { return bShowGPU; }
     bool IsSkinningVisible() const { return bShowSkinning; }
+    bool IsJobsVisible() const { return bShowJobs; }
+    bool IsBVHVisible() const { return bShowBVH; }
 
     void SetGPUTimer(FGPUTimer* InGPUTimer) { GPUTimer = InGPUTimer; }
 
@@ -63,6 +69,8 @@ private:
     bool bShowLights = false;
     bool bShowGPU = false;
     bool bShowSkinning = true;
+    bool bShowJobs = false;
+    bool bShowBVH = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
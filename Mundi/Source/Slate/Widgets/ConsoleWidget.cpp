@@ -10,6 +10,10 @@
 #include <cstring>
 #include <algorithm>
 #include "MiniDump.h"
+#include "TickTaskManager.h"
+#include "PlatformTime.h"
+#include "ObjectPool.h"
+#include "EngineBenchmarks.h"
 
 using std::max;
 using std::min;
@@ -54,6 +58,21 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT GPU");
+	HelpCommandList.Add("STAT JOBS");
+	HelpCommandList.Add("STAT BVH");
+	HelpCommandList.Add("TICK");
+	HelpCommandList.Add("TICK BUDGET");
+	HelpCommandList.Add("TICK SIGNIFICANCE ON");
+	HelpCommandList.Add("TICK SIGNIFICANCE OFF");
+	HelpCommandList.Add("BENCH ISA");
+	HelpCommandList.Add("BENCH MAP");
+	HelpCommandList.Add("BENCH MATH");
+	HelpCommandList.Add("BENCH BVH");
+	HelpCommandList.Add("BENCH BVHREFIT");
+	HelpCommandList.Add("BENCH MESHBVH");
+	HelpCommandList.Add("BENCH SCENELOAD");
+	HelpCommandList.Add("MEMORY POOL");
+	HelpCommandList.Add("MEMORY TAGS");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -555,6 +574,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT GPU");
+		AddLog("- STAT JOBS");
+		AddLog("- STAT BVH");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -598,6 +619,16 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleSkinning();
 		AddLog("STAT SKINNING TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT JOBS") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleJobs();
+		AddLog("STAT JOBS TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT BVH") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleBVH();
+		AddLog("STAT BVH TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -609,6 +640,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowGPU(true);
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
+		UStatsOverlayD2D::Get().SetShowJobs(true);
+		UStatsOverlayD2D::Get().SetShowBVH(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -622,8 +655,90 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowGPU(false);
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
+		UStatsOverlayD2D::Get().SetShowJobs(false);
+		UStatsOverlayD2D::Get().SetShowBVH(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "TICK") == 0)
+	{
+		const FSignificanceManager& Significance = GWorld->GetTickTaskManager()->GetSignificanceManager();
+		AddLog("TICK commands:");
+		AddLog("- TICK BUDGET <ms> (0 = off, current %.2f ms, scale x%.2f)", Significance.GetSettings().TickBudgetMs, Significance.GetBudgetScale());
+		AddLog("- TICK SIGNIFICANCE ON/OFF (current %s)", Significance.GetSettings().bEnabled ? "ON" : "OFF");
+	}
+	else if (Strnicmp(command_line, "TICK BUDGET ", 12) == 0)
+	{
+		const float BudgetMs = static_cast<float>(atof(command_line + 12));
+		GWorld->GetTickTaskManager()->GetSignificanceManager().GetSettings().TickBudgetMs = BudgetMs > 0.0f ? BudgetMs : 0.0f;
+		AddLog("TICK BUDGET: %.2f ms", BudgetMs > 0.0f ? BudgetMs : 0.0f);
+	}
+	else if (Stricmp(command_line, "TICK SIGNIFICANCE ON") == 0)
+	{
+		GWorld->GetTickTaskManager()->GetSignificanceManager().GetSettings().bEnabled = true;
+		AddLog("TICK SIGNIFICANCE: ON");
+	}
+	else if (Stricmp(command_line, "TICK SIGNIFICANCE OFF") == 0)
+	{
+		GWorld->GetTickTaskManager()->GetSignificanceManager().GetSettings().bEnabled = false;
+		AddLog("TICK SIGNIFICANCE: OFF");
+	}
+	else if (Stricmp(command_line, "BENCH ISA") == 0)
+	{
+		RunBenchmark("isa");
+	}
+	else if (Stricmp(command_line, "BENCH MAP") == 0)
+	{
+		RunBenchmark("map");
+	}
+	else if (Stricmp(command_line, "BENCH MATH") == 0)
+	{
+		RunBenchmark("math");
+	}
+	else if (Stricmp(command_line, "BENCH BVH") == 0)
+	{
+		RunBenchmark("bvh");
+	}
+	else if (Stricmp(command_line, "BENCH BVHREFIT") == 0)
+	{
+		RunBenchmark("bvhrefit");
+	}
+	else if (Stricmp(command_line, "BENCH SCENELOAD") == 0)
+	{
+		RunBenchmark("sceneload");
+	}
+	else if (Stricmp(command_line, "BENCH MESHBVH") == 0)
+	{
+		RunBenchmark("meshbvh");
+	}
+	else if (Stricmp(command_line, "MEMORY POOL") == 0)
+	{
+		// UObject 크기 등급 풀의 등급별 점유율
+		const FObjectPool::FStats Stats = FObjectPool::GetStats();
+		AddLog("OBJECT POOL: %u objects, %.1f / %.1f KB in %u slabs", Stats.NumLive,
+			Stats.UsedBytes / 1024.0, Stats.ReservedBytes / 1024.0, Stats.NumSlabs);
+
+		TArray<FObjectPool::FSizeClassStats> ClassStats;
+		FObjectPool::GetSizeClassStats(ClassStats);
+		for (const FObjectPool::FSizeClassStats& Class : ClassStats)
+		{
+			AddLog("- %4u B: %u / %u slots (%.0f%%), %u slabs", Class.SlotSize, Class.NumLive, Class.NumSlots,
+				Class.NumSlots > 0 ? 100.0 * Class.NumLive / Class.NumSlots : 0.0, Class.NumSlabs);
+		}
+	}
+	else if (Stricmp(command_line, "MEMORY TAGS") == 0)
+	{
+		// 서브시스템 태그별 현재/최대 사용량
+		AddLog("MEMORY TAGS: %.1f MB in %llu allocs", FMemoryManager::GetTotalAllocationBytes() / (1024.0 * 1024.0),
+			static_cast<unsigned long long>(FMemoryManager::GetTotalAllocationCount()));
+		for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count); ++TagIndex)
+		{
+			const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+			const FMemoryTagStats Stats = FMemoryManager::GetTagStats(Tag);
+			AddLog("- %-10s %9.2f MB (peak %9.2f MB), %llu live / %llu total allocs", FMemoryManager::GetTagName(Tag),
+				Stats.CurrentBytes / (1024.0 * 1024.0), Stats.PeakBytes / (1024.0 * 1024.0),
+				static_cast<unsigned long long>(Stats.CurrentCount), static_cast<unsigned long long>(Stats.TotalAllocations));
+		}
+	}
 	else if (Stricmp(command_line, "SKINNING") == 0)
 	{
 		AddLog("SKINNING CPU");
@@ -646,6 +761,34 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 }
 
 // Static helper methods
+void UConsoleWidget::RunBenchmark(const char* Name)
+{
+	FBenchmarkResult Result;
+	if (!FEngineBenchmarks::Run(Name, Result))
+	{
+		AddLog("[error] Unknown benchmark: %s", Name);
+		return;
+	}
+
+	FString Upper = Result.Name;
+	std::transform(Upper.begin(), Upper.end(), Upper.begin(), [](unsigned char C) { return static_cast<char>(std::toupper(C)); });
+	AddLog("BENCH %s: %s", Upper.c_str(), Result.Description.c_str());
+	for (const FBenchmarkRow& Row : Result.Rows)
+	{
+		const double Speedup = Row.OptimizedMs > 0.0 ? Row.BaselineMs / Row.OptimizedMs : 0.0;
+		if (Result.bHasError)
+		{
+			AddLog("- %s: %s %.3f ms, %s %.3f ms (x%.2f), max error %.2e", Row.Label.c_str(), Result.BaselineLabel.c_str(), Row.BaselineMs,
+				Result.OptimizedLabel.c_str(), Row.OptimizedMs, Speedup, Row.MaxError);
+		}
+		else
+		{
+			AddLog("- %s: %s %.3f ms, %s %.3f ms (x%.2f)", Row.Label.c_str(), Result.BaselineLabel.c_str(), Row.BaselineMs,
+				Result.OptimizedLabel.c_str(), Row.OptimizedMs, Speedup);
+		}
+	}
+}
+
 int UConsoleWidget::Stricmp(const char* s1, const char* s2)
 {
 	int d;
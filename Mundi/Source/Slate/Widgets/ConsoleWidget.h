@@ -59,6 +59,8 @@ private:
 	// Helper methods
 	static int TextEditCallbackStub(ImGuiInputTextCallbackData* data);
 	int TextEditCallback(ImGuiInputTextCallbackData* data);
+	// FEngineBenchmarks로 돌리고 결과를 행마다 로그로 출력 (BENCH MATH 등)
+	void RunBenchmark(const char* Name);
 
 	// String utilities
 	static int Stricmp(const char* s1, const char* s2);
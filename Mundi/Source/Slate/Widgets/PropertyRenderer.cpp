@@ -721,7 +721,7 @@ bool UPropertyRenderer::RenderObjectPtrProperty(const FProperty& Prop, void* Ins
 {
 	// 에셋 타입인지 확인 (UTexture, UAnimSequence 등)
 	// Metadata에 "AssetType" 키가 있으면 범용 에셋 선택 UI 사용
-	if (Prop.Metadata.find(FName("AssetType")) != Prop.Metadata.end())
+	if (Prop.Metadata.find(FNAME_STATIC("AssetType")) != Prop.Metadata.end())
 	{
 		return RenderAssetPtrProperty(Prop, Instance);
 	}
@@ -753,9 +753,9 @@ bool UPropertyRenderer::RenderAssetPtrProperty(const FProperty& Prop, void* Inst
 
 	// Metadata에서 AssetType 가져오기
 	FString AssetTypeName = "";
-	if (Prop.Metadata.find(FName("AssetType")) != Prop.Metadata.end())
+	if (Prop.Metadata.find(FNAME_STATIC("AssetType")) != Prop.Metadata.end())
 	{
-		AssetTypeName = Prop.Metadata.at(FName("AssetType"));
+		AssetTypeName = Prop.Metadata.at(FNAME_STATIC("AssetType"));
 	}
 
 	// 타입별로 캐시된 목록 선택
@@ -934,9 +934,9 @@ bool UPropertyRenderer::RenderStructProperty(const FProperty& Prop, void* Instan
 
 	// Struct 타입 이름 가져오기 (Metadata에서)
 	FString StructTypeName = "";
-	if (Prop.Metadata.find(FName("StructType")) != Prop.Metadata.end())
+	if (Prop.Metadata.find(FNAME_STATIC("StructType")) != Prop.Metadata.end())
 	{
-		StructTypeName = Prop.Metadata.at(FName("StructType"));
+		StructTypeName = Prop.Metadata.at(FNAME_STATIC("StructType"));
 	}
 
 	if (StructTypeName.empty())
@@ -1246,7 +1246,7 @@ bool UPropertyRenderer::RenderScriptFileProperty(const FProperty& Property, void
 		if (ImGui::Button("스크립트 생성"))
 		{
 			// 1. 경로 및 확장자 설정
-			const FString* ExtPtr = Property.Metadata.Find(FName("FileExtension"));
+			const FString* ExtPtr = Property.Metadata.Find(FNAME_STATIC("FileExtension"));
 			FString Extension = (ExtPtr) ? *ExtPtr : ".lua";
 			if (Extension[0] != '.') Extension = "." + Extension;
 
@@ -2346,9 +2346,9 @@ bool UPropertyRenderer::RenderEnumProperty(const FProperty& Prop, void* Instance
 
 	// EnumName 메타데이터 확인
 	FString EnumTypeName = "";
-	if (Prop.Metadata.find(FName("EnumType")) != Prop.Metadata.end())
+	if (Prop.Metadata.find(FNAME_STATIC("EnumType")) != Prop.Metadata.end())
 	{
-		EnumTypeName = Prop.Metadata.at(FName("EnumType"));
+		EnumTypeName = Prop.Metadata.at(FNAME_STATIC("EnumType"));
 	}
 
 	if (EnumTypeName == "EAnimationMode")
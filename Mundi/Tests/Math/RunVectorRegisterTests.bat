@@ -0,0 +1,46 @@
+@echo off
+REM VectorRegister.h 백엔드별(Scalar/SSE/AVX2) 검증 실행 파일을 빌드하고 돌린다
+REM cl.exe가 PATH에 없으면 vswhere로 찾은 Visual Studio의 개발자 환경을 불러온다
+
+setlocal
+
+where cl >nul 2>&1
+if %ERRORLEVEL% NEQ 0 (
+    for /f "usebackq delims=" %%i in (`"%ProgramFiles(x86)%\Microsoft Visual Studio\Installer\vswhere.exe" -latest -products * -requires Microsoft.VisualStudio.Component.VC.Tools.x86.x64 -property installationPath`) do (
+        call "%%i\Common7\Tools\VsDevCmd.bat" -arch=x64 -no_logo
+    )
+)
+where cl >nul 2>&1
+if %ERRORLEVEL% NEQ 0 (
+    echo [VectorRegisterTests] cl.exe not found
+    exit /b 1
+)
+
+set "TEST_DIR=%~dp0"
+set "OUT_DIR=%TEMP%\MundiVectorRegisterTests"
+set "CL_FLAGS=/nologo /std:c++20 /O2 /EHsc /W3 /I"%TEST_DIR%..\..\Source\Runtime\Core\Math""
+set FAILED=0
+
+if not exist "%OUT_DIR%" mkdir "%OUT_DIR%"
+
+call :RunBackend Scalar "/DMUNDI_SIMD_FORCE_SCALAR"
+call :RunBackend SSE ""
+call :RunBackend AVX2 "/arch:AVX2"
+
+if %FAILED% NEQ 0 (
+    echo [VectorRegisterTests] FAILED
+    exit /b 1
+)
+echo [VectorRegisterTests] All backends passed
+exit /b 0
+
+:RunBackend
+cl %CL_FLAGS% %~2 "%TEST_DIR%VectorRegisterTests.cpp" /Fo"%OUT_DIR%\VectorRegisterTests_%~1.obj" /Fe"%OUT_DIR%\VectorRegisterTests_%~1.exe" >nul
+if %ERRORLEVEL% NEQ 0 (
+    echo [VectorRegisterTests] %~1 build failed
+    set FAILED=1
+    exit /b 0
+)
+"%OUT_DIR%\VectorRegisterTests_%~1.exe"
+if %ERRORLEVEL% NEQ 0 set FAILED=1
+exit /b 0
@@ -0,0 +1,685 @@
+/**
+ * @brief VectorRegister.h 백엔드 검증 (엔진과 별도로 빌드하는 독립 실행 파일)
+ * 같은 입력을 double 스칼라 기준 구현과 비교해 허용 오차를 넘으면 실패(종료 코드 1).
+ * 백엔드는 VectorRegister.h와 같은 규칙으로 컴파일 옵션이 고른다. 세 백엔드를 모두 돌리려면
+ * RunVectorRegisterTests.bat (MSVC) 또는 아래 명령을 쓴다.
+ *
+ *   g++ -std=c++20 -O2 -I../../Source/Runtime/Core/Math VectorRegisterTests.cpp -DMUNDI_SIMD_FORCE_SCALAR -o Test_Scalar
+ *   g++ -std=c++20 -O2 -I../../Source/Runtime/Core/Math VectorRegisterTests.cpp -o Test_SSE
+ *   g++ -std=c++20 -O2 -I../../Source/Runtime/Core/Math VectorRegisterTests.cpp -mavx2 -mfma -o Test_AVX2
+ */
+#include "VectorRegister.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#if defined(MUNDI_SIMD_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+	constexpr int NumIterations = 20000;
+
+	// 상대 오차 기준. 상쇄가 일어나는 연산은 참값 대신 항의 크기(Magnitude)로 나눈다
+	constexpr float ExactTolerance = 0.0f;
+	constexpr float ArithmeticTolerance = 1e-6f;
+	constexpr float DotTolerance = 1e-5f;
+	constexpr float MatrixTolerance = 1e-5f;
+	constexpr float InverseTolerance = 1e-4f;
+	constexpr float InverseAffineTolerance = 1e-5f;
+
+	int NumFailures = 0;
+
+	struct FCheck
+	{
+		const char* Name;
+		float Tolerance;
+		double MaxError = 0.0;
+		int NumFailed = 0;
+
+		FCheck(const char* InName, float InTolerance)
+			: Name(InName), Tolerance(InTolerance)
+		{
+		}
+
+		void Compare(float Actual, double Expected, double Magnitude = 1.0)
+		{
+			const double Error = std::fabs(static_cast<double>(Actual) - Expected) / (std::max)({ 1.0, Magnitude, std::fabs(Expected) });
+			MaxError = (std::max)(MaxError, Error);
+			if (!(Error <= Tolerance))
+			{
+				if (NumFailed == 0)
+				{
+					std::printf("  %s: got %.9g, expected %.9g\n", Name, Actual, Expected);
+				}
+				++NumFailed;
+			}
+		}
+
+		void Expect(bool bCondition)
+		{
+			if (!bCondition)
+			{
+				++NumFailed;
+			}
+		}
+
+		~FCheck()
+		{
+			std::printf("%-24s max error %.3e (tolerance %.1e) %s\n", Name, MaxError, Tolerance, NumFailed ? "FAIL" : "ok");
+			if (NumFailed)
+			{
+				++NumFailures;
+			}
+		}
+	};
+
+	std::mt19937 Random(1234);
+
+	float RandomFloat(float Min, float Max)
+	{
+		return std::uniform_real_distribution<float>(Min, Max)(Random);
+	}
+
+	struct FVec4
+	{
+		float V[4];
+	};
+
+	FVec4 RandomVec4(float Range)
+	{
+		return FVec4{ { RandomFloat(-Range, Range), RandomFloat(-Range, Range), RandomFloat(-Range, Range), RandomFloat(-Range, Range) } };
+	}
+
+	VectorRegister4f Load(const FVec4& In)
+	{
+		return VectorLoad(In.V);
+	}
+
+	FVec4 Store(const VectorRegister4f& In)
+	{
+		FVec4 Out;
+		VectorStore(In, Out.V);
+		return Out;
+	}
+
+	void CompareVec4(FCheck& Check, const VectorRegister4f& Actual, const double* Expected, double Magnitude = 1.0)
+	{
+		const FVec4 Out = Store(Actual);
+		for (int i = 0; i < 4; ++i)
+		{
+			Check.Compare(Out.V[i], Expected[i], Magnitude);
+		}
+	}
+
+	// 행 우선 4x4 (행벡터 규약: v * M)
+	struct FMat4
+	{
+		float M[4][4];
+
+		void Load(VectorRegister4f* Rows) const
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				Rows[i] = VectorLoad(M[i]);
+			}
+		}
+	};
+
+	FMat4 RandomMatrix(float Range)
+	{
+		FMat4 Out;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				Out.M[i][j] = RandomFloat(-Range, Range);
+			}
+		}
+		return Out;
+	}
+
+	// 정규화된 쿼터니언 → 회전 행렬 (행벡터 규약), 스케일 후 회전 후 이동
+	FMat4 MakeAffine(const double* Quat, const double* Scale, const double* Translation)
+	{
+		const double X = Quat[0], Y = Quat[1], Z = Quat[2], W = Quat[3];
+		const double R[3][3] = {
+			{ 1 - 2 * (Y * Y + Z * Z), 2 * (X * Y + W * Z), 2 * (X * Z - W * Y) },
+			{ 2 * (X * Y - W * Z), 1 - 2 * (X * X + Z * Z), 2 * (Y * Z + W * X) },
+			{ 2 * (X * Z + W * Y), 2 * (Y * Z - W * X), 1 - 2 * (X * X + Y * Y) },
+		};
+
+		FMat4 Out;
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				Out.M[i][j] = static_cast<float>(R[i][j] * Scale[i]);
+			}
+			Out.M[i][3] = 0.0f;
+			Out.M[3][i] = static_cast<float>(Translation[i]);
+		}
+		Out.M[3][3] = 1.0f;
+		return Out;
+	}
+
+	void RandomUnitQuat(double* Out)
+	{
+		double Length = 0.0;
+		do
+		{
+			Length = 0.0;
+			for (int i = 0; i < 4; ++i)
+			{
+				Out[i] = RandomFloat(-1.0f, 1.0f);
+				Length += Out[i] * Out[i];
+			}
+		} while (Length < 1e-3);
+
+		Length = std::sqrt(Length);
+		for (int i = 0; i < 4; ++i)
+		{
+			Out[i] /= Length;
+		}
+	}
+
+	// 부분 피벗 가우스-조르단 (double)
+	bool ReferenceInverse(const FMat4& In, double Out[4][4])
+	{
+		double A[4][8];
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				A[i][j] = In.M[i][j];
+				A[i][j + 4] = (i == j) ? 1.0 : 0.0;
+			}
+		}
+
+		for (int Col = 0; Col < 4; ++Col)
+		{
+			int Pivot = Col;
+			for (int Row = Col + 1; Row < 4; ++Row)
+			{
+				if (std::fabs(A[Row][Col]) > std::fabs(A[Pivot][Col]))
+				{
+					Pivot = Row;
+				}
+			}
+			if (std::fabs(A[Pivot][Col]) < 1e-12)
+			{
+				return false;
+			}
+			for (int j = 0; j < 8; ++j)
+			{
+				std::swap(A[Col][j], A[Pivot][j]);
+			}
+
+			const double Rcp = 1.0 / A[Col][Col];
+			for (int j = 0; j < 8; ++j)
+			{
+				A[Col][j] *= Rcp;
+			}
+			for (int Row = 0; Row < 4; ++Row)
+			{
+				if (Row != Col)
+				{
+					const double Factor = A[Row][Col];
+					for (int j = 0; j < 8; ++j)
+					{
+						A[Row][j] -= Factor * A[Col][j];
+					}
+				}
+			}
+		}
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				Out[i][j] = A[i][j + 4];
+			}
+		}
+		return true;
+	}
+
+	void TestArithmetic()
+	{
+		FCheck Basic("Add/Sub/Mul/Div", ArithmeticTolerance);
+		FCheck MinMax("Min/Max/Abs/Negate", ExactTolerance);
+		FCheck Sqrt("Sqrt", ArithmeticTolerance);
+		FCheck MulAdd("MultiplyAdd", ArithmeticTolerance);
+		FCheck Mask("MaskLessEqual", ExactTolerance);
+
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			const FVec4 A = RandomVec4(100.0f);
+			FVec4 B = RandomVec4(100.0f);
+			const FVec4 C = RandomVec4(100.0f);
+			if (Iter % 4 == 0)
+			{
+				B.V[Iter % 16 / 4] = A.V[Iter % 16 / 4]; // 같은 값 비교도 포함
+			}
+			const VectorRegister4f RA = Load(A), RB = Load(B), RC = Load(C);
+
+			double Add[4], Sub[4], Mul[4], Div[4], Min[4], Max[4], Abs[4], Neg[4], Root[4], MAdd[4], NMAdd[4], MulMagnitude[4];
+			int ExpectedMask = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				const double X = A.V[i], Y = B.V[i], Z = C.V[i];
+				Add[i] = X + Y;
+				Sub[i] = X - Y;
+				Mul[i] = X * Y;
+				Div[i] = X / Y;
+				Min[i] = (std::min)(A.V[i], B.V[i]);
+				Max[i] = (std::max)(A.V[i], B.V[i]);
+				Abs[i] = std::fabs(X);
+				Neg[i] = -X;
+				Root[i] = std::sqrt(std::fabs(X));
+				MAdd[i] = X * Y + Z;
+				NMAdd[i] = Z - X * Y;
+				MulMagnitude[i] = std::fabs(X * Y) + std::fabs(Z);
+				ExpectedMask |= (A.V[i] <= B.V[i]) ? (1 << i) : 0;
+			}
+
+			CompareVec4(Basic, VectorAdd(RA, RB), Add);
+			CompareVec4(Basic, VectorSubtract(RA, RB), Sub);
+			CompareVec4(Basic, VectorMultiply(RA, RB), Mul);
+			CompareVec4(Basic, VectorDivide(RA, RB), Div);
+			CompareVec4(MinMax, VectorMin(RA, RB), Min);
+			CompareVec4(MinMax, VectorMax(RA, RB), Max);
+			CompareVec4(MinMax, VectorAbs(RA), Abs);
+			CompareVec4(MinMax, VectorNegate(RA), Neg);
+			CompareVec4(Sqrt, VectorSqrt(VectorAbs(RA)), Root);
+			// FMA 유무에 따라 중간 반올림이 달라지므로 항의 크기 기준으로 비교
+			const FVec4 OutMAdd = Store(VectorMultiplyAdd(RA, RB, RC));
+			const FVec4 OutNMAdd = Store(VectorNegateMultiplyAdd(RA, RB, RC));
+			for (int i = 0; i < 4; ++i)
+			{
+				MulAdd.Compare(OutMAdd.V[i], MAdd[i], MulMagnitude[i]);
+				MulAdd.Compare(OutNMAdd.V[i], NMAdd[i], MulMagnitude[i]);
+			}
+			Mask.Expect(VectorMaskLessEqual(RA, RB) == ExpectedMask);
+		}
+	}
+
+	void TestPermutes()
+	{
+		FCheck Check("Swizzle/Shuffle/Transpose", ExactTolerance);
+
+		for (int Iter = 0; Iter < 1000; ++Iter)
+		{
+			const FVec4 A = RandomVec4(10.0f);
+			const FVec4 B = RandomVec4(10.0f);
+			const VectorRegister4f RA = Load(A), RB = Load(B);
+
+			const double Swizzled[4] = { A.V[3], A.V[0], A.V[2], A.V[1] };
+			CompareVec4(Check, VectorSwizzle<3, 0, 2, 1>(RA), Swizzled);
+			const double Shuffled[4] = { A.V[2], A.V[1], B.V[0], B.V[3] };
+			CompareVec4(Check, VectorShuffle<2, 1, 0, 3>(RA, RB), Shuffled);
+			const double Replicated[4] = { A.V[2], A.V[2], A.V[2], A.V[2] };
+			CompareVec4(Check, VectorReplicate<2>(RA), Replicated);
+			Check.Compare(VectorGetComponent<1>(RA), A.V[1]);
+
+			float Float3[3];
+			VectorStoreFloat3(RA, Float3);
+			const double Loaded3[4] = { Float3[0], Float3[1], Float3[2], 0.0 };
+			CompareVec4(Check, VectorLoadFloat3(Float3), Loaded3);
+			for (int i = 0; i < 3; ++i)
+			{
+				Check.Compare(Float3[i], A.V[i]);
+			}
+
+			const FMat4 M = RandomMatrix(10.0f);
+			VectorRegister4f Rows[4];
+			M.Load(Rows);
+			VectorTranspose4x4(Rows[0], Rows[1], Rows[2], Rows[3]);
+			for (int i = 0; i < 4; ++i)
+			{
+				const double Column[4] = { M.M[0][i], M.M[1][i], M.M[2][i], M.M[3][i] };
+				CompareVec4(Check, Rows[i], Column);
+			}
+		}
+	}
+
+	void TestDotCross()
+	{
+		FCheck Dot("Dot3/Dot4", DotTolerance);
+		FCheck Cross("Cross", DotTolerance);
+		FCheck Normalize("NormalizeSafe4", DotTolerance);
+
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			const FVec4 A = RandomVec4(10.0f);
+			const FVec4 B = RandomVec4(10.0f);
+			const VectorRegister4f RA = Load(A), RB = Load(B);
+
+			double Dot3 = 0.0, Dot4 = 0.0;
+			for (int i = 0; i < 4; ++i)
+			{
+				Dot4 += static_cast<double>(A.V[i]) * B.V[i];
+				Dot3 += (i < 3) ? static_cast<double>(A.V[i]) * B.V[i] : 0.0;
+			}
+			// 결과는 모든 성분에 복제, 항의 크기는 |A||B| 정도
+			const double Magnitude = 100.0;
+			const FVec4 OutDot3 = Store(VectorDot3(RA, RB));
+			const FVec4 OutDot4 = Store(VectorDot4(RA, RB));
+			for (int i = 0; i < 4; ++i)
+			{
+				Dot.Compare(OutDot3.V[i], Dot3, Magnitude);
+				Dot.Compare(OutDot4.V[i], Dot4, Magnitude);
+			}
+
+			const double CrossRef[4] = {
+				static_cast<double>(A.V[1]) * B.V[2] - static_cast<double>(A.V[2]) * B.V[1],
+				static_cast<double>(A.V[2]) * B.V[0] - static_cast<double>(A.V[0]) * B.V[2],
+				static_cast<double>(A.V[0]) * B.V[1] - static_cast<double>(A.V[1]) * B.V[0],
+				0.0,
+			};
+			CompareVec4(Cross, VectorCross(RA, RB), CrossRef, Magnitude);
+
+			const double Length = std::sqrt(static_cast<double>(A.V[0]) * A.V[0] + static_cast<double>(A.V[1]) * A.V[1]
+				+ static_cast<double>(A.V[2]) * A.V[2] + static_cast<double>(A.V[3]) * A.V[3]);
+			const double Normalized[4] = { A.V[0] / Length, A.V[1] / Length, A.V[2] / Length, A.V[3] / Length };
+			CompareVec4(Normalize, VectorNormalizeSafe4(RA, VectorZero(), 1e-8f), Normalized);
+		}
+
+		const double Fallback[4] = { 0.0, 0.0, 1.0, 0.0 };
+		CompareVec4(Normalize, VectorNormalizeSafe4(VectorSet(1e-9f, 0.0f, 0.0f, 0.0f), VectorSet(0.0f, 0.0f, 1.0f, 0.0f), 1e-8f), Fallback);
+	}
+
+	void TestMatrix()
+	{
+		FCheck Transform("TransformVector", MatrixTolerance);
+		FCheck Multiply("MatrixMultiply", MatrixTolerance);
+
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			const FMat4 A = RandomMatrix(10.0f);
+			const FMat4 B = RandomMatrix(10.0f);
+			const FVec4 V = RandomVec4(10.0f);
+			VectorRegister4f RA[4], RB[4];
+			A.Load(RA);
+			B.Load(RB);
+
+			// 곱 4개의 합이므로 항의 크기는 400 정도
+			const double Magnitude = 400.0;
+
+			double VM[4];
+			for (int j = 0; j < 4; ++j)
+			{
+				VM[j] = 0.0;
+				for (int k = 0; k < 4; ++k)
+				{
+					VM[j] += static_cast<double>(V.V[k]) * A.M[k][j];
+				}
+			}
+			CompareVec4(Transform, VectorTransformVector(Load(V), RA), VM, Magnitude);
+
+			VectorRegister4f RC[4];
+			VectorMatrixMultiply(RC, RA, RB);
+			for (int i = 0; i < 4; ++i)
+			{
+				double Row[4];
+				for (int j = 0; j < 4; ++j)
+				{
+					Row[j] = 0.0;
+					for (int k = 0; k < 4; ++k)
+					{
+						Row[j] += static_cast<double>(A.M[i][k]) * B.M[k][j];
+					}
+				}
+				CompareVec4(Multiply, RC[i], Row, Magnitude);
+			}
+
+			// 결과가 입력과 같은 배열이어도 된다
+			VectorMatrixMultiply(RA, RA, RB);
+			for (int i = 0; i < 4; ++i)
+			{
+				const FVec4 InPlace = Store(RA[i]);
+				const FVec4 Separate = Store(RC[i]);
+				for (int j = 0; j < 4; ++j)
+				{
+					Multiply.Compare(InPlace.V[j], Separate.V[j]);
+				}
+			}
+		}
+	}
+
+	void TestInverse()
+	{
+		FCheck Inverse("MatrixInverse", InverseTolerance);
+		FCheck Singular("Inverse singular", ExactTolerance);
+
+		int NumTested = 0;
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			const FMat4 M = RandomMatrix(2.0f);
+			double Expected[4][4];
+			if (!ReferenceInverse(M, Expected))
+			{
+				continue;
+			}
+
+			// 조건수가 나쁜 행렬은 float 정밀도로 비교할 수 없어 제외 (역행렬 원소가 100을 넘는 경우)
+			double MaxElement = 0.0;
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+				{
+					MaxElement = (std::max)(MaxElement, std::fabs(Expected[i][j]));
+				}
+			}
+			if (MaxElement > 100.0)
+			{
+				continue;
+			}
+
+			VectorRegister4f Rows[4], Result[4];
+			M.Load(Rows);
+			Inverse.Expect(VectorMatrixInverse(Result, Rows, 1e-8f));
+			for (int i = 0; i < 4; ++i)
+			{
+				CompareVec4(Inverse, Result[i], Expected[i]);
+			}
+			++NumTested;
+		}
+		Inverse.Expect(NumTested > NumIterations / 2);
+
+		// 두 행이 같은 행렬은 거부하고 Result를 건드리지 않아야 함
+		// 원소가 2 이하일 때 행렬식의 반올림 잡음이 1e-5 정도까지 나오므로(백엔드 무관) 그보다 큰 하한을 쓴다
+		constexpr float SingularMinDeterminant = 1e-4f;
+		const double Untouched[4] = { 7.0, 7.0, 7.0, 7.0 };
+		for (int Iter = 0; Iter < 1000; ++Iter)
+		{
+			FMat4 M = RandomMatrix(2.0f);
+			for (int j = 0; j < 4; ++j)
+			{
+				M.M[2][j] = M.M[1][j];
+			}
+			VectorRegister4f Rows[4], Result[4];
+			M.Load(Rows);
+			for (int i = 0; i < 4; ++i)
+			{
+				Result[i] = VectorSetFloat1(7.0f);
+			}
+			Singular.Expect(!VectorMatrixInverse(Result, Rows, SingularMinDeterminant));
+			CompareVec4(Singular, Result[0], Untouched);
+		}
+	}
+
+	void TestInverseAffine()
+	{
+		FCheck Affine("MatrixInverseAffine", InverseAffineTolerance);
+		FCheck Orthonormal("MatrixInverseOrthonormal", InverseAffineTolerance);
+		FCheck IgnoresW("InverseAffine ignores W", ExactTolerance);
+		FCheck Singular("InverseAffine singular", ExactTolerance);
+
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			double Quat[4];
+			RandomUnitQuat(Quat);
+			const double Scale[3] = { RandomFloat(0.1f, 10.0f), RandomFloat(0.1f, 10.0f), RandomFloat(0.1f, 10.0f) };
+			const double Translation[3] = { RandomFloat(-1000.0f, 1000.0f), RandomFloat(-1000.0f, 1000.0f), RandomFloat(-1000.0f, 1000.0f) };
+			const FMat4 M = MakeAffine(Quat, Scale, Translation);
+
+			double Expected[4][4];
+			if (!ReferenceInverse(M, Expected))
+			{
+				continue;
+			}
+
+			// 이동 행은 |T| / 최소 스케일 크기까지 커지므로 그 크기로 나눠 상대 오차로 본다
+			const double MinScale = (std::min)({ Scale[0], Scale[1], Scale[2] });
+			const double TranslationScale = (std::max)(1.0, 1000.0 * std::sqrt(3.0) / MinScale);
+
+			VectorRegister4f Rows[4], Result[4];
+			M.Load(Rows);
+			Affine.Expect(VectorMatrixInverseAffine(Result, Rows, 1e-8f));
+			for (int i = 0; i < 4; ++i)
+			{
+				CompareVec4(Affine, Result[i], Expected[i], (i == 3) ? TranslationScale : 1.0);
+			}
+
+			// 행 0~2의 W 성분은 무시되어야 한다 (결과가 비트 단위로 같음)
+			FMat4 Dirty = M;
+			for (int i = 0; i < 3; ++i)
+			{
+				Dirty.M[i][3] = RandomFloat(-5.0f, 5.0f);
+			}
+			VectorRegister4f DirtyRows[4], DirtyResult[4];
+			Dirty.Load(DirtyRows);
+			IgnoresW.Expect(VectorMatrixInverseAffine(DirtyResult, DirtyRows, 1e-8f));
+			for (int i = 0; i < 4; ++i)
+			{
+				const FVec4 Clean = Store(Result[i]);
+				const double CleanRow[4] = { Clean.V[0], Clean.V[1], Clean.V[2], Clean.V[3] };
+				CompareVec4(IgnoresW, DirtyResult[i], CleanRow);
+			}
+
+			// 스케일 1이면 정규직교 경로와 같아야 한다
+			const double Unit[3] = { 1.0, 1.0, 1.0 };
+			const FMat4 R = MakeAffine(Quat, Unit, Translation);
+			double ExpectedR[4][4];
+			ReferenceInverse(R, ExpectedR);
+			R.Load(Rows);
+			VectorMatrixInverseOrthonormal(Result, Rows);
+			for (int i = 0; i < 4; ++i)
+			{
+				CompareVec4(Orthonormal, Result[i], ExpectedR[i], (i == 3) ? 1000.0 * std::sqrt(3.0) : 1.0);
+			}
+		}
+
+		// 스케일 0 축이 있으면 거부
+		double Quat[4];
+		RandomUnitQuat(Quat);
+		const double Flat[3] = { 1.0, 0.0, 1.0 };
+		const double Translation[3] = { 1.0, 2.0, 3.0 };
+		VectorRegister4f Rows[4], Result[4];
+		MakeAffine(Quat, Flat, Translation).Load(Rows);
+		Singular.Expect(!VectorMatrixInverseAffine(Result, Rows, 1e-8f));
+	}
+
+	void TestQuaternion()
+	{
+		FCheck Multiply("QuaternionMultiply", DotTolerance);
+		FCheck Rotate("QuaternionRotateVector", DotTolerance);
+
+		for (int Iter = 0; Iter < NumIterations; ++Iter)
+		{
+			double QA[4], QB[4];
+			RandomUnitQuat(QA);
+			RandomUnitQuat(QB);
+			const FVec4 A{ { static_cast<float>(QA[0]), static_cast<float>(QA[1]), static_cast<float>(QA[2]), static_cast<float>(QA[3]) } };
+			const FVec4 B{ { static_cast<float>(QB[0]), static_cast<float>(QB[1]), static_cast<float>(QB[2]), static_cast<float>(QB[3]) } };
+
+			// Hamilton 곱 A * B
+			const double X1 = A.V[0], Y1 = A.V[1], Z1 = A.V[2], W1 = A.V[3];
+			const double X2 = B.V[0], Y2 = B.V[1], Z2 = B.V[2], W2 = B.V[3];
+			const double Product[4] = {
+				W1 * X2 + X1 * W2 + Y1 * Z2 - Z1 * Y2,
+				W1 * Y2 - X1 * Z2 + Y1 * W2 + Z1 * X2,
+				W1 * Z2 + X1 * Y2 - Y1 * X2 + Z1 * W2,
+				W1 * W2 - X1 * X2 - Y1 * Y2 - Z1 * Z2,
+			};
+			CompareVec4(Multiply, VectorQuaternionMultiply(Load(A), Load(B)), Product);
+
+			// q * v * q^-1
+			const FVec4 V{ { RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f), 0.0f } };
+			const double VX = V.V[0], VY = V.V[1], VZ = V.V[2];
+			const double TX = 2.0 * (Y1 * VZ - Z1 * VY);
+			const double TY = 2.0 * (Z1 * VX - X1 * VZ);
+			const double TZ = 2.0 * (X1 * VY - Y1 * VX);
+			const double Rotated[4] = {
+				VX + W1 * TX + (Y1 * TZ - Z1 * TY),
+				VY + W1 * TY + (Z1 * TX - X1 * TZ),
+				VZ + W1 * TZ + (X1 * TY - Y1 * TX),
+				0.0,
+			};
+			CompareVec4(Rotate, VectorQuaternionRotateVector(Load(A), Load(V)), Rotated);
+		}
+	}
+
+	const char* GetBackendName()
+	{
+#if defined(MUNDI_SIMD_AVX2)
+		return "AVX2";
+#elif defined(MUNDI_SIMD_SSE)
+		return "SSE";
+#else
+		return "Scalar";
+#endif
+	}
+
+	// AVX2 빌드를 지원하지 않는 CPU에서 돌리면 건너뜀 (VectorIsBackendSupported와 같은 조건)
+	bool IsBackendSupported()
+	{
+#if defined(MUNDI_SIMD_AVX2)
+#if defined(_MSC_VER)
+		int Info[4];
+		__cpuid(Info, 0);
+		if (Info[0] < 7)
+		{
+			return false;
+		}
+		__cpuid(Info, 1);
+		const bool bFMA = (Info[2] & (1 << 12)) != 0;
+		const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+		const bool bAVX = (Info[2] & (1 << 28)) != 0;
+		if (!bFMA || !bOSXSave || !bAVX || (_xgetbv(0) & 0x6) != 0x6)
+		{
+			return false;
+		}
+		__cpuidex(Info, 7, 0);
+		return (Info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#else
+		return true;
+#endif
+	}
+}
+
+int main()
+{
+	std::printf("VectorRegister backend: %s\n", GetBackendName());
+	if (!IsBackendSupported())
+	{
+		std::printf("CPU does not support this backend, skipped\n");
+		return 0;
+	}
+
+	TestArithmetic();
+	TestPermutes();
+	TestDotCross();
+	TestMatrix();
+	TestInverse();
+	TestInverseAffine();
+	TestQuaternion();
+
+	std::printf("%s (%d failed checks)\n", NumFailures ? "FAILED" : "PASSED", NumFailures);
+	return NumFailures ? 1 : 0;
+}
@@ -19,6 +19,22 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 #endif
 
 	InitializeMiniDump();
+
+#ifdef _GAME
+    // -headless: 창/디바이스 없이 고정 프레임 시뮬레이션 후 프로파일 리포트 출력
+    FHeadlessRunSettings HeadlessSettings;
+    if (FHeadlessRunSettings::ParseCommandLine(lpCmdLine, HeadlessSettings))
+    {
+        if (!GEngine.StartupHeadless(HeadlessSettings))
+            return -1;
+
+        GEngine.RunHeadless();
+        GEngine.Shutdown();
+
+        return 0;
+    }
+#endif
+
     if (!GEngine.Startup(hInstance))
         return -1;
 